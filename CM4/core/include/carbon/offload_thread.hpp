@@ -1,9 +1,9 @@
 /**
  ******************************************************************************
- * @file           tcp_test_thread.hpp
+ * @file           offload_thread.hpp
  * @author         Michele Viti <micheleviti78@gmail.com>
- * @date           Nov. 2024
- * @brief          test for tcp connection
+ * @date           Oct. 2026
+ * @brief          CM4 worker, executes the jobs posted by the CM7
  ******************************************************************************
  * @attention
  * Copyright (c) 2022 Michele Viti.
@@ -20,24 +20,11 @@
 
 #include <carbon/thread.hpp>
 
-#include <lwip/api.h>
-
-#define TCP_TEST_BLOCK_SIZE 512
-
-class TCPTestThread : public Thread {
+class OffloadThread : public Thread {
 public:
-    TCPTestThread();
-    ~TCPTestThread() = default;
+    OffloadThread();
+    ~OffloadThread() override = default;
 
 protected:
     void run() override;
-    void receiveTestFile();
-    bool checkBlock();
-    struct netconn *conn_{nullptr};
-    struct netconn *newConn_{nullptr};
-    struct netbuf *recvNetbuf_{nullptr};
-    void *recvBuf_{nullptr};
-    uint16_t recvBufSize_{0};
-    uint8_t block_[TCP_TEST_BLOCK_SIZE]{0};
-    uint32_t nblock_{0};
-};
\ No newline at end of file
+};
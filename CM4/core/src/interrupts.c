@@ -17,6 +17,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <carbon/diag.hpp>
+#include <carbon/latency.hpp>
 
 #include <stm32h7xx_hal.h>
 
@@ -215,7 +216,11 @@ void DebugMon_Handler(void) {}
  * @brief This function handles TIM5.
  */
 
-void TIM5_IRQHandler(void) { carbon_hw_us_systime_tim_isr(); }
+void TIM5_IRQHandler(void) {
+    uint32_t stamp = carbon_latency_enter(CARBON_LATENCY_SYSTIME);
+    carbon_hw_us_systime_tim_isr();
+    carbon_latency_exit(CARBON_LATENCY_SYSTIME, stamp);
+}
 
 /**
  * @brief This function handles HSEM1.
@@ -18,12 +18,11 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <carbon/diag.hpp>
-#include <carbon/pin.hpp>
-#include <carbon/shared_memory.hpp>
+#include <carbon/offload_thread.hpp>
 
-#include <stm32h7xx_hal.h>
+#include <cmsis_os.h>
 
-using namespace CARBON;
+static OffloadThread offloadThread;
 
 extern "C" {
 
@@ -34,10 +33,13 @@ extern "C" {
 int main(void) {
     DIAG(SYSTEM_DIAG "CM4 ready");
 
-    /* Infinite loop */
+    offloadThread.start();
+
+    osKernelStart();
+
+    RAW_DIAG(SYSTEM_DIAG "ERROR OS");
+
     while (1) {
-        HAL_Delay(500);
-        BSP_LED_Toggle(LED_BLUE);
     }
 }
 
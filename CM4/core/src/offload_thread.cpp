@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @file           offload_thread.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          CM4 worker, executes the jobs posted by the CM7
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/diag.hpp>
+#include <carbon/ipc.hpp>
+#include <carbon/offload_thread.hpp>
+#include <carbon/pin.hpp>
+#include <carbon/registry.hpp>
+#include <carbon/timebase.hpp>
+
+#include <stm32h7xx_hal.h>
+
+using namespace CARBON;
+
+static constexpr uint32_t TIMEBASE_REPORT_PERIOD = 120; /*loops, 60s*/
+static constexpr uint32_t LED_PERIOD = 500;             /*ms*/
+
+static void timebaseReport() {
+    TimebaseStats stats;
+    if (!timebaseStats(stats))
+        return;
+    DIAG(SYSTEM_DIAG "time base drift %ld ppb, residual last %ld us max %lu "
+                     "us, window %lu-%lu us, samples %lu, rejected %lu",
+         stats.driftPpb, stats.lastResidualUs, stats.maxResidualUs,
+         stats.minWindowUs, stats.maxWindowUs, stats.samples, stats.rejected);
+}
+
+OffloadThread::OffloadThread()
+    : Thread("offload_thread", osPriorityNormal,
+             configMINIMAL_STACK_SIZE * 4) {}
+
+void OffloadThread::run() {
+    uint32_t loops = 0;
+    auto &mailbox = coreMailbox();
+    auto &worker = offloadWorker();
+    MailboxMessage message;
+
+    while (1) {
+        auto start = HAL_GetTick();
+        uint32_t elapsed;
+        while ((elapsed = HAL_GetTick() - start) < LED_PERIOD) {
+            if (!mailbox.receive(message, LED_PERIOD - elapsed))
+                continue;
+            if (!worker.process(message))
+                mailboxHandleSystem(message);
+        }
+        BSP_LED_Toggle(LED_BLUE);
+        registryPublish<RegistryId::CM4>(
+            {HAL_GetTick(), worker.jobs(),
+             static_cast<uint32_t>(xPortGetFreeHeapSize())});
+        if (++loops % TIMEBASE_REPORT_PERIOD == 0) {
+            timebaseReport();
+            DIAG(SYSTEM_DIAG "offload jobs %lu", worker.jobs());
+        }
+    }
+}
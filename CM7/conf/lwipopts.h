@@ -50,7 +50,18 @@
 #define LWIP_NETIF_LINK_CALLBACK    1
 #define LWIP_NETIF_STATUS_CALLBACK  1
 #define LWIP_NUM_NETIF_CLIENT_DATA  1
-#define LWIP_STATS                  0
+/*the counters of the network benchmark, the pools are not tracked*/
+#define LWIP_STATS                  1
+#define LWIP_STATS_LARGE            1
+#define MIB2_STATS                  1
+#define ETHARP_STATS                0
+#define IP_STATS                    0
+#define IPFRAG_STATS                0
+#define ICMP_STATS                  0
+#define IGMP_STATS                  0
+#define MEM_STATS                   0
+#define MEMP_STATS                  0
+#define SYS_STATS                   0
 #define MDNS_MAX_SERVICES           2
 #define LWIP_TCP_KEEPALIVE          1
 
@@ -17,6 +17,7 @@
  */
 
 #include <alloca.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // options to control how MicroPython is built
@@ -27,8 +28,64 @@
 // MicroPython configuration.
 #define MICROPY_ENABLE_COMPILER (1)
 #define MICROPY_ENABLE_GC (1)
+#define MICROPY_ENABLE_FINALISER (1)
+
+// import and open() on the FatFs volume, .mpy cache next to the sources
+#define MICROPY_HAS_FILE_READER (1)
+#define MICROPY_PERSISTENT_CODE_LOAD (1)
+#define MICROPY_PERSISTENT_CODE_SAVE (1)
+
+// sampling profiler, core/src/mp_port/mpprofile.c, it needs the line numbers
+#define MICROPY_ENABLE_SOURCE_LINE (1)
+struct _mp_code_state_t;
+extern volatile uint32_t mp_carbon_profile_pending;
+void mp_carbon_profile_sample(const struct _mp_code_state_t *code_state,
+                              const uint8_t *ip);
+#define MICROPY_VM_HOOK_LOOP                                                   \
+    if (mp_carbon_profile_pending) {                                           \
+        mp_carbon_profile_sample(code_state, ip);                              \
+    }
+#define MICROPY_VM_HOOK_RETURN MICROPY_VM_HOOK_LOOP
+
+// @micropython.native, viper and asm_thumb, the code goes in the 32 KB exec
+// area of core/src/mp_port/mpgc.c, py/emitglue.c maintains the caches. The
+// code no longer referenced is reclaimed when the area is full, more live
+// native code than fits raises MemoryError; usage in micropython.mem_info()
+#ifdef CARBON_HOST
+// the host simulation runs the same emitters for x86-64, the area is cache
+// coherent
+#define MICROPY_EMIT_X64 (1)
+#else
+#include <stm32h7xx.h>
+#define MICROPY_EMIT_THUMB (1)
+#define MICROPY_EMIT_INLINE_THUMB (1)
+#endif
+void mp_carbon_exec_alloc(size_t min_size, void **ptr, size_t *size);
+void mp_carbon_exec_free(void *ptr, size_t size);
+#define MP_PLAT_ALLOC_EXEC(min_size, ptr, size)                                \
+    mp_carbon_exec_alloc(min_size, ptr, size)
+#define MP_PLAT_FREE_EXEC(ptr, size) mp_carbon_exec_free(ptr, size)
+#ifndef CARBON_HOST
+#define MICROPY_MAKE_POINTER_CALLABLE(p) ((void *)((uintptr_t)(p) | 1))
+#define MP_HAL_CLEAN_DCACHE(addr, size)                                        \
+    SCB_CleanDCache_by_Addr((uint32_t *)((uintptr_t)(addr) & ~31u),            \
+                            (int32_t)((size) + ((uintptr_t)(addr) & 31u)))
+#endif
 
 #define MICROPY_PY_GC (1)
+
+// fast nursery area for the small objects, core/src/mp_port/mpgc.c
+#define MICROPY_GC_SPLIT_HEAP (1)
+#define MICROPY_PY_MICROPYTHON_MEM_INFO (1)
+#define MICROPY_CARBON_GC_SMALL_BLOCKS (16) /*256 bytes and less*/
+struct _mp_state_mem_area_t;
+struct _mp_print_t;
+struct _mp_state_mem_area_t *
+mp_carbon_gc_alloc_area(struct _mp_state_mem_area_t *area, size_t n_blocks);
+void mp_carbon_gc_dump_info(const struct _mp_print_t *print);
+#define MICROPY_GC_ALLOC_AREA(area, n_blocks)                                  \
+    mp_carbon_gc_alloc_area(area, n_blocks)
+#define MICROPY_GC_DUMP_INFO_HOOK(print) mp_carbon_gc_dump_info(print)
 #define MICROPY_PY_THREAD (1)
 #define MICROPY_PY_THREAD_GIL (1)
 
@@ -38,6 +95,9 @@
 
 #define MICROPY_PY_RE (1)
 
+// CTRL-C from the network console, shared/runtime/interrupt_char.c
+#define MICROPY_KBD_EXCEPTION (1)
+
 #define MICROPY_HELPER_REPL (1)
 #define MICROPY_REPL_INFO (1)
 #define MICROPY_REPL_AUTO_INDENT (1)
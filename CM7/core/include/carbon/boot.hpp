@@ -0,0 +1,79 @@
+/**
+ ******************************************************************************
+ * @file           boot.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          CM7 boot timeline and init scheduler platform
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*timestamped milestone, from the tasks and before the scheduler*/
+void carbon_boot_mark(const char *name);
+
+#ifdef __cplusplus
+}
+
+#include <carbon/completion.hpp>
+#include <carbon/init_scheduler.hpp>
+#include <carbon/irq.hpp>
+
+namespace CARBON {
+
+/*first thing in low_level_init, the DWT counts the time until systime*/
+void bootStart();
+
+/*right after low_level_system_time, the marks use its counter from here*/
+void bootClockStarted();
+
+inline void bootMark(const char *name) { carbon_boot_mark(name); }
+
+/*previous and current timelines, from a task*/
+void bootDump();
+
+/*the workers run at the priority of the task calling run()*/
+struct BootPlatform {
+    using Lock = IRQLockRecursive;
+
+    class Event {
+    public:
+        Event() : completion_("boot") {}
+
+        void signal() { completion_.complete(); }
+
+        void wait() { completion_.wait(); }
+
+    private:
+        Completion completion_;
+    };
+
+    static uint64_t nowUs();
+
+    static bool spawn(void (*entry)(void *), void *argument, const char *name,
+                      uint32_t stackWords);
+
+    static void exit();
+
+    static void milestone(const char *name) { bootMark(name); }
+};
+
+using BootScheduler = InitScheduler<BootPlatform>;
+
+} // namespace CARBON
+#endif
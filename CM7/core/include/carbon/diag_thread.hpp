@@ -20,7 +20,7 @@
 
 #include <carbon/thread.hpp>
 
-class DiagThread : public Thread {
+class DiagThread : public StaticThread<configMINIMAL_STACK_SIZE * 10> {
 public:
     DiagThread();
     ~DiagThread() override = default;
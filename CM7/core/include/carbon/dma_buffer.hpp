@@ -0,0 +1,159 @@
+/**
+ ******************************************************************************
+ * @file           dma_buffer.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          DMA buffers and cache maintenance by cache line
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Cache maintenance of the lines touched by [buffer, buffer + length), only a
+ * barrier if the memory is not cacheable.
+ */
+
+/*before the DMA reads the buffer: clean*/
+void carbon_dma_prepare_transmit(const void *buffer, size_t length);
+
+/*before the DMA writes the buffer: clean and invalidate, safe if misaligned*/
+void carbon_dma_prepare_receive(void *buffer, size_t length);
+
+/*after the DMA wrote the buffer: invalidate, the lines must be owned*/
+void carbon_dma_complete_receive(void *buffer, size_t length);
+
+#ifdef __cplusplus
+}
+
+namespace CARBON {
+
+enum class DmaPool : uint32_t {
+    Cacheable,    /*maintenance of the touched lines*/
+    NonCacheable, /*MPU region, no maintenance*/
+};
+
+constexpr size_t dmaLines(size_t size) {
+    return (size + CACHE_ALIGNMENT - 1) & ~size_t{CACHE_ALIGNMENT - 1};
+}
+
+/*static DMA memory, aligned and padded to whole cache lines by its type*/
+template <size_t Size> struct alignas(CACHE_ALIGNMENT) DmaStorage {
+    uint8_t data[dmaLines(Size)];
+
+    static constexpr size_t size() { return Size; }
+};
+
+bool dmaCacheable(const void *buffer);
+
+inline void dmaPrepareTransmit(const void *buffer, size_t length) {
+    carbon_dma_prepare_transmit(buffer, length);
+}
+
+inline void dmaPrepareReceive(void *buffer, size_t length) {
+    carbon_dma_prepare_receive(buffer, length);
+}
+
+inline void dmaCompleteReceive(void *buffer, size_t length) {
+    carbon_dma_complete_receive(buffer, length);
+}
+
+/*
+ * Owns whole cache lines from one of the DMA pools, the maintenance never
+ * touches a neighbour. offset and length select the part used by a transfer.
+ */
+class DmaBuffer {
+public:
+    DmaBuffer() = default;
+
+    ~DmaBuffer() { release(); }
+
+    PREVENT_COPY(DmaBuffer)
+
+    DmaBuffer(DmaBuffer &&other) noexcept
+        : data_(other.data_), size_(other.size_), pool_(other.pool_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    DmaBuffer &operator=(DmaBuffer &&other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = other.data_;
+            size_ = other.size_;
+            pool_ = other.pool_;
+            other.data_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    /*empty if the pool is exhausted*/
+    static DmaBuffer allocate(size_t size, DmaPool pool = DmaPool::Cacheable);
+
+    explicit operator bool() const { return data_ != nullptr; }
+
+    uint8_t *data() { return data_; }
+    const uint8_t *data() const { return data_; }
+    size_t size() const { return size_; }
+    DmaPool pool() const { return pool_; }
+
+    void prepareTransmit(size_t offset = 0, size_t length = SIZE_MAX) {
+        if (clip(offset, length))
+            dmaPrepareTransmit(data_ + offset, length);
+    }
+
+    void prepareReceive(size_t offset = 0, size_t length = SIZE_MAX) {
+        if (clip(offset, length))
+            dmaPrepareReceive(data_ + offset, length);
+    }
+
+    void completeReceive(size_t offset = 0, size_t length = SIZE_MAX) {
+        if (clip(offset, length))
+            dmaCompleteReceive(data_ + offset, length);
+    }
+
+private:
+    DmaBuffer(uint8_t *data, size_t size, DmaPool pool)
+        : data_(data), size_(size), pool_(pool) {}
+
+    bool clip(size_t offset, size_t &length) const {
+        if (offset >= size_)
+            return false;
+        if (length > size_ - offset)
+            length = size_ - offset;
+        return length > 0;
+    }
+
+    void release();
+
+    uint8_t *data_{nullptr};
+    size_t size_{0};
+    DmaPool pool_{DmaPool::Cacheable};
+};
+
+} // namespace CARBON
+#endif
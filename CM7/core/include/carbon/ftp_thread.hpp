@@ -19,7 +19,7 @@
 #pragma once
 
 #include <carbon/thread.hpp>
-class FTPThread : public Thread {
+class FTPThread : public StaticThread<configMINIMAL_STACK_SIZE * 8> {
 public:
     FTPThread();
     ~FTPThread() = default;
@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * @file           heap.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          CM7 heap, placement classes on top of TLSF pools
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CARBON_HEAP_FAST, /*AXI SRAM*/
+    CARBON_HEAP_BULK, /*SDRAM*/
+    CARBON_HEAP_DMA,  /*AXI SRAM, whole cache lines*/
+    CARBON_HEAP_DMA_NOCACHE, /*AXI SRAM, not cacheable by the MPU*/
+    CARBON_HEAP_COUNT
+} carbon_heap_class;
+
+/*no fall back to another class*/
+void *carbon_heap_malloc(carbon_heap_class heapClass, size_t size);
+
+void carbon_heap_free(void *pointer);
+
+#ifdef __cplusplus
+}
+
+#include <carbon/tlsf.hpp>
+
+namespace CARBON {
+
+enum class HeapClass : uint32_t {
+    Fast = CARBON_HEAP_FAST,
+    Bulk = CARBON_HEAP_BULK,
+    Dma = CARBON_HEAP_DMA,
+    DmaNoCache = CARBON_HEAP_DMA_NOCACHE,
+    Count = CARBON_HEAP_COUNT
+};
+
+struct HeapPlacement {
+    HeapClass heapClass;
+    bool spill; /*to Bulk when the class is exhausted, else the call fails*/
+};
+
+/*
+ * Chooses the class of the pvPortMalloc() allocations: FreeRTOS stacks and
+ * objects, lwIP, C++ new, FatFs. The default keeps everything in Fast
+ * without spill: a full Fast heap fails the allocation and calls the malloc
+ * failed hook, no stack lands in SDRAM unnoticed.
+ */
+using HeapPolicy = HeapPlacement (*)(size_t size);
+
+void heapInit();
+
+void heapSetPolicy(HeapPolicy policy);
+
+void *heapAllocate(HeapClass heapClass, size_t size);
+
+void heapFree(void *pointer);
+
+bool heapStats(HeapClass heapClass, TlsfStats &stats);
+
+/*pvPortMalloc() allocations moved to Bulk, by a policy allowing it*/
+uint32_t heapSpills();
+
+void heapReport();
+
+/*
+ * Region of an ObjectPool: the blocks come from a heap class at init(),
+ * after heapInit(), and are never given back.
+ */
+template <HeapClass Class> struct HeapRegion {
+    template <size_t Bytes, size_t Align> class Storage {
+    public:
+        uint8_t *get() {
+            if (memory_ == nullptr)
+                memory_ = static_cast<uint8_t *>(
+                    heapAllocate(Class, Bytes + Align - 1));
+            if (memory_ == nullptr)
+                return nullptr;
+            auto address = reinterpret_cast<uintptr_t>(memory_);
+            return reinterpret_cast<uint8_t *>((address + Align - 1) &
+                                               ~(Align - 1));
+        }
+
+    private:
+        uint8_t *memory_{nullptr};
+    };
+};
+
+} // namespace CARBON
+#endif
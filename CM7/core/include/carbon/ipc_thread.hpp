@@ -0,0 +1,31 @@
+/**
+ ******************************************************************************
+ * @file           ipc_thread.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          receives the messages of the CM4 and completes the offload jobs
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/thread.hpp>
+
+class IPCThread
+    : public StaticThread<configMINIMAL_STACK_SIZE * 4, ThreadRegion::Dtcm> {
+public:
+    IPCThread();
+    ~IPCThread() override = default;
+
+protected:
+    void run() override;
+};
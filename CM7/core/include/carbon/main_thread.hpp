@@ -20,7 +20,7 @@
 
 #include <carbon/thread.hpp>
 
-class MainThread : public Thread {
+class MainThread : public StaticThread<configMINIMAL_STACK_SIZE * 10> {
 public:
     MainThread();
     ~MainThread() override = default;
@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file           mdma_copy.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          memory copies by the MDMA, CPU below the threshold
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*copies and waits from a task, returns 0 or -1 if the MDMA failed*/
+int carbon_copy(void *dst, const void *src, size_t length);
+
+void carbon_mdma_isr(void);
+
+#ifdef __cplusplus
+}
+
+#include <carbon/copy_service.hpp>
+#include <carbon/irq.hpp>
+
+#include <stm32h7xx_hal.h>
+
+namespace CARBON {
+
+/*
+ * Below it the CPU is done before the MDMA is set up and the task woken up,
+ * tune it with copyBenchmark().
+ */
+static constexpr size_t COPY_THRESHOLD = 4096;
+
+/*one channel, a transfer is a linked list of blocks of at most 64 KB*/
+class MdmaEngine {
+public:
+    static constexpr uint32_t MAX_NODES = 16;
+    static constexpr size_t MAX_BLOCK = 65536;
+    static constexpr size_t MAX_LENGTH = MAX_NODES * MAX_BLOCK;
+
+    MdmaEngine() = default;
+
+    PREVENT_COPY_AND_MOVE(MdmaEngine)
+
+    void init();
+
+    void setHandler(CopyEngineHandler handler) {
+        handler_ = std::move(handler);
+    }
+
+    void start(void *dst, const void *src, size_t length);
+
+    void isr();
+
+private:
+    static void transferComplete(MDMA_HandleTypeDef *handle);
+
+    static void transferError(MDMA_HandleTypeDef *handle);
+
+    MDMA_HandleTypeDef handle_{};
+    /*read by the MDMA, the first block is in the channel registers*/
+    alignas(CACHE_ALIGNMENT) MDMA_LinkNodeTypeDef nodes_[MAX_NODES - 1]{};
+    CopyEngineHandler handler_;
+    volatile bool startFailed_{false};
+};
+
+struct CopyPlatform {
+    static void cpuCopy(void *dst, const void *src, size_t length);
+    static void prepareSource(const void *src, size_t length);
+    static void prepareDestination(void *dst, size_t length);
+    static void completeDestination(void *dst, size_t length);
+};
+
+using CoreCopyService = CopyService<MdmaEngine, IRQLockRecursive, CopyPlatform>;
+
+void copyInit();
+
+CoreCopyService &copyService();
+
+/*waits on the task notification, not from an interrupt*/
+CopyStatus copy(void *dst, const void *src, size_t length);
+
+struct CopyBenchmarkResult {
+    uint32_t cpuCycles;  /*average of a copy*/
+    uint32_t mdmaCycles; /*setup, transfer and wake up*/
+    uint32_t threshold;  /*bytes, the one in use*/
+};
+
+/*
+ * CPU and MDMA copy of size bytes from SDRAM to SDRAM, from a task, on
+ * demand: carbon.copy_bench(). False without memory or if the MDMA failed.
+ */
+bool copyBenchmark(size_t size, CopyBenchmarkResult &result);
+
+} // namespace CARBON
+#endif
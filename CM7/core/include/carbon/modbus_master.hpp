@@ -24,7 +24,7 @@ class ModbusMaster {
 public:
     // Modbus constants
     static constexpr uint16_t TCP_PORT = 502;
-    static constexpr uint16_t MAX_PDU_SIZE = 256;
+    static constexpr uint16_t MAX_READ_REGISTERS = 125;
 
     // Modbus Function Codes
     static constexpr uint8_t FUNC_READ_HOLDING_REGISTERS = 0x03;
@@ -43,30 +43,31 @@ public:
         uint8_t slaveId;
     };
 
-    // Modbus Message Structure
-    struct ModbusMessage {
-        uint8_t slaveId;
-        uint8_t functionCode;
-        uint16_t startAddress;
-        uint8_t byteCount;
-        uint8_t data[2]; // Only one register (2 bytes)
-    };
-
     ModbusMaster() = default;
 
     Result<uint16_t> readHoldingRegister(const ModbusSlave &slave,
                                          uint16_t startAddress);
     Result<uint16_t> readInputRegister(const ModbusSlave &slave,
                                        uint16_t startAddress);
+    // Batch reads, count consecutive registers into values
+    Error readHoldingRegisters(const ModbusSlave &slave, uint16_t startAddress,
+                               uint16_t *values, uint16_t count);
+    Error readInputRegisters(const ModbusSlave &slave, uint16_t startAddress,
+                             uint16_t *values, uint16_t count);
     Error writeHoldingRegister(const ModbusSlave &slave, uint16_t startAddress,
                                uint16_t value);
 
 private:
     bool isValidIp(const ModbusSlave &slave) const;
-    void constructReadRegister(ModbusMessage &request, const ModbusSlave &slave,
-                               uint16_t startAddress, uint8_t functionCode);
-    void constructWriteRegister(ModbusMessage &request,
-                                const ModbusSlave &slave, uint16_t startAddress,
-                                uint16_t value);
-    Result<uint16_t> processResponse(uint8_t *response, size_t len);
+    Error transact(const ModbusSlave &slave, const uint8_t *request,
+                   uint8_t *response, size_t &len);
+    Error readRegisters(const ModbusSlave &slave, uint16_t startAddress,
+                        uint8_t functionCode, uint16_t *values,
+                        uint16_t count);
+    void publish(const ModbusSlave &slave, uint8_t functionCode,
+                 uint16_t startAddress, const Result<uint16_t> &result);
+
+    uint16_t transaction_{0};
+    uint32_t reads_{0};
+    uint32_t errors_{0};
 };
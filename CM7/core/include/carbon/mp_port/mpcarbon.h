@@ -29,10 +29,12 @@ extern "C" {
 #endif
 
 #if MICROPY_PY_THREAD
-void mp_carbon_init(void *stack, size_t stack_len, void *gc_heap,
+void mp_carbon_init(void *stack, size_t stack_len, void *gc_nursery,
+                    size_t gc_nursery_size, void *gc_heap,
                     size_t gc_heap_size, void *sp);
 #else
-void mp_carbon_init(void *gc_heap, size_t gc_heap_size, void *sp);
+void mp_carbon_init(void *gc_nursery, size_t gc_nursery_size, void *gc_heap,
+                    size_t gc_heap_size, void *sp);
 #endif
 void mp_carbon_deinit();
 
@@ -42,6 +44,7 @@ void mp_carbon_exec_str(const char *src);
 
 #if MICROPY_PERSISTENT_CODE_LOAD
 void mp_carbon_exec_mpy(const uint8_t *mpy, size_t len);
+void mp_carbon_exec_file(const char *path);
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,49 @@
+/**
+ ******************************************************************************
+ * @file           mpconsole.h
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micropython network console
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef MICROPY_INCLUDED_CARBON_MP_CONSOLE_H
+#define MICROPY_INCLUDED_CARBON_MP_CONSOLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*one client on the console port, after the network*/
+void carbon_console_start(void);
+
+/*buffered, sent on newline, a full segment or after a short idle time*/
+size_t carbon_console_write(const char *str, size_t len);
+
+/*sends the buffered output now*/
+void carbon_console_flush(void);
+
+/*blocking, CTRL-C then CTRL-D when the client hangs up*/
+int carbon_console_read(void);
+
+/*timeout in ms or osWaitForever, true with a client connected*/
+bool carbon_console_wait_client(uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MICROPY_INCLUDED_CARBON_MP_CONSOLE_H
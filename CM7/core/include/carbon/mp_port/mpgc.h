@@ -0,0 +1,34 @@
+/**
+ ******************************************************************************
+ * @file           mpgc.h
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micropython heap areas, native code area and statistics
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef MICROPY_INCLUDED_CARBON_MP_GC_H
+#define MICROPY_INCLUDED_CARBON_MP_GC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*the placement and mem_info hooks are in mpconfigport.h*/
+
+/*nursery first, it takes the small objects, then the large area*/
+void mp_carbon_gc_init(void *nursery, size_t nursery_size, void *heap,
+                       size_t heap_size);
+
+/*from gc_collect(), duration of one collection*/
+void mp_carbon_gc_collected(uint32_t us);
+
+#endif // MICROPY_INCLUDED_CARBON_MP_GC_H
@@ -0,0 +1,37 @@
+/**
+ ******************************************************************************
+ * @file           mpprofile.h
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micropython sampling profiler
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef MICROPY_INCLUDED_CARBON_MP_PROFILE_H
+#define MICROPY_INCLUDED_CARBON_MP_PROFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct _mp_print_t;
+
+/*the VM hooks are in mpconfigport.h*/
+
+/*samples per second, 0 stops, the counts are kept*/
+bool mp_carbon_profile_start(uint32_t rate);
+
+void mp_carbon_profile_reset(void);
+
+/*per line and per function, the most sampled first*/
+void mp_carbon_profile_dump(const struct _mp_print_t *print);
+
+#endif // MICROPY_INCLUDED_CARBON_MP_PROFILE_H
@@ -23,7 +23,11 @@
 extern "C" {
 #endif
 
-void start_micropython();
+/*starts the task, returns with the interpreter and its heap initialized*/
+void micropython_init();
+
+/*hands 0:/main.py over to the task, then the console*/
+void micropython_run();
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,35 @@
+/**
+ ******************************************************************************
+ * @file           net_bench_thread.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          network benchmark service
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/thread.hpp>
+
+/*
+ * Serves the tests of misc/net_bench one at a time, the protocol is in
+ * carbon/net_bench_format.hpp. The sending half of the bidirectional test
+ * runs in a second thread, a netconn is used by one thread only.
+ */
+class NetBenchThread : public StaticThread<configMINIMAL_STACK_SIZE * 16> {
+public:
+    NetBenchThread();
+    ~NetBenchThread() = default;
+
+protected:
+    void run() override;
+};
@@ -0,0 +1,66 @@
+/**
+ ******************************************************************************
+ * @file           sd_bench.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          SD card throughput and latency benchmark
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/error.hpp>
+
+#include <cstdint>
+
+namespace CARBON {
+
+static constexpr uint32_t SD_BENCH_MAX_DEPTH = 4;
+static constexpr uint32_t SD_BENCH_MAX_REQUEST = 65536;
+static constexpr uint32_t SD_BENCH_MAX_DURATION = 600000; /*ms*/
+static constexpr uint32_t SD_BENCH_DEFAULT_SPAN = 16 * 1024 * 1024;
+
+/*
+ * The requests go to 0:/sdbench.bin, allocated contiguous. Raw requests are
+ * disk_read() and disk_write() of its sectors under the volume lock, without
+ * the FatFs cache and cluster chain; file requests are f_lseek() and
+ * f_read() or f_write(). Sequential requests follow each other through the
+ * span and wrap, random ones are aligned to their size.
+ *
+ * Depth is the number of tasks issuing requests: the SDMMC runs one
+ * command at a time, the others wait on the volume lock, as the FTP server
+ * and the scripts do.
+ */
+struct SdBenchConfig {
+    bool file{false};   /*through FatFs*/
+    bool random{false};
+    bool write{false};
+    uint32_t requestSize{4096}; /*bytes, whole sectors*/
+    uint32_t depth{1};
+    uint32_t durationMs{2000};
+    uint32_t spanBytes{SD_BENCH_DEFAULT_SPAN}; /*size of the file*/
+};
+
+struct SdBenchResult {
+    uint32_t requests;
+    uint32_t errors; /*a failed request stops its task*/
+    uint32_t elapsedUs;
+    uint32_t p50Us; /*upper bound of the histogram bucket*/
+    uint32_t p90Us;
+    uint32_t p99Us;
+    uint32_t maxUs;
+};
+
+/*one run at a time, from a task, with the volume mounted*/
+Error sdBenchRun(const SdBenchConfig &config, SdBenchResult &result);
+
+} // namespace CARBON
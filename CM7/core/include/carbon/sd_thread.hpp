@@ -18,12 +18,19 @@
 
 #pragma once
 
+#include <carbon/completion.hpp>
 #include <carbon/thread.hpp>
-class SDThread : public Thread {
+class SDThread : public StaticThread<configMINIMAL_STACK_SIZE * 64> {
 public:
     SDThread();
     ~SDThread() = default;
 
+    /*from one task, timeout in ms, false if no volume mounted in time*/
+    bool waitMounted(uint32_t timeout) { return mounted_.wait(timeout); }
+
 protected:
     void run() override;
+
+private:
+    CARBON::Completion mounted_;
 };
\ No newline at end of file
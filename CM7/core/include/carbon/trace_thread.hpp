@@ -19,7 +19,7 @@
 #pragma once
 
 #include <carbon/thread.hpp>
-class TraceThread : public Thread {
+class TraceThread : public StaticThread<configMINIMAL_STACK_SIZE * 5> {
 public:
     TraceThread();
     ~TraceThread() = default;
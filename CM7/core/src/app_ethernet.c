@@ -25,6 +25,7 @@
 #include <carbon/diag.hpp>
 #include <carbon/ethernetif.h>
 #include <carbon/pin.hpp>
+#include <carbon/registry.hpp>
 
 #include <cmsis_os.h>
 
@@ -41,6 +42,13 @@ __IO uint8_t DHCP_state = DHCP_OFF;
 
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
+static void publish_link(struct netif *netif) {
+    carbon_registry_net_link(netif_is_up(netif) ? 1 : 0,
+                             ip4_addr_get_u32(netif_ip4_addr(netif)),
+                             ip4_addr_get_u32(netif_ip4_netmask(netif)),
+                             ip4_addr_get_u32(netif_ip4_gw(netif)));
+}
+
 /**
  * @brief  Notify the User about the network interface config status
  * @param  netif: the network interface
@@ -58,6 +66,7 @@ void ethernet_link_status_updated(struct netif *netif) {
         DHCP_state = DHCP_LINK_DOWN;
 #endif /* LWIP_DHCP */
     }
+    publish_link(netif);
 }
 
 #if LWIP_DHCP
@@ -88,6 +97,7 @@ void DHCP_Thread(void const *argument) {
                 DHCP_state = DHCP_ADDRESS_ASSIGNED;
                 DIAG(LWIP_DIAG "address via DHCP %s",
                      ip4addr_ntoa(netif_ip4_addr(netif)));
+                publish_link(netif);
             } else {
                 dhcp = (struct dhcp *)netif_get_client_data(
                     netif, LWIP_NETIF_CLIENT_DATA_INDEX_DHCP);
@@ -109,6 +119,7 @@ void DHCP_Thread(void const *argument) {
 
                     DIAG(LWIP_DIAG "static address %s",
                          ip4addr_ntoa(netif_ip4_addr(netif)));
+                    publish_link(netif);
                 }
             }
         } break;
@@ -0,0 +1,208 @@
+/**
+ ******************************************************************************
+ * @file           boot.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          CM7 boot timeline and init scheduler platform
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/boot.hpp>
+#include <carbon/boot_timeline.hpp>
+#include <carbon/diag.hpp>
+#include <carbon/systime.hpp>
+#include <carbon/thread.hpp>
+
+#include <stm32h7xx_hal.h>
+
+#include <py/mpconfig.h> /*only to retrieve the version*/
+
+#include <lwip/init.h> /*only to retrieve the version*/
+
+#include <ff.h> /*only to retrieve the version*/
+
+#include <FreeRTOS.h>
+#include <cmsis_os.h>
+#include <task.h>
+
+#define GET_HAL_VERSION_MAIN ((HAL_GetHalVersion() >> 24) & 0xFFUL)
+#define GET_HAL_VERSION_SUB1 ((HAL_GetHalVersion() >> 16) & 0xFFUL)
+#define GET_HAL_VERSION_SUB2 ((HAL_GetHalVersion() >> 8) & 0xFFUL)
+#define GET_HAL_VERSION_RC (HAL_GetHalVersion() & 0xFFUL)
+
+#define GET_CMSIS_VERSION_MAIN ((osCMSIS >> 16) & 0xFFUL)
+#define GET_CMSIS_VERSION_SUB (osCMSIS & 0xFFUL)
+
+using namespace CARBON;
+
+CARBON_NOINIT static BootTimeline<> timeline;
+
+/*
+ * Before systime the DWT segments between the marks are summed, each at the
+ * core clock found at its end: mark before and after a clock change.
+ */
+static uint64_t elapsedUs;
+static uint32_t lastStamp;
+static int64_t clockOffsetUs;
+static bool clockStarted;
+
+static uint64_t bootUs() {
+    if (clockStarted)
+        return static_cast<uint64_t>(static_cast<int64_t>(systimeUs()) +
+                                     clockOffsetUs);
+    auto stamp = DWT->CYCCNT;
+    elapsedUs += (stamp - lastStamp) / (SystemCoreClock / 1000000);
+    lastStamp = stamp;
+    return elapsedUs;
+}
+
+/*
+ * The steps run on static workers, taken again once their step is done. A
+ * step finding them all busy, or needing more stack, runs in the caller.
+ */
+static constexpr uint32_t BOOT_WORKERS = 4;
+static constexpr uint32_t BOOT_WORKER_STACK = configMINIMAL_STACK_SIZE * 8;
+
+class BootWorker : public StaticThread<BOOT_WORKER_STACK> {
+public:
+    BootWorker(const char *name)
+        : StaticThread(name, osPriorityNormal), start_("boot worker") {}
+
+    /*false if busy with another step*/
+    bool take(void (*entry)(void *), void *argument) {
+        if (busy_)
+            return false;
+        busy_ = true;
+        entry_ = entry;
+        argument_ = argument;
+        if (!started_) {
+            start();
+            started_ = true;
+        }
+        vTaskPrioritySet(static_cast<TaskHandle_t>(getId()),
+                         uxTaskPriorityGet(nullptr));
+        start_.complete();
+        return true;
+    }
+
+protected:
+    void run() override {
+        while (1) {
+            start_.wait();
+            entry_(argument_);
+            busy_ = false;
+        }
+    }
+
+private:
+    Completion start_;
+    void (*entry_)(void *){nullptr};
+    void *argument_{nullptr};
+    volatile bool busy_{false};
+    bool started_{false};
+};
+
+static BootWorker workers[BOOT_WORKERS] = {
+    {"boot_worker_0"}, {"boot_worker_1"}, {"boot_worker_2"}, {"boot_worker_3"}};
+
+static void printUs(const char *label, const BootMilestone &milestone,
+                    uint64_t &before) {
+    auto us = static_cast<uint32_t>(milestone.us);
+    DIAG(BOOT_DIAG "%s %8lu us +%7lu %s", label, us,
+         static_cast<uint32_t>(milestone.us - before), milestone.name);
+    before = milestone.us;
+}
+
+namespace CARBON {
+
+void bootStart() {
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+    lastStamp = DWT->CYCCNT;
+    elapsedUs = 0;
+    clockStarted = false;
+    timeline.start();
+    timeline.mark("low level init", 0);
+}
+
+void bootClockStarted() {
+    auto previous = IRQ::raise();
+    auto us = bootUs();
+    clockOffsetUs = static_cast<int64_t>(us) -
+                    static_cast<int64_t>(systimeUs());
+    clockStarted = true;
+    IRQ::restore(previous);
+}
+
+void bootDump() {
+#ifdef __NEWLIB__
+    DIAG(BOOT_DIAG "Newlib version %d.%d.%d", __NEWLIB__, __NEWLIB_MINOR__,
+         __NEWLIB_PATCHLEVEL__);
+#else
+    DIAG(BOOT_DIAG "glibc version %d.%d", __GLIBC__, __GLIBC_MINOR__);
+#endif
+    DIAG(BOOT_DIAG "HAL version %lu.%lu.%lu.%lu", GET_HAL_VERSION_MAIN,
+         GET_HAL_VERSION_SUB1, GET_HAL_VERSION_SUB2, GET_HAL_VERSION_RC);
+    DIAG(BOOT_DIAG "FreeRTOS version %d.%d.%d", tskKERNEL_VERSION_MAJOR,
+         tskKERNEL_VERSION_MINOR, tskKERNEL_VERSION_BUILD);
+    DIAG(BOOT_DIAG "CMSIS Version %lu.%lu", GET_CMSIS_VERSION_MAIN,
+         GET_CMSIS_VERSION_SUB);
+    DIAG(BOOT_DIAG "LwIP version %d.%d.%d", LWIP_VERSION_MAJOR,
+         LWIP_VERSION_MINOR, LWIP_VERSION_REVISION);
+    DIAG(BOOT_DIAG "Micropython version %d.%d.%d", MICROPY_VERSION_MAJOR,
+         MICROPY_VERSION_MINOR, MICROPY_VERSION_MICRO);
+    DIAG(BOOT_DIAG "FAT File System revision ID %d", _FATFS);
+
+    /*the marks are done, no lock needed*/
+    DIAG(BOOT_DIAG "boot %lu, previous %lu milestones", timeline.boots,
+         timeline.previousCount);
+    uint64_t before = 0;
+    timeline.forEachPrevious([&before](const BootMilestone &milestone) {
+        printUs("previous", milestone, before);
+    });
+    before = 0;
+    timeline.forEach([&before](const BootMilestone &milestone) {
+        printUs("current ", milestone, before);
+    });
+}
+
+uint64_t BootPlatform::nowUs() {
+    auto previous = IRQ::raise();
+    auto us = bootUs();
+    IRQ::restore(previous);
+    return us;
+}
+
+bool BootPlatform::spawn(void (*entry)(void *), void *argument,
+                         const char * /*name*/, uint32_t stackWords) {
+    if (stackWords > BOOT_WORKER_STACK)
+        return false;
+    for (auto &worker : workers) {
+        if (worker.take(entry, argument))
+            return true;
+    }
+    return false;
+}
+
+/*the worker waits for the next step*/
+void BootPlatform::exit() {}
+
+} // namespace CARBON
+
+extern "C" {
+
+void carbon_boot_mark(const char *name) {
+    auto previous = IRQ::raise();
+    timeline.mark(name, bootUs());
+    IRQ::restore(previous);
+}
+}
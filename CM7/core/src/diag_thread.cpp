@@ -19,9 +19,7 @@
 #include <carbon/diag.hpp>
 #include <carbon/diag_thread.hpp>
 
-DiagThread::DiagThread()
-    : Thread("diag_thread", osPriorityBelowNormal,
-             configMINIMAL_STACK_SIZE * 10) {}
+DiagThread::DiagThread() : StaticThread("diag_thread", osPriorityBelowNormal) {}
 
 void DiagThread::run() {
     DIAG(SYSTEM_DIAG "starting pulling thread");
@@ -0,0 +1,104 @@
+/**
+ ******************************************************************************
+ * @file           dma_buffer.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          DMA buffers and cache maintenance by cache line
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/dma_buffer.hpp>
+#include <carbon/heap.hpp>
+
+#include <stm32h7xx_hal.h>
+
+using namespace CARBON;
+
+extern int _sdma_nocache;
+extern int _edma_nocache;
+
+/*the D2 SRAM 2 and 3 regions are set by MPU_Config*/
+static constexpr uintptr_t D2_NOCACHE_START = 0x30020000;
+static constexpr uintptr_t D2_NOCACHE_END = 0x30048000;
+static constexpr uintptr_t ITCM_END = 0x00010000;
+static constexpr uintptr_t DTCM_START = 0x20000000;
+static constexpr uintptr_t DTCM_END = 0x20020000;
+
+/*rounds outward to the touched cache lines*/
+static bool cacheLines(const void *buffer, size_t length, uint32_t *&start,
+                       int32_t &size) {
+    if (length == 0 || !dmaCacheable(buffer))
+        return false;
+    auto address = reinterpret_cast<uintptr_t>(buffer);
+    auto first = address & ~uintptr_t{CACHE_ALIGNMENT - 1};
+    auto end = dmaLines(address + length);
+    start = reinterpret_cast<uint32_t *>(first);
+    size = static_cast<int32_t>(end - first);
+    return true;
+}
+
+namespace CARBON {
+
+bool dmaCacheable(const void *buffer) {
+    auto address = reinterpret_cast<uintptr_t>(buffer);
+    if (address < ITCM_END || (address >= DTCM_START && address < DTCM_END))
+        return false;
+    if (address >= D2_NOCACHE_START && address < D2_NOCACHE_END)
+        return false;
+    return address < reinterpret_cast<uintptr_t>(&_sdma_nocache) ||
+           address >= reinterpret_cast<uintptr_t>(&_edma_nocache);
+}
+
+DmaBuffer DmaBuffer::allocate(size_t size, DmaPool pool) {
+    auto heapClass = pool == DmaPool::NonCacheable ? HeapClass::DmaNoCache
+                                                   : HeapClass::Dma;
+    size = dmaLines(size);
+    auto data = static_cast<uint8_t *>(heapAllocate(heapClass, size));
+    if (data == nullptr)
+        return DmaBuffer{};
+    return DmaBuffer{data, size, pool};
+}
+
+void DmaBuffer::release() {
+    if (data_ != nullptr)
+        heapFree(data_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+} // namespace CARBON
+
+extern "C" {
+
+void carbon_dma_prepare_transmit(const void *buffer, size_t length) {
+    uint32_t *start;
+    int32_t size;
+    if (cacheLines(buffer, length, start, size))
+        SCB_CleanDCache_by_Addr(start, size);
+    else
+        __DSB();
+}
+
+void carbon_dma_prepare_receive(void *buffer, size_t length) {
+    uint32_t *start;
+    int32_t size;
+    if (cacheLines(buffer, length, start, size))
+        SCB_CleanInvalidateDCache_by_Addr(start, size);
+}
+
+void carbon_dma_complete_receive(void *buffer, size_t length) {
+    uint32_t *start;
+    int32_t size;
+    if (cacheLines(buffer, length, start, size))
+        SCB_InvalidateDCache_by_Addr(start, size);
+}
+}
@@ -17,8 +17,11 @@
  */
 
 #include <carbon/common.hpp>
+#include <carbon/completion.hpp>
 #include <carbon/diag.hpp>
+#include <carbon/dma_buffer.hpp>
 #include <carbon/ethernetif.h>
+#include <carbon/mdma_copy.hpp>
 
 #include <lan8742.h>
 
@@ -99,15 +102,17 @@
 
 static Eth_Handle eth_handle;
 
-static osSemaphoreId rxPktSemaphore =
-    NULL; /* Semaphore to signal incoming packets */
-static osSemaphoreId txPktSemaphore =
-    NULL; /* Semaphore to signal outcome packets */
+static CarbonCompletion *rxPktDone = NULL; /* incoming packets */
+static CarbonCompletion *txPktDone = NULL; /* outcome packets */
 static osMutexId rx_ptk_mutex;
 static osMutexId tx_ptk_mutex;
 
 static volatile bool isInitialized = false;
 
+/* the interface thread, started once and never deleted */
+static StackType_t interfaceThreadStack[INTERFACE_THREAD_STACK_SIZE];
+static StaticTask_t interfaceThreadTcb;
+
 /* Ethernet Rx DMA Descriptors */
 ETH_DMADescTypeDef dmaRxDscrTab[ETH_RX_DESC_CNT]
     __attribute__((aligned(32), section(".RxDecripSection")));
@@ -135,6 +140,7 @@ static uint8_t tx_Buff[ETH_RX_BUFFER_SIZE_ALIGNED] __attribute__((aligned(32)));
 struct carbon_pbuf_custom {
     struct pbuf_custom pbuf_custom;
     uint8_t *buffer;
+    uint32_t length; /*written by the DMA*/
 };
 
 LWIP_MEMPOOL_DECLARE(rx_pool, 10, sizeof(struct carbon_pbuf_custom),
@@ -235,17 +241,17 @@ PC5      ------> ETH_RXD1
     }
 }
 
-void carbon_hw_ethernet_isr() {
+CARBON_FAST_CODE void carbon_hw_ethernet_isr() {
     if (__HAL_ETH_DMA_GET_IT(&eth_handle, ETH_DMACSR_RI)) {
         if (__HAL_ETH_DMA_GET_IT_SOURCE(&eth_handle, ETH_DMACIER_RIE)) {
-            osSemaphoreRelease(rxPktSemaphore);
+            carbon_completion_complete(rxPktDone);
             /* Clear the Eth DMA Rx IT pending bits */
             __HAL_ETH_DMA_CLEAR_IT(&eth_handle, ETH_DMACSR_RI | ETH_DMACSR_NIS);
         }
     }
     if (__HAL_ETH_DMA_GET_IT(&eth_handle, ETH_DMACSR_TI)) {
         if (__HAL_ETH_DMA_GET_IT_SOURCE(&eth_handle, ETH_DMACIER_TIE)) {
-            osSemaphoreRelease(txPktSemaphore);
+            carbon_completion_complete(txPktDone);
             /* Clear the Eth DMA Tx IT pending bits */
             __HAL_ETH_DMA_CLEAR_IT(&eth_handle, ETH_DMACSR_TI | ETH_DMACSR_NIS);
         }
@@ -407,13 +413,9 @@ unsigned carbon_hw_ethernet_low_level_init(struct netif *netif) {
     netif->flags |= NETIF_FLAG_BROADCAST;
 #endif /* LWIP_ARP */
 
-    /* create a binary semaphore used for informing ethernetif of frame
-     * reception/sending */
-    rxPktSemaphore = xSemaphoreCreateBinary();
-    txPktSemaphore = xSemaphoreCreateBinary();
-    /*reset the semaphores*/
-    osSemaphoreWait(rxPktSemaphore, 0);
-    osSemaphoreWait(txPktSemaphore, 0);
+    /* completions informing ethernetif of frame reception/sending */
+    rxPktDone = carbon_completion_create("eth rx", CARBON_LATENCY_ETH);
+    txPktDone = carbon_completion_create("eth tx", CARBON_LATENCY_ETH);
 
     osMutexDef(rx_ptk_mutex);
     rx_ptk_mutex = osMutexCreate(osMutex(rx_ptk_mutex));
@@ -421,8 +423,9 @@ unsigned carbon_hw_ethernet_low_level_init(struct netif *netif) {
     tx_ptk_mutex = osMutexCreate(osMutex(tx_ptk_mutex));
 
     /* create the task that handles the ETH_MAC */
-    osThreadDef(EthIf, carbon_lwip_input, osPriorityRealtime, 0,
-                INTERFACE_THREAD_STACK_SIZE);
+    osThreadStaticDef(EthIf, carbon_lwip_input, osPriorityRealtime, 0,
+                      INTERFACE_THREAD_STACK_SIZE, interfaceThreadStack,
+                      &interfaceThreadTcb);
     osThreadCreate(osThread(EthIf), netif);
 
     /* Set PHY IO functions */
@@ -1096,6 +1099,8 @@ u32_t sys_now(void) { return HAL_GetTick(); }
 void pbuf_free_custom(struct pbuf *p) {
     struct carbon_pbuf_custom *custom_pbuf = (struct carbon_pbuf_custom *)p;
     uint32_t buffer = (uint32_t)custom_pbuf->buffer;
+    /*lwIP may have written the frame, no dirty line over the next one*/
+    carbon_dma_prepare_receive(custom_pbuf->buffer, custom_pbuf->length);
     osMutexWait(rx_ptk_mutex, osWaitForever);
     carbon_lwip_prepare_rx_descriptor(buffer);
     osMutexRelease(rx_ptk_mutex);
@@ -1216,7 +1221,7 @@ void carbon_lwip_input(const void *argument) {
     struct netif *netif = (struct netif *)argument;
 
     for (;;) {
-        if (osSemaphoreWait(rxPktSemaphore, osWaitForever) != osOK)
+        if (!carbon_completion_wait(rxPktDone, osWaitForever))
             continue;
         // DIAG(ETH_DIAG "");
         while (1) {
@@ -1307,8 +1312,7 @@ struct pbuf *carbon_lwip_low_level_input(struct netif *netif) {
         return p;
     }
 
-    SCB_InvalidateDCache_by_Addr((uint32_t *)bufferPtr,
-                                 ETH_RX_BUFFER_SIZE_ALIGNED);
+    carbon_dma_complete_receive((void *)bufferPtr, bufferLength);
 
     pbuf_alloced_custom(PBUF_RAW, bufferLength, PBUF_REF,
                         ((struct pbuf_custom *)custom_pbuf),
@@ -1317,6 +1321,7 @@ struct pbuf *carbon_lwip_low_level_input(struct netif *netif) {
     ((struct pbuf_custom *)custom_pbuf)->custom_free_function =
         pbuf_free_custom;
     custom_pbuf->buffer = (uint8_t *)bufferPtr;
+    custom_pbuf->length = bufferLength;
 
     p = (struct pbuf *)custom_pbuf;
 
@@ -1397,14 +1402,16 @@ err_t carbon_lwip_output(struct netif *netif, struct pbuf *p) {
             return ERR_IF;
         }
 
-        memcpy(current_buf_ptr, q->payload, q->len);
+        if (carbon_copy(current_buf_ptr, q->payload, q->len) != 0) {
+            osMutexRelease(tx_ptk_mutex);
+            return ERR_IF;
+        }
 
         current_buf_ptr += q->len;
         size += q->len;
     }
 
-    SCB_CleanDCache_by_Addr((uint32_t *)&tx_Buff[0],
-                            ETH_RX_BUFFER_SIZE_ALIGNED);
+    carbon_dma_prepare_transmit(&tx_Buff[0], total_size);
 
     ETH_DMADescTypeDef *tail_pointer =
         (ETH_DMADescTypeDef *)READ_REG(eth_handle.Instance->DMACTDTPR);
@@ -1438,9 +1445,10 @@ err_t carbon_lwip_output(struct netif *netif, struct pbuf *p) {
     INCREASE_TX_POINTER(tail_pointer);
 
     /*issue a DMA transfer writing the new tail pointer */
+    carbon_completion_reset(txPktDone);
     WRITE_REG(eth_handle.Instance->DMACTDTPR, (uint32_t)tail_pointer);
 
-    if (osSemaphoreWait(txPktSemaphore, ETH_DMA_TRANSMIT_TIMEOUT) != osOK) {
+    if (!carbon_completion_wait(txPktDone, ETH_DMA_TRANSMIT_TIMEOUT)) {
         DIAG(ETH_DIAG "error sending data");
         osMutexRelease(tx_ptk_mutex);
         return ERR_IF;
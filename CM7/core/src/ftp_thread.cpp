@@ -25,8 +25,7 @@ extern "C" {
 #include <ftp.h>
 }
 
-FTPThread::FTPThread()
-    : Thread("ftp_thread", osPriorityNormal, configMINIMAL_STACK_SIZE * 8) {}
+FTPThread::FTPThread() : StaticThread("ftp_thread", osPriorityNormal) {}
 
 void FTPThread::run() {
     DIAG(FTP "starting FTP server");
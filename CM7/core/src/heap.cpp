@@ -0,0 +1,216 @@
+/**
+ ******************************************************************************
+ * @file           heap.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          CM7 heap, placement classes on top of TLSF pools
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/diag.hpp>
+#include <carbon/heap.hpp>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+using namespace CARBON;
+
+extern int _sdram_heap_start;
+extern int _sdram_heap_end;
+
+#define SDRAM_HEAP_REGION_SIZE 0x1400000UL /*"20 MB SDRAM Heap Region"*/
+#define DMA_HEAP_REGION_SIZE 0x8000UL      /*32 KB*/
+#define DMA_NOCACHE_REGION_SIZE 0x8000UL   /*32 KB, see MPU_Config*/
+
+static constexpr size_t FAST_GRANULARITY = portBYTE_ALIGNMENT;
+static constexpr size_t BULK_GRANULARITY = portBYTE_ALIGNMENT;
+static constexpr size_t DMA_GRANULARITY = CACHE_ALIGNMENT;
+
+/*Heap Regions*/
+static uint8_t fastRegion[configTOTAL_HEAP_SIZE]
+    __attribute__((aligned(portBYTE_ALIGNMENT)));
+static uint8_t dmaRegion[DMA_HEAP_REGION_SIZE]
+    __attribute__((aligned(CACHE_ALIGNMENT)));
+static uint8_t dmaNoCacheRegion[DMA_NOCACHE_REGION_SIZE]
+    __attribute__((aligned(DMA_NOCACHE_REGION_SIZE), section(".dma_nocache")));
+#if !SDRAM_TEST
+static uint8_t bulkRegion[SDRAM_HEAP_REGION_SIZE]
+    __attribute__((aligned(32), section(".sdram_bank2_heap")));
+#endif
+
+static const char *const heapNames[] = {"fast", "bulk", "dma", "dma nocache"};
+
+static Tlsf heaps[static_cast<uint32_t>(HeapClass::Count)];
+static bool heapReady[static_cast<uint32_t>(HeapClass::Count)];
+static uint32_t spills;
+
+static HeapPlacement defaultPolicy(size_t) {
+    return HeapPlacement{HeapClass::Fast, false};
+}
+
+static HeapPolicy policy = defaultPolicy;
+
+static Tlsf *heapOf(HeapClass heapClass) {
+    auto index = static_cast<uint32_t>(heapClass);
+    if (index >= static_cast<uint32_t>(HeapClass::Count) || !heapReady[index])
+        return nullptr;
+    return &heaps[index];
+}
+
+static void *allocateLocked(HeapClass heapClass, size_t size) {
+    auto heap = heapOf(heapClass);
+    return heap != nullptr ? heap->allocate(size) : nullptr;
+}
+
+namespace CARBON {
+
+void heapInit() {
+    heapReady[static_cast<uint32_t>(HeapClass::Fast)] =
+        heaps[static_cast<uint32_t>(HeapClass::Fast)].init(
+            fastRegion, sizeof(fastRegion), FAST_GRANULARITY);
+    heapReady[static_cast<uint32_t>(HeapClass::Dma)] =
+        heaps[static_cast<uint32_t>(HeapClass::Dma)].init(
+            dmaRegion, sizeof(dmaRegion), DMA_GRANULARITY);
+    heapReady[static_cast<uint32_t>(HeapClass::DmaNoCache)] =
+        heaps[static_cast<uint32_t>(HeapClass::DmaNoCache)].init(
+            dmaNoCacheRegion, sizeof(dmaNoCacheRegion), DMA_GRANULARITY);
+
+    RAW_DIAG(SYSTEM_DIAG "AXI RAM Heap %p, size %u bytes", fastRegion,
+             sizeof(fastRegion));
+    RAW_DIAG(SYSTEM_DIAG "DMA Heap %p, size %u bytes", dmaRegion,
+             sizeof(dmaRegion));
+    RAW_DIAG(SYSTEM_DIAG "DMA not cacheable Heap %p, size %u bytes",
+             dmaNoCacheRegion, sizeof(dmaNoCacheRegion));
+
+#if !SDRAM_TEST
+    auto sdramHeapSize = static_cast<unsigned>(
+        reinterpret_cast<uintptr_t>(&_sdram_heap_end) -
+        reinterpret_cast<uintptr_t>(&_sdram_heap_start));
+
+    RAW_DIAG(SYSTEM_DIAG "SDRAM Heap %p, size %u bytes", bulkRegion,
+             sdramHeapSize);
+
+    if (sdramHeapSize != SDRAM_HEAP_REGION_SIZE) {
+        RAW_DIAG(SYSTEM_DIAG "ERROR SDRAM Heap is %u Byte", sdramHeapSize);
+        while (1) {
+        };
+    }
+
+    heapReady[static_cast<uint32_t>(HeapClass::Bulk)] =
+        heaps[static_cast<uint32_t>(HeapClass::Bulk)].init(
+            bulkRegion, sizeof(bulkRegion), BULK_GRANULARITY);
+#endif
+}
+
+void heapSetPolicy(HeapPolicy newPolicy) {
+    vTaskSuspendAll();
+    policy = newPolicy != nullptr ? newPolicy : defaultPolicy;
+    xTaskResumeAll();
+}
+
+void *heapAllocate(HeapClass heapClass, size_t size) {
+    vTaskSuspendAll();
+    auto pointer = allocateLocked(heapClass, size);
+    traceMALLOC(pointer, size);
+    xTaskResumeAll();
+    return pointer;
+}
+
+void heapFree(void *pointer) {
+    if (pointer == nullptr)
+        return;
+    vTaskSuspendAll();
+    for (auto &heap : heaps) {
+        if (heap.contains(pointer)) {
+            traceFREE(pointer, heap.usableSize(pointer));
+            heap.free(pointer);
+            break;
+        }
+    }
+    xTaskResumeAll();
+}
+
+bool heapStats(HeapClass heapClass, TlsfStats &stats) {
+    vTaskSuspendAll();
+    auto heap = heapOf(heapClass);
+    if (heap != nullptr)
+        stats = heap->stats();
+    xTaskResumeAll();
+    return heap != nullptr;
+}
+
+uint32_t heapSpills() { return spills; }
+
+void heapReport() {
+    for (uint32_t i = 0; i < static_cast<uint32_t>(HeapClass::Count); i++) {
+        TlsfStats stats;
+        if (!heapStats(static_cast<HeapClass>(i), stats))
+            continue;
+        DIAG(SYSTEM_DIAG "heap %s: used %u, high water %u of %u, largest free "
+                         "%u, fragmentation %lu%%, failures %lu",
+             heapNames[i], static_cast<unsigned>(stats.usedBytes),
+             static_cast<unsigned>(stats.highWaterBytes),
+             static_cast<unsigned>(stats.totalBytes),
+             static_cast<unsigned>(stats.largestFreeBytes),
+             stats.fragmentation, stats.failures);
+    }
+    DIAG(SYSTEM_DIAG "heap spills %lu", spills);
+}
+
+} // namespace CARBON
+
+extern "C" {
+
+void *carbon_heap_malloc(carbon_heap_class heapClass, size_t size) {
+    return heapAllocate(static_cast<HeapClass>(heapClass), size);
+}
+
+void carbon_heap_free(void *pointer) { heapFree(pointer); }
+
+/***** FreeRTOS heap *****/
+
+void *pvPortMalloc(size_t xWantedSize) {
+    vTaskSuspendAll();
+    auto placement = policy(xWantedSize);
+    auto pointer = allocateLocked(placement.heapClass, xWantedSize);
+    if (pointer == nullptr && placement.spill &&
+        placement.heapClass != HeapClass::Bulk) {
+        pointer = allocateLocked(HeapClass::Bulk, xWantedSize);
+        if (pointer != nullptr)
+            spills++;
+    }
+    traceMALLOC(pointer, xWantedSize);
+    xTaskResumeAll();
+
+#if (configUSE_MALLOC_FAILED_HOOK == 1)
+    if (pointer == nullptr) {
+        extern void vApplicationMallocFailedHook(void);
+        vApplicationMallocFailedHook();
+    }
+#endif
+    return pointer;
+}
+
+void vPortFree(void *pv) { heapFree(pv); }
+
+size_t xPortGetFreeHeapSize(void) {
+    TlsfStats stats{};
+    heapStats(HeapClass::Fast, stats);
+    return stats.totalBytes - stats.usedBytes;
+}
+
+size_t xPortGetMinimumEverFreeHeapSize(void) {
+    TlsfStats stats{};
+    heapStats(HeapClass::Fast, stats);
+    return stats.totalBytes - stats.highWaterBytes;
+}
+}
@@ -16,7 +16,10 @@
  */
 
 /* Includes ------------------------------------------------------------------*/
+#include <carbon/common.hpp>
+#include <carbon/completion.hpp>
 #include <carbon/diag.hpp>
+#include <carbon/latency.hpp>
 #include <carbon/sd_card.hpp>
 
 #include <stm32h7xx_hal.h>
@@ -31,6 +34,7 @@ void carbon_hw_us_pin_detect_tim_isr(void);
 void carbon_hw_matrix_display_spi_isr(void);
 void carbon_hw_matrix_display_dma_isr(void);
 void carbon_hw_ethernet_isr(void);
+void carbon_mdma_isr(void);
 void hsem_isr(void);
 
 #include <backtrace.h>
@@ -223,7 +227,7 @@ void DebugMon_Handler(void) {}
 /**
  * @brief This function handles System tick timer.
  */
-void SysTick_Handler(void) { osSystickHandler(); }
+CARBON_FAST_CODE void SysTick_Handler(void) { osSystickHandler(); }
 
 /**
  * @brief This function handles FMC IRQ.
@@ -234,7 +238,11 @@ void FMC_IRQHandler(void) { fmc_isr(); }
  * @brief This function handles TIM2.
  */
 
-void TIM2_IRQHandler(void) { carbon_hw_us_systime_tim_isr(); }
+CARBON_FAST_CODE void TIM2_IRQHandler(void) {
+    uint32_t stamp = carbon_latency_enter(CARBON_LATENCY_SYSTIME);
+    carbon_hw_us_systime_tim_isr();
+    carbon_latency_exit(CARBON_LATENCY_SYSTIME, stamp);
+}
 
 /**
  * @brief This function handles TIM3.
@@ -252,14 +260,22 @@ void HSEM1_IRQHandler(void) { hsem_isr(); }
  * @brief This function handles Ethernet.
  */
 #if !defined FIFO_TEST && !defined HSEM_TEST && !defined SDRAM_TEST
-void ETH_IRQHandler(void) { carbon_hw_ethernet_isr(); }
+CARBON_FAST_CODE void ETH_IRQHandler(void) {
+    uint32_t stamp = carbon_latency_enter(CARBON_LATENCY_ETH);
+    carbon_hw_ethernet_isr();
+    carbon_latency_exit(CARBON_LATENCY_ETH, stamp);
+}
 #endif
 
 /**
  * @brief This function handles SDMMC1
  */
 
-void SDMMC1_IRQHandler(void) { BSP_SD_IRQHandler(0); }
+CARBON_FAST_CODE void SDMMC1_IRQHandler(void) {
+    uint32_t stamp = carbon_latency_enter(CARBON_LATENCY_SDMMC);
+    BSP_SD_IRQHandler(0);
+    carbon_latency_exit(CARBON_LATENCY_SDMMC, stamp);
+}
 
 /**
  * @brief This function handles EXTI9_5
@@ -270,9 +286,28 @@ void EXTI9_5_IRQHandler(void) { HAL_EXTI_IRQHandler(&hsd_exti[0]); }
 /**
  * @brief This function handles DMA1 stream0 global interrupt.
  */
-void DMA1_Stream0_IRQHandler(void) { carbon_hw_matrix_display_dma_isr(); }
+void DMA1_Stream0_IRQHandler(void) {
+    uint32_t stamp = carbon_latency_enter(CARBON_LATENCY_SPI2);
+    carbon_hw_matrix_display_dma_isr();
+    carbon_latency_exit(CARBON_LATENCY_SPI2, stamp);
+}
 
 /**
  * @brief This function handles SPI2 global interrupt.
  */
-void SPI2_IRQHandler(void) { carbon_hw_matrix_display_spi_isr(); }
+void SPI2_IRQHandler(void) {
+    uint32_t stamp = carbon_latency_enter(CARBON_LATENCY_SPI2);
+    carbon_hw_matrix_display_spi_isr();
+    carbon_latency_exit(CARBON_LATENCY_SPI2, stamp);
+}
+
+/**
+ * @brief This function handles MDMA global interrupt.
+ */
+void MDMA_IRQHandler(void) { carbon_mdma_isr(); }
+
+/**
+ * @brief Clock recovery system interrupt, unused: software triggered by the
+ * completion benchmark.
+ */
+void CRS_IRQHandler(void) { carbon_completion_benchmark_isr(); }
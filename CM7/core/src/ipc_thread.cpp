@@ -0,0 +1,50 @@
+/**
+ ******************************************************************************
+ * @file           ipc_thread.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          receives the messages of the CM4 and completes the offload jobs
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/diag.hpp>
+#include <carbon/ipc.hpp>
+#include <carbon/ipc_thread.hpp>
+
+using namespace CARBON;
+
+static constexpr uint32_t BATCH = 4;
+static constexpr uint32_t WAIT_MS = 1000;
+
+IPCThread::IPCThread() : StaticThread("ipc_thread", osPriorityAboveNormal) {}
+
+void IPCThread::run() {
+    auto &mailbox = coreMailbox();
+    auto &offload = offloadClient();
+    MailboxMessage messages[BATCH];
+
+    while (1) {
+        auto n = mailbox.receiveBatch(messages, BATCH);
+        if (n == 0) {
+            if (!mailbox.receive(messages[0], WAIT_MS))
+                continue;
+            n = 1;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            if (offload.complete(messages[i]))
+                continue;
+            if (!mailboxHandleSystem(messages[i]))
+                DIAG(SYSTEM_DIAG "unknown message %u from CM4",
+                     messages[i].type);
+        }
+    }
+}
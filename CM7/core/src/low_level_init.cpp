@@ -15,37 +15,26 @@
  *
  ******************************************************************************
  */
+#include <carbon/boot.hpp>
 #include <carbon/error.hpp>
+#include <carbon/heap.hpp>
 #include <carbon/hsem.hpp>
+#include <carbon/ipc.hpp>
+#include <carbon/mdma_copy.hpp>
 #include <carbon/pin.hpp>
 #include <carbon/rand.hpp>
+#include <carbon/registry.hpp>
 #include <carbon/sd_card.hpp>
 #include <carbon/sdram.hpp>
 #include <carbon/shared_memory.hpp>
 #include <carbon/systime.hpp>
+#include <carbon/timebase.hpp>
 #include <carbon/uart.hpp>
 
 #include <stm32h7xx_hal.h>
 
 #include <printf.h>
 
-#include <py/mpconfig.h> /*only to retrieve the version*/
-
-#include <lwip/init.h> /*only to retrieve the version*/
-
-#include <ff.h> /*only to retrieve the version*/
-
-#include <FreeRTOS.h>
-#include <task.h>
-
-#define GET_HAL_VERSION_MAIN ((HAL_GetHalVersion() >> 24) & 0xFFUL)
-#define GET_HAL_VERSION_SUB1 ((HAL_GetHalVersion() >> 16) & 0xFFUL)
-#define GET_HAL_VERSION_SUB2 ((HAL_GetHalVersion() >> 8) & 0xFFUL)
-#define GET_HAL_VERSION_RC (HAL_GetHalVersion() & 0xFFUL)
-
-#define GET_CMSIS_VERSION_MAIN ((osCMSIS >> 16) & 0xFFUL)
-#define GET_CMSIS_VERSION_SUB (osCMSIS & 0xFFUL)
-
 using namespace CARBON;
 
 extern "C" {
@@ -55,31 +44,15 @@ void putchar_(char ch);
 static void SystemClock_Config(void);
 
 extern int __bss_end__;
-extern int _sdram_heap_start;
-extern int _sdram_heap_end;
-
-#define SDRAM_HEAP_REGION_SIZE 0x1400000UL /*"20 MB SDRAM Heap Region"*/
-
-#if SDRAM_TEST
-uint8_t AXI_RAM_Heap_Region[configTOTAL_HEAP_SIZE] __attribute__((aligned(4)));
-static const HeapRegion_t xHeapRegions[] = {
-    {(uint8_t *)&AXI_RAM_Heap_Region[0], configTOTAL_HEAP_SIZE},
-    {NULL, 0} /* Terminates the array. */
-};
-#else
-/*Heap Regions*/
-uint8_t AXI_RAM_Heap_Region[configTOTAL_HEAP_SIZE] __attribute__((aligned(4)));
-size_t SD_RAM_Heap_Region_Size = SDRAM_HEAP_REGION_SIZE;
-uint8_t SD_RAM_Heap_Region[SDRAM_HEAP_REGION_SIZE]
-    __attribute__((aligned(32), section(".sdram_bank2_heap")));
-static const HeapRegion_t xHeapRegions[] = {
-    {(uint8_t *)&AXI_RAM_Heap_Region[0], configTOTAL_HEAP_SIZE},
-    {(uint8_t *)&SD_RAM_Heap_Region[0], SDRAM_HEAP_REGION_SIZE},
-    {NULL, 0} /* Terminates the array. */
-};
-#endif
 
+/*
+ * Serial by nature: the handshake with the CM4 and the clocks come first.
+ * The milestones are recorded in the boot timeline, printed by bootDump()
+ * once the diag thread runs instead of waiting here for the UART.
+ */
 void low_level_init() {
+    bootStart();
+
     int32_t timeout;
     /* Wait until CPU2 boots and enters in stop mode or timeout*/
     timeout = 0xFFFF;
@@ -90,6 +63,8 @@ void low_level_init() {
         Error_Handler();
     }
 
+    bootMark("CM4 stopped");
+
     /* activate cache */
     SCB_EnableICache();
 
@@ -98,9 +73,13 @@ void low_level_init() {
     /* HAL low level init */
     HAL_Init();
 
+    bootMark("HAL");
+
     /* Configure the system clock */
     SystemClock_Config();
 
+    bootMark("clock");
+
     /* When system initialization is finished, Cortex-M7 will release Cortex-M4
      * by means of HSEM notification */
     /*init hardware semaphore*/
@@ -117,56 +96,33 @@ void low_level_init() {
         Error_Handler();
     }
 
+    bootMark("CM4 released");
+
     /* init timer */
     low_level_system_time();
 
+    bootClockStarted();
+
     /* init DIAG*/
     init_uart();
 
     printf_("\r\n\nBooting\r\n");
 
-    printf_("Newlib version %d.%d.%d\r\n", __NEWLIB__, __NEWLIB_MINOR__,
-            __NEWLIB_PATCHLEVEL__);
-    printf_("HAL version %lu.%lu.%lu.%lu\r\n", GET_HAL_VERSION_MAIN,
-            GET_HAL_VERSION_SUB1, GET_HAL_VERSION_SUB2, GET_HAL_VERSION_RC);
-    printf_("FreeRTOS version %d.%d.%d\r\n", tskKERNEL_VERSION_MAJOR,
-            tskKERNEL_VERSION_MINOR, tskKERNEL_VERSION_BUILD);
-    printf_("CMSIS Version %lu.%lu\r\n", GET_CMSIS_VERSION_MAIN,
-            GET_CMSIS_VERSION_SUB);
-    printf_("LwIP version %d.%d.%d\r\n", LWIP_VERSION_MAJOR, LWIP_VERSION_MINOR,
-            LWIP_VERSION_REVISION);
-    printf_("Micropython version %d.%d.%d\r\n", MICROPY_VERSION_MAJOR,
-            MICROPY_VERSION_MINOR, MICROPY_VERSION_MICRO);
-    printf_("FAT File System revision ID %d\r\n", _FATFS);
-
     /* init SDRAM */
     init_sdram();
 
-    RAW_DIAG(SYSTEM_DIAG "SD RAM initialized");
+    bootMark("SD RAM");
 #if SDRAM_TEST
 #else
-    /*Init Heap*/
-    vPortDefineHeapRegions(xHeapRegions);
-
-    RAW_DIAG(SYSTEM_DIAG "AXI RAM Heap %p, size %u bytes",
-             &AXI_RAM_Heap_Region[0], configTOTAL_HEAP_SIZE);
-    RAW_DIAG(SYSTEM_DIAG "SDRAM Heap %p, size %u bytes", SD_RAM_Heap_Region,
-             (unsigned)&_sdram_heap_end - (unsigned)&_sdram_heap_start);
-
-    if (((unsigned)&_sdram_heap_end - (unsigned)&_sdram_heap_start) !=
-        SDRAM_HEAP_REGION_SIZE) {
-        RAW_DIAG(SYSTEM_DIAG "ERROR SDRAM Heap is %u Byte",
-                 (unsigned)&_sdram_heap_end - (unsigned)&_sdram_heap_start);
-        while (1) {
-        };
-    }
+    /*Init Heap, fast, bulk and DMA classes*/
+    heapInit();
 
-    RAW_DIAG(SYSTEM_DIAG "Heap initialized");
+    bootMark("heap");
 #endif
     /* true random generator init */
     carbon_rand_init();
 
-    RAW_DIAG(SYSTEM_DIAG "Random generator initialized");
+    bootMark("random");
 
     /* Initialize Pin needed by CM7 */
     BSP_LED_Init(LED_GREEN);
@@ -176,29 +132,46 @@ void low_level_init() {
     BSP_LED_Init(LED_BLUE);
     BSP_LED_Init(LED_RED);
 
-    RAW_DIAG(SYSTEM_DIAG "LED pins initialized");
+    bootMark("LED pins");
 
     /*init fifos*/
 
     /*DIAG FIFO*/
     FIFO_INIT(diag)
 
-    RAW_DIAG(SYSTEM_DIAG "Diag FIFO initialized");
+    bootMark("diag FIFO");
 
 #ifdef FREERTOS_USE_TRACE
     /*DIAG TRACE*/
     FIFO_INIT(trace)
 
-    RAW_DIAG(SYSTEM_DIAG "Trace FIFO initialized");
+    bootMark("trace FIFO");
 #endif
 
+    /*cross core time base, the CM4 time is sampled later*/
+    timebaseInit();
+
+    bootMark("time base");
+
+    mailboxInit();
+
+    bootMark("mailbox");
+
+    registryInit();
+
+    bootMark("registry");
+
+    copyInit();
+
+    bootMark("MDMA copy");
+
     if (BSP_SD_DetectITConfig(0) < 0) {
         RAW_DIAG(SYSTEM_DIAG "SD detection not set");
     } else {
-        RAW_DIAG(SYSTEM_DIAG "SD detection set");
+        bootMark("SD detection");
     }
 
-    RAW_DIAG(SYSTEM_DIAG "Initialization complete, synchronizing with CM4");
+    bootMark("periphery sync");
 
     setSyncFlag(SyncFlagBit::PeripherySync);
 }
@@ -16,14 +16,21 @@
  ******************************************************************************
  */
 
+#include <carbon/boot.hpp>
+#include <carbon/completion.hpp>
 #include <carbon/diag_thread.hpp>
 #include <carbon/display_matrix_spi.hpp>
 #include <carbon/ftp_thread.hpp>
+#include <carbon/ipc.hpp>
+#include <carbon/ipc_thread.hpp>
+#include <carbon/latency.hpp>
 #include <carbon/main_thread.hpp>
 #include <carbon/mp_thread.h>
+#include <carbon/net_bench_thread.hpp>
 #include <carbon/pin.hpp>
+#include <carbon/sd_card.hpp>
 #include <carbon/sd_thread.hpp>
-#include <carbon/tcp_test_thread.hpp>
+#include <carbon/timebase.hpp>
 #include <carbon/trace_thread.hpp>
 
 #include <cmsis_os.h>
@@ -40,24 +47,23 @@ static TraceThread traceThread;
 #endif
 static SDThread sdThread;
 static FTPThread ftpThread;
-static TCPTestThread tcpTestThread;
+static NetBenchThread netBenchThread;
+/*no DMA from its stack, kept in DTCM*/
+CARBON_FAST_BSS static IPCThread ipcThread;
+
+static const char offloadCheck[] = "123456789";
+static constexpr uint32_t OFFLOAD_CHECK_CRC = 0xCBF43926;
+static constexpr uint32_t STACK_REPORT_PERIOD = 60; /*main loop periods*/
+static constexpr uint32_t SD_MOUNT_TIMEOUT = 3000; /*ms*/
+/*tcpip_init and the PHY, the FatFs file object*/
+static constexpr uint32_t NETWORK_STACK = configMINIMAL_STACK_SIZE * 8;
+static constexpr uint32_t SCRIPT_STACK = configMINIMAL_STACK_SIZE * 8;
 
 extern "C" {
 void netif_config(void);
-void start_micropython();
 }
 
-MainThread::MainThread()
-    : Thread("main_thread", osPriorityNormal, configMINIMAL_STACK_SIZE * 10) {}
-
-void MainThread::run() {
-    diagThread.start();
-
-    netif_config();
-#ifdef FREERTOS_USE_TRACE
-    traceThread.start();
-#endif
-
+static void startDisplay() {
     /*init matrix display spi*/
     if (getDisplayMatrixSpi().init()) {
         Error_Handler();
@@ -70,18 +76,86 @@ void MainThread::run() {
     if (getDisplayMatrixSpi().DMATransmit(&buffer3, 1))
         DIAG(SYSTEM_DIAG "error transmitting the data");
 #endif
+}
+
+static void startSD() {
     sdThread.start();
+    /*without a card the services start anyway, the mount comes later*/
+    if (BSP_SD_IsDetected(0) != SD_PRESENT) {
+        DIAG(SYSTEM_DIAG "no SD card, not waiting for the mount");
+        return;
+    }
+    if (!sdThread.waitMounted(SD_MOUNT_TIMEOUT))
+        DIAG(SYSTEM_DIAG "SD card not mounted in %lu ms", SD_MOUNT_TIMEOUT);
+}
 
-    osDelay(200);
+MainThread::MainThread() : StaticThread("main_thread", osPriorityNormal) {}
 
-    start_micropython();
+void MainThread::run() {
+    diagThread.start();
+
+    /*independent subsystems come up together, the services after them*/
+    static CARBON::BootScheduler scheduler;
+    auto network = scheduler.add("network", netif_config, 0, NETWORK_STACK);
+    scheduler.add("display", startDisplay);
+    auto sd = scheduler.add("sd", startSD);
+    auto micropython = scheduler.add("micropython", micropython_init);
+#ifdef FREERTOS_USE_TRACE
+    scheduler.add("trace", [] { traceThread.start(); }, network);
+#endif
+    scheduler.add("ftp", [] { ftpThread.start(); }, network | sd);
+    scheduler.add("netbench", [] { netBenchThread.start(); }, network);
+    scheduler.add("script", micropython_run, network | sd | micropython,
+                  SCRIPT_STACK);
+    scheduler.run();
+
+    CARBON::bootMark("ready");
+    CARBON::bootDump();
+    for (uint32_t i = 0; i < scheduler.steps(); i++) {
+        auto timing = scheduler.timing(i);
+        DIAG(BOOT_DIAG "step %s %lu us to %lu us", timing.name,
+             static_cast<uint32_t>(timing.startUs),
+             static_cast<uint32_t>(timing.endUs));
+    }
+
+    uint32_t roundTripUs;
+    if (CARBON::mailboxPing(roundTripUs, 100)) {
+        DIAG(SYSTEM_DIAG "CM4 mailbox round trip %lu us", roundTripUs);
+    } else {
+        DIAG(SYSTEM_DIAG "CM4 mailbox not responding");
+    }
 
-    ftpThread.start();
+    /*from now on the messages of the CM4 are received by the ipc thread*/
+    ipcThread.start();
 
-    // tcpTestThread.start();
+    CARBON::OffloadJob job{};
+    job.function = CARBON::OffloadFunction::Crc32;
+    job.input = reinterpret_cast<uintptr_t>(offloadCheck);
+    job.inputLength = sizeof(offloadCheck) - 1;
+    CARBON::offloadClient().submit(
+        job, [](const CARBON::OffloadJob &, const CARBON::OffloadResult &result) {
+            DIAG(SYSTEM_DIAG "CM4 offload check %s, %lu us",
+                 result.value == OFFLOAD_CHECK_CRC ? "ok" : "failed",
+                 static_cast<uint32_t>(result.endUs - result.startUs));
+        });
 
+
+    uint32_t loops = 0;
     while (1) {
         BSP_LED_Toggle(LED_GREEN);
+        CARBON::timebasePublish();
+#ifdef FREERTOS_USE_TRACE
+        CARBON::latencyPublish();
+#endif
+        if (++loops % STACK_REPORT_PERIOD == 0) {
+            StaticThreadBase::report();
+            auto masked = CARBON::IRQ::getMaskStats();
+            DIAG(SYSTEM_DIAG "longest masked window %lu cycles at %p, %lu "
+                             "critical sections",
+                 masked.maxCycles, reinterpret_cast<void *>(masked.maxSite),
+                 masked.sections);
+            CARBON::Completion::report();
+        }
         osDelay(1000);
     }
 }
@@ -16,7 +16,9 @@
  ******************************************************************************
  */
 
+#include <carbon/completion.hpp>
 #include <carbon/display_matrix_spi.hpp>
+#include <carbon/dma_buffer.hpp>
 
 #define SPI2_SCK_Pin GPIO_PIN_12
 #define SPI2_SCK_GPIO_Port GPIOA
@@ -27,10 +29,8 @@
 #define Latch_Pin GPIO_PIN_14
 #define Latch_GPIO_Port GPIOB
 
-osSemaphoreDef(SEM_SPI2_TX_DEF);
-static osSemaphoreId SEM_SPI2_TX;
-osSemaphoreDef(SEM_SPI2_RX_DEF);
-static osSemaphoreId SEM_SPI2_RX;
+static CARBON::Completion spi2TxDone("spi2 tx", CARBON_LATENCY_SPI2);
+static CARBON::Completion spi2RxDone("spi2 rx", CARBON_LATENCY_SPI2);
 extern "C" {
 static void voidCallback(SPI_HandleTypeDef * /*spiHandle*/);
 
@@ -89,19 +89,15 @@ public:
         HAL_SPI_RegisterCallback(&hspi2, HAL_SPI_ERROR_CB_ID, voidCallback);
         HAL_SPI_RegisterCallback(&hspi2, HAL_SPI_ABORT_CB_ID, voidCallback);
 
-        SEM_SPI2_TX = osSemaphoreCreate(osSemaphore(SEM_SPI2_TX_DEF), 1);
-        SEM_SPI2_RX = osSemaphoreCreate(osSemaphore(SEM_SPI2_RX_DEF), 1);
-
-        osSemaphoreWait(SEM_SPI2_TX, 0);
-        osSemaphoreWait(SEM_SPI2_RX, 0);
-
         DIAG(MATRIX_DIS_DIAG "dispaly matrix spi initialized");
         return Success;
     }
 
     Error DMATransmit(void *buffer, uint16_t bufferSize) override {
-        __DSB();
+        /*32 bit frames*/
+        CARBON::dmaPrepareTransmit(buffer, bufferSize * sizeof(uint32_t));
         Error error = Success;
+        spi2TxDone.reset();
         auto res = HAL_SPI_Transmit_DMA(
             &hspi2, reinterpret_cast<uint8_t *>(buffer), bufferSize);
         if (res != 0) {
@@ -111,7 +107,7 @@ public:
                  HAL_DMA_GetError(&hdma_spi2_tx));
             return InternalHardwareError;
         }
-        if (!error && osSemaphoreWait(SEM_SPI2_TX, timeout) != osOK) {
+        if (!error && !spi2TxDone.wait(timeout)) {
             DIAG(SPI_DIAG "time out waiting TX DMA");
             error = InternalHardwareError;
         }
@@ -199,9 +195,9 @@ void voidCallback(SPI_HandleTypeDef * /*spiHandle*/) {}
 void carbon_hw_matrix_display_dma_isr() { HAL_DMA_IRQHandler(&hdma_spi2_tx); }
 void carbon_hw_matrix_display_spi_isr() { HAL_SPI_IRQHandler(&hspi2); }
 void carbon_hw_spi_tx_callback(SPI_HandleTypeDef * /*spiHandle*/) {
-    osSemaphoreRelease(SEM_SPI2_TX);
+    spi2TxDone.complete();
 }
 void carbon_hw_spi_rx_callback(SPI_HandleTypeDef * /*spiHandle*/) {
-    osSemaphoreRelease(SEM_SPI2_RX);
+    spi2RxDone.complete();
 }
 }
\ No newline at end of file
@@ -0,0 +1,244 @@
+/**
+ ******************************************************************************
+ * @file           mdma_copy.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          memory copies by the MDMA, CPU below the threshold
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/diag.hpp>
+#include <carbon/dma_buffer.hpp>
+#include <carbon/heap.hpp>
+#include <carbon/mdma_copy.hpp>
+#include <carbon/systime.hpp>
+
+#include <cmsis_os.h>
+
+#include <cstring>
+
+using namespace CARBON;
+
+#define MDMA_IRQ_PRIORITY 5
+
+/*
+ * Maintenance of the whole data cache is 512 set/way operations, by address
+ * it is one per line: above this length the whole cache is cheaper.
+ */
+static constexpr size_t WHOLE_CACHE_LENGTH = 32 * 1024;
+
+static MdmaEngine engine;
+static CoreCopyService service(engine, COPY_THRESHOLD);
+
+namespace CARBON {
+
+void MdmaEngine::init() {
+    __HAL_RCC_MDMA_CLK_ENABLE();
+
+    handle_.Instance = MDMA_Channel0;
+    handle_.Parent = this;
+    handle_.XferCpltCallback = transferComplete;
+    handle_.XferErrorCallback = transferError;
+
+    HAL_NVIC_SetPriority(MDMA_IRQn, MDMA_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(MDMA_IRQn);
+}
+
+void MdmaEngine::start(void *dst, const void *src, size_t length) {
+    auto source = reinterpret_cast<uint32_t>(src);
+    auto destination = reinterpret_cast<uint32_t>(dst);
+
+    /*the destination is whole cache lines, the source is packed if needed*/
+    bool words = (source & 3) == 0;
+    auto &init = handle_.Init;
+    init.Request = MDMA_REQUEST_SW;
+    init.TransferTriggerMode = MDMA_FULL_TRANSFER;
+    init.Priority = MDMA_PRIORITY_MEDIUM;
+    init.Endianness = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+    init.SourceInc = words ? MDMA_SRC_INC_WORD : MDMA_SRC_INC_BYTE;
+    init.DestinationInc = MDMA_DEST_INC_WORD;
+    init.SourceDataSize =
+        words ? MDMA_SRC_DATASIZE_WORD : MDMA_SRC_DATASIZE_BYTE;
+    init.DestDataSize = MDMA_DEST_DATASIZE_WORD;
+    init.DataAlignment = MDMA_DATAALIGN_PACKENABLE;
+    init.BufferTransferLength = 128;
+    init.SourceBurst =
+        words ? MDMA_SOURCE_BURST_16BEATS : MDMA_SOURCE_BURST_64BEATS;
+    init.DestBurst = MDMA_DEST_BURST_16BEATS;
+    init.SourceBlockAddressOffset = 0;
+    init.DestBlockAddressOffset = 0;
+
+    bool ok = HAL_MDMA_Init(&handle_) == HAL_OK;
+
+    auto first = length < MAX_BLOCK ? length : MAX_BLOCK;
+    MDMA_LinkNodeConfTypeDef config{};
+    config.Init = init;
+    config.BlockCount = 1;
+    uint32_t nodes = 0;
+    for (size_t done = first; ok && done < length; done += MAX_BLOCK) {
+        config.SrcAddress = source + done;
+        config.DstAddress = destination + done;
+        config.BlockDataLength =
+            length - done < MAX_BLOCK ? length - done : MAX_BLOCK;
+        auto node = &nodes_[nodes++];
+        ok = HAL_MDMA_LinkedList_CreateNode(node, &config) == HAL_OK &&
+             HAL_MDMA_LinkedList_AddNode(&handle_, node, nullptr) == HAL_OK;
+    }
+    if (nodes > 0)
+        dmaPrepareTransmit(nodes_, nodes * sizeof(nodes_[0]));
+
+    ok = ok && HAL_MDMA_Start_IT(&handle_, source, destination, first, 1) ==
+                   HAL_OK;
+    if (!ok) {
+        /*reported by the interrupt, the service holds its lock*/
+        startFailed_ = true;
+        NVIC_SetPendingIRQ(MDMA_IRQn);
+    }
+}
+
+void MdmaEngine::isr() {
+    if (startFailed_) {
+        startFailed_ = false;
+        handler_(false);
+        return;
+    }
+    HAL_MDMA_IRQHandler(&handle_);
+}
+
+void MdmaEngine::transferComplete(MDMA_HandleTypeDef *handle) {
+    static_cast<MdmaEngine *>(handle->Parent)->handler_(true);
+}
+
+void MdmaEngine::transferError(MDMA_HandleTypeDef *handle) {
+    DIAG(SYSTEM_DIAG "MDMA error 0x%lx", handle->ErrorCode);
+    static_cast<MdmaEngine *>(handle->Parent)->handler_(false);
+}
+
+void CopyPlatform::cpuCopy(void *dst, const void *src, size_t length) {
+    std::memcpy(dst, src, length);
+}
+
+void CopyPlatform::prepareSource(const void *src, size_t length) {
+    if (length >= WHOLE_CACHE_LENGTH)
+        SCB_CleanDCache();
+    else
+        dmaPrepareTransmit(src, length);
+}
+
+void CopyPlatform::prepareDestination(void *dst, size_t length) {
+    if (length >= WHOLE_CACHE_LENGTH)
+        SCB_CleanInvalidateDCache();
+    else
+        dmaPrepareReceive(dst, length);
+}
+
+/*the lines of the destination are clean, nothing is lost with the others*/
+void CopyPlatform::completeDestination(void *dst, size_t length) {
+    if (length >= WHOLE_CACHE_LENGTH)
+        SCB_CleanInvalidateDCache();
+    else
+        dmaCompleteReceive(dst, length);
+}
+
+void copyInit() { engine.init(); }
+
+CoreCopyService &copyService() { return service; }
+
+CopyStatus copy(void *dst, const void *src, size_t length) {
+    ASSERT(!IRQ::isInIRQ());
+
+    struct Waiter {
+        TaskHandle_t task;
+        volatile bool done;
+        CopyStatus status;
+    };
+    Waiter waiter{xTaskGetCurrentTaskHandle(), false, CopyStatus::Done};
+    auto pointer = &waiter;
+
+    /*the CPU copies complete in this task, nothing to wake up*/
+    bool offloaded =
+        service.copyAsync(dst, src, length, [pointer](CopyStatus status) {
+            auto task = pointer->task;
+            pointer->status = status;
+            pointer->done = true;
+            if (IRQ::isInIRQ()) {
+                BaseType_t woken = pdFALSE;
+                vTaskNotifyGiveFromISR(task, &woken);
+                portYIELD_FROM_ISR(woken);
+            }
+        });
+
+    while (offloaded && !waiter.done)
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    return waiter.status;
+}
+
+bool copyBenchmark(size_t size, CopyBenchmarkResult &result) {
+    static constexpr uint32_t REPEAT = 8;
+
+    result = {};
+    if (size == 0 || size > MdmaEngine::MAX_LENGTH)
+        return false;
+    auto src = static_cast<uint8_t *>(heapAllocate(HeapClass::Bulk, size));
+    auto dst = static_cast<uint8_t *>(heapAllocate(HeapClass::Bulk, size));
+    if (src == nullptr || dst == nullptr) {
+        DIAG(SYSTEM_DIAG "copy benchmark, no memory");
+        heapFree(src);
+        heapFree(dst);
+        return false;
+    }
+    std::memset(src, 0x5A, size);
+
+    /*every copy on the MDMA, the others keep their threshold*/
+    auto threshold = service.threshold();
+    service.setThreshold(0);
+
+    /*cold caches, as buffers just written by a peripheral*/
+    uint32_t cpuCycles = 0;
+    uint32_t mdmaCycles = 0;
+    bool done = true;
+    for (uint32_t i = 0; i < REPEAT; i++) {
+        dmaPrepareReceive(src, size);
+        dmaPrepareReceive(dst, size);
+        uint32_t start = DWT_CLOCKS;
+        std::memcpy(dst, src, size);
+        uint32_t end = DWT_CLOCKS;
+        cpuCycles += end - start;
+
+        dmaPrepareReceive(src, size);
+        dmaPrepareReceive(dst, size);
+        start = DWT_CLOCKS;
+        done = copy(dst, src, size) == CopyStatus::Done && done;
+        end = DWT_CLOCKS;
+        mdmaCycles += end - start;
+    }
+
+    service.setThreshold(threshold);
+    heapFree(src);
+    heapFree(dst);
+
+    result.cpuCycles = cpuCycles / REPEAT;
+    result.mdmaCycles = mdmaCycles / REPEAT;
+    result.threshold = static_cast<uint32_t>(threshold);
+    return done;
+}
+
+} // namespace CARBON
+
+extern "C" {
+
+int carbon_copy(void *dst, const void *src, size_t length) {
+    return copy(dst, src, length) == CopyStatus::Done ? 0 : -1;
+}
+
+void carbon_mdma_isr(void) { engine.isr(); }
+}
@@ -15,61 +15,21 @@
  *
  ******************************************************************************
  */
+#include <carbon/common.hpp>
+#include <carbon/modbus_frame.hpp>
 #include <carbon/modbus_master.hpp>
-#include <string.h>
+#include <carbon/registry.hpp>
+
+using namespace CARBON;
 
 // Check if IP is valid
 bool ModbusMaster::isValidIp(const ModbusSlave &slave) const {
     return slave.slaveIp.addr != IPADDR_NONE;
 }
 
-// Construct Modbus read register request
-void ModbusMaster::constructReadRegister(ModbusMessage &request,
-                                         const ModbusSlave &slave,
-                                         uint16_t startAddress,
-                                         uint8_t functionCode) {
-    request.slaveId = slave.slaveId;
-    request.functionCode = functionCode;
-    request.startAddress = startAddress;
-    request.byteCount = 2; // Always one register
-}
-
-// Construct Modbus write register request
-void ModbusMaster::constructWriteRegister(ModbusMessage &request,
-                                          const ModbusSlave &slave,
-                                          uint16_t startAddress,
-                                          uint16_t value) {
-    request.slaveId = slave.slaveId;
-    request.functionCode = FUNC_WRITE_SINGLE_HOLDING_REGISTER;
-    request.startAddress = startAddress;
-    request.byteCount = 2;
-    request.data[0] = (value >> 8) & 0xFF;
-    request.data[1] = value & 0xFF;
-}
-
-// Process Modbus TCP response
-Result<uint16_t> ModbusMaster::processResponse(uint8_t *response, size_t len) {
-    uint16_t value;
-    if (len < 5)
-        return ModbusResponseFailed;
-    uint8_t functionCode = response[1];
-    uint8_t byteCount = response[2];
-
-    if ((functionCode == FUNC_READ_HOLDING_REGISTERS ||
-         functionCode == FUNC_READ_INPUT_REGISTERS) &&
-        byteCount == 2) {
-        value = (response[3] << 8) | response[4];
-        return value;
-    }
-    return ModbusResponseFailed;
-}
-
-// Read holding register (1 register)
-Result<uint16_t> ModbusMaster::readHoldingRegister(const ModbusSlave &slave,
-                                                   uint16_t startAddress) {
-    if (!isValidIp(slave))
-        return NetworkInvalidIP;
-
+// Send the request, receive the whole reply
+Error ModbusMaster::transact(const ModbusSlave &slave, const uint8_t *request,
+                             uint8_t *response, size_t &len) {
     struct netconn *netConn = netconn_new(NETCONN_TCP);
     if (!netConn)
         return NetworkConnectionFailed;
@@ -80,74 +40,115 @@ Result<uint16_t> ModbusMaster::readHoldingRegister(const ModbusSlave &slave,
         return NetworkConnectionFailed;
     }
 
-    ModbusMessage request;
-    constructReadRegister(request, slave, startAddress,
-                          FUNC_READ_HOLDING_REGISTERS);
-
-    if (netconn_write(netConn, &request, sizeof(request), NETCONN_COPY) !=
+    if (netconn_write(netConn, request, MODBUS_REQUEST_SIZE, NETCONN_COPY) !=
         ERR_OK) {
         netconn_close(netConn);
         netconn_delete(netConn);
         return ModbusRequestFailed;
     }
 
+    // The reply can come in several segments, the MBAP length tells the end
     struct netbuf *buf;
-    uint8_t response[MAX_PDU_SIZE];
-    if (netconn_recv(netConn, &buf) == ERR_OK) {
-        netbuf_copy(buf, response, MAX_PDU_SIZE);
+    len = 0;
+    while (len < MODBUS_MAX_FRAME_SIZE &&
+           netconn_recv(netConn, &buf) == ERR_OK) {
+        len += netbuf_copy(buf, response + len, MODBUS_MAX_FRAME_SIZE - len);
         netbuf_delete(buf);
-        auto res = processResponse(response, MAX_PDU_SIZE);
-        netconn_close(netConn);
-        netconn_delete(netConn);
-        return res;
+        auto size = modbusFrameSize(response, len);
+        if (size != 0 && len >= size)
+            break;
     }
 
     netconn_close(netConn);
     netconn_delete(netConn);
-    return ModbusResponseFailed;
+    return len == 0 ? ModbusResponseFailed : Success;
 }
 
-// Read input register (1 register)
-Result<uint16_t> ModbusMaster::readInputRegister(const ModbusSlave &slave,
-                                                 uint16_t startAddress) {
+// Read consecutive registers, holding or input
+Error ModbusMaster::readRegisters(const ModbusSlave &slave,
+                                  uint16_t startAddress, uint8_t functionCode,
+                                  uint16_t *values, uint16_t count) {
     if (!isValidIp(slave))
         return NetworkInvalidIP;
+    if (count == 0 || count > MAX_READ_REGISTERS)
+        return ModbusRequestFailed;
 
-    struct netconn *netConn = netconn_new(NETCONN_TCP);
-    if (!netConn)
-        return NetworkConnectionFailed;
+    uint8_t request[MODBUS_REQUEST_SIZE];
+    modbusEncodeRequest(request, ++transaction_, slave.slaveId, functionCode,
+                        startAddress, count);
 
-    if (netconn_connect(netConn, &slave.slaveIp, TCP_PORT) != ERR_OK) {
-        netconn_close(netConn);
-        netconn_delete(netConn);
-        return NetworkConnectionFailed;
-    }
+    uint8_t response[MODBUS_MAX_FRAME_SIZE];
+    size_t len;
+    auto error = transact(slave, request, response, len);
+    if (error)
+        return error;
+    if (!modbusDecodeRead(response, len, request, values, count))
+        return ModbusResponseFailed;
+    return Success;
+}
 
-    ModbusMessage request;
-    constructReadRegister(request, slave, startAddress,
-                          FUNC_READ_INPUT_REGISTERS);
+// Publish the last read in the registry
+void ModbusMaster::publish(const ModbusSlave &slave, uint8_t functionCode,
+                           uint16_t startAddress,
+                           const Result<uint16_t> &result) {
+    auto error = result.error().error();
+    reads_++;
+    if (error != ErrorType::None)
+        errors_++;
+    CARBON::RegistryModbus reading{};
+    reading.slaveIp = ip4_addr_get_u32(ip_2_ip4(&slave.slaveIp));
+    reading.slaveId = slave.slaveId;
+    reading.functionCode = functionCode;
+    reading.address = startAddress;
+    reading.value = error == ErrorType::None ? result.value() : 0;
+    reading.error = static_cast<uint16_t>(error);
+    reading.reads = reads_;
+    reading.errors = errors_;
+    CARBON::registryPublish<CARBON::RegistryId::Modbus>(reading);
+}
 
-    if (netconn_write(netConn, &request, sizeof(request), NETCONN_COPY) !=
-        ERR_OK) {
-        netconn_close(netConn);
-        netconn_delete(netConn);
-        return ModbusRequestFailed;
-    }
+// Read holding register (1 register)
+Result<uint16_t> ModbusMaster::readHoldingRegister(const ModbusSlave &slave,
+                                                   uint16_t startAddress) {
+    uint16_t value;
+    auto error = readRegisters(slave, startAddress,
+                               FUNC_READ_HOLDING_REGISTERS, &value, 1);
+    auto result = error ? Result<uint16_t>(error) : Result<uint16_t>(value);
+    publish(slave, FUNC_READ_HOLDING_REGISTERS, startAddress, result);
+    return result;
+}
 
-    struct netbuf *buf;
-    uint8_t response[MAX_PDU_SIZE];
-    if (netconn_recv(netConn, &buf) == ERR_OK) {
-        netbuf_copy(buf, response, MAX_PDU_SIZE);
-        netbuf_delete(buf);
-        auto res = processResponse(response, MAX_PDU_SIZE);
-        netconn_close(netConn);
-        netconn_delete(netConn);
-        return res;
-    }
+// Read input register (1 register)
+Result<uint16_t> ModbusMaster::readInputRegister(const ModbusSlave &slave,
+                                                 uint16_t startAddress) {
+    uint16_t value;
+    auto error = readRegisters(slave, startAddress, FUNC_READ_INPUT_REGISTERS,
+                               &value, 1);
+    auto result = error ? Result<uint16_t>(error) : Result<uint16_t>(value);
+    publish(slave, FUNC_READ_INPUT_REGISTERS, startAddress, result);
+    return result;
+}
 
-    netconn_close(netConn);
-    netconn_delete(netConn);
-    return ModbusResponseFailed;
+// Read holding registers, the first one is published
+Error ModbusMaster::readHoldingRegisters(const ModbusSlave &slave,
+                                         uint16_t startAddress,
+                                         uint16_t *values, uint16_t count) {
+    auto error = readRegisters(slave, startAddress,
+                               FUNC_READ_HOLDING_REGISTERS, values, count);
+    publish(slave, FUNC_READ_HOLDING_REGISTERS, startAddress,
+            error ? Result<uint16_t>(error) : Result<uint16_t>(values[0]));
+    return error;
+}
+
+// Read input registers, the first one is published
+Error ModbusMaster::readInputRegisters(const ModbusSlave &slave,
+                                       uint16_t startAddress, uint16_t *values,
+                                       uint16_t count) {
+    auto error = readRegisters(slave, startAddress, FUNC_READ_INPUT_REGISTERS,
+                               values, count);
+    publish(slave, FUNC_READ_INPUT_REGISTERS, startAddress,
+            error ? Result<uint16_t>(error) : Result<uint16_t>(values[0]));
+    return error;
 }
 
 // Write holding register (1 register)
@@ -157,37 +158,17 @@ Error ModbusMaster::writeHoldingRegister(const ModbusSlave &slave,
     if (!isValidIp(slave))
         return NetworkInvalidIP;
 
-    struct netconn *netConn = netconn_new(NETCONN_TCP);
-    if (!netConn)
-        return NetworkConnectionFailed;
-
-    if (netconn_connect(netConn, &slave.slaveIp, TCP_PORT) != ERR_OK) {
-        netconn_close(netConn);
-        netconn_delete(netConn);
-        return NetworkConnectionFailed;
-    }
-
-    ModbusMessage request;
-    constructWriteRegister(request, slave, startAddress, value);
-
-    if (netconn_write(netConn, &request, sizeof(request), NETCONN_COPY) !=
-        ERR_OK) {
-        netconn_close(netConn);
-        netconn_delete(netConn);
-        return ModbusRequestFailed;
-    }
-
-    struct netbuf *buf;
-    uint8_t response[MAX_PDU_SIZE];
-    if (netconn_recv(netConn, &buf) == ERR_OK) {
-        netbuf_copy(buf, response, MAX_PDU_SIZE);
-        netbuf_delete(buf);
-        netconn_close(netConn);
-        netconn_delete(netConn);
-        return Success;
-    }
-
-    netconn_close(netConn);
-    netconn_delete(netConn);
-    return ModbusResponseFailed;
+    uint8_t request[MODBUS_REQUEST_SIZE];
+    modbusEncodeRequest(request, ++transaction_, slave.slaveId,
+                        FUNC_WRITE_SINGLE_HOLDING_REGISTER, startAddress,
+                        value);
+
+    uint8_t response[MODBUS_MAX_FRAME_SIZE];
+    size_t len;
+    auto error = transact(slave, request, response, len);
+    if (error)
+        return error;
+    if (!modbusDecodeWrite(response, len, request))
+        return ModbusResponseFailed;
+    return Success;
 }
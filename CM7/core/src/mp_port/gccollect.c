@@ -45,6 +45,8 @@
 #include <stdint.h>
 
 #include <carbon/mp_port/gccollect.h>
+#include <carbon/mp_port/mpgc.h>
+#include <carbon/systime.hpp>
 #include <py/gc.h>
 #include <py/mpthread.h>
 #include <shared/runtime/gchelper.h>
@@ -54,6 +56,8 @@ DECLARE PUBLIC FUNCTIONS
  ******************************************************************************/
 
 void gc_collect(void) {
+    uint64_t start = systimeUs();
+
     // start the GC
     gc_collect_start();
 
@@ -67,4 +71,6 @@ void gc_collect(void) {
 
     // end the GC
     gc_collect_end();
+
+    mp_carbon_gc_collected((uint32_t)(systimeUs() - start));
 }
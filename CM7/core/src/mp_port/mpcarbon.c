@@ -17,6 +17,7 @@
  */
 
 #include <carbon/mp_port/mpcarbon.h>
+#include <carbon/mp_port/mpgc.h>
 
 #include <py/builtin.h>
 #include <py/compile.h>
@@ -26,7 +27,10 @@
 #include <py/persistentcode.h>
 #include <py/runtime.h>
 #include <py/stackctrl.h>
+#include <mphalport.h>
+#include <shared/readline/readline.h>
 #include <shared/runtime/gchelper.h>
+#include <vfs_carbon.h>
 
 #include <string.h>
 
@@ -34,19 +38,22 @@
 
 // Initialise the runtime.
 #if MICROPY_PY_THREAD
-void mp_carbon_init(void *stack, size_t stack_len, void *gc_heap,
+void mp_carbon_init(void *stack, size_t stack_len, void *gc_nursery,
+                    size_t gc_nursery_size, void *gc_heap,
                     size_t gc_heap_size, void *sp) {
     mp_thread_init(stack, stack_len);
     mp_stack_set_top(sp);
-    gc_init(gc_heap, (uint8_t *)gc_heap + gc_heap_size);
+    mp_carbon_gc_init(gc_nursery, gc_nursery_size, gc_heap, gc_heap_size);
     mp_init();
+    mp_obj_list_append(mp_sys_path, MP_OBJ_NEW_QSTR(MP_QSTR__slash_lib));
 }
 #else
-void mp_carbon_init(void *gc_heap, size_t gc_heap_size, void *sp) {
-    mp_thread_init(stack, stack_len);
+void mp_carbon_init(void *gc_nursery, size_t gc_nursery_size, void *gc_heap,
+                    size_t gc_heap_size, void *sp) {
     mp_stack_set_top(sp);
-    gc_init(gc_heap, (uint8_t *)gc_heap + gc_heap_size);
+    mp_carbon_gc_init(gc_nursery, gc_nursery_size, gc_heap, gc_heap_size);
     mp_init();
+    mp_obj_list_append(mp_sys_path, MP_OBJ_NEW_QSTR(MP_QSTR__slash_lib));
 }
 #endif
 
@@ -84,7 +91,7 @@ void mp_carbon_exec_mpy(const uint8_t *mpy, size_t len) {
         mp_compiled_module_t cm;
         cm.context = ctx;
         mp_raw_code_load_mem(mpy, len, &cm);
-        mp_obj_t f = mp_make_function_from_raw_code(cm.rc, ctx, MP_OBJ_NULL);
+        mp_obj_t f = mp_make_function_from_proto_fun(cm.rc, ctx, NULL);
         mp_call_function_0(f);
         nlr_pop();
     } else {
@@ -93,6 +100,37 @@ void mp_carbon_exec_mpy(const uint8_t *mpy, size_t len) {
         mp_obj_print_exception(&mp_plat_print, (mp_obj_t)nlr.ret_val);
     }
 }
+
+// Execute a script of the volume, from its .mpy cache when up to date.
+// CTRL-C from the console raises KeyboardInterrupt in the script.
+void mp_carbon_exec_file(const char *path) {
+    nlr_buf_t nlr;
+    mp_hal_set_interrupt_char(CHAR_CTRL_C);
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t module_fun;
+        const char *cache = mp_carbon_vfs_cache(path);
+        if (cache) {
+            mp_module_context_t *ctx = m_new_obj(mp_module_context_t);
+            ctx->module.globals = mp_globals_get();
+            mp_compiled_module_t cm;
+            cm.context = ctx;
+            mp_raw_code_load_file(qstr_from_str(cache), &cm);
+            module_fun = mp_make_function_from_proto_fun(cm.rc, ctx, NULL);
+        } else {
+            mp_lexer_t *lex = mp_lexer_new_from_file(qstr_from_str(path));
+            qstr source_name = lex->source_name;
+            mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+            module_fun = mp_compile(&parse_tree, source_name, false);
+        }
+        mp_call_function_0(module_fun);
+        nlr_pop();
+    } else {
+        // Uncaught exception: print it out.
+        DIAG(MP "Uncaught exception from %s", path);
+        mp_obj_print_exception(&mp_plat_print, (mp_obj_t)nlr.ret_val);
+    }
+    mp_hal_set_interrupt_char(-1);
+}
 #endif
 
 // Called if an exception is raised outside all C exception-catching handlers.
@@ -103,30 +141,6 @@ void nlr_jump_fail(void *val) {
     }
 }
 
-// There is no filesystem so opening a file raises an exception.
-mp_lexer_t *mp_lexer_new_from_file(qstr filename) {
-    mp_reader_t reader;
-    mp_reader_new_file(&reader, filename);
-    return mp_lexer_new(filename, reader);
-}
-
-void mp_reader_new_file(mp_reader_t *reader, qstr filename) {
-    DIAG(MP "mp_reader_new_file");
-}
-
-mp_import_stat_t mp_import_stat(const char *path) {
-    (void)path;
-    DIAG(MP "mp_import_stat");
-    return MP_IMPORT_STAT_NO_EXIST;
-}
-
-mp_obj_t mp_builtin_open(size_t n_args, const mp_obj_t *args,
-                         mp_map_t *kwargs) {
-    DIAG(MP "mp_builtin_open");
-    return mp_const_none;
-}
-MP_DEFINE_CONST_FUN_OBJ_KW(mp_builtin_open_obj, 1, mp_builtin_open);
-
 #ifndef NDEBUG
 // Used when debugging is enabled.
 void __assert_func(const char *file, int line, const char *func,
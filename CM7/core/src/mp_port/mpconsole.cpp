@@ -0,0 +1,305 @@
+/**
+ ******************************************************************************
+ * @file           mpconsole.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micropython network console
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/byte_ring.hpp>
+#include <carbon/completion.hpp>
+#include <carbon/diag.hpp>
+#include <carbon/mp_port/mpconsole.h>
+#include <carbon/semaphore.hpp>
+#include <carbon/thread.hpp>
+
+#include <lwip/api.h>
+#include <lwip/tcp.h>
+#include <lwip/tcpip.h>
+
+#include <printf.h>
+
+#include <cmsis_os.h>
+
+#include <atomic>
+#include <cstring>
+
+extern "C" {
+/*shared/runtime/interrupt_char.c and py/scheduler.c*/
+extern int mp_interrupt_char;
+void mp_sched_keyboard_interrupt(void);
+}
+
+using namespace CARBON;
+
+static constexpr uint16_t CONSOLE_PORT = 6666;
+static constexpr uint32_t TX_SIZE = 8192;
+static constexpr uint32_t RX_SIZE = 1024;
+static constexpr uint32_t TX_THRESHOLD = TCP_MSS; /*one full segment*/
+static constexpr uint32_t TX_IDLE_MS = 5;
+static constexpr uint32_t TX_SPACE_WAIT_MS = 100;
+static constexpr int CHAR_CTRL_C = 3;
+static constexpr int CHAR_CTRL_D = 4;
+
+/*
+ * The micropython task only copies in and out of the rings: the send
+ * thread writes the output in as few segments as possible, the listen
+ * thread accepts the client and drains every received netbuf, catching the
+ * interrupt character also while the script does not read its input.
+ */
+class Console {
+public:
+    Console()
+        : txData_("console tx"), txSpace_("console tx space"),
+          rxData_("console rx"), connected_("console client"),
+          sendLock_(1) {}
+
+    PREVENT_COPY_AND_MOVE(Console)
+
+    void init() { sendLock_.init(); }
+
+    size_t write(const char *str, size_t len) {
+        if (client_.load() == nullptr) {
+            printf_("%.*s", static_cast<int>(len), str);
+            return len;
+        }
+
+        auto bytes = reinterpret_cast<const uint8_t *>(str);
+        auto remaining = static_cast<uint32_t>(len);
+        bool wasEmpty = tx_.used() == 0;
+        for (;;) {
+            auto written = tx_.write(bytes, remaining);
+            bytes += written;
+            remaining -= written;
+            if (remaining == 0)
+                break;
+            /*full, the sender makes room at the speed of the network*/
+            requestFlush();
+            txSpace_.wait(TX_SPACE_WAIT_MS);
+            if (client_.load() == nullptr)
+                return len; /*dropped with the client*/
+            wasEmpty = false;
+        }
+
+        if (std::memchr(str, '\n', len) != nullptr ||
+            tx_.used() >= TX_THRESHOLD)
+            requestFlush();
+        else if (wasEmpty)
+            txData_.complete(); /*sent after the idle time*/
+        return len;
+    }
+
+    void flush() {
+        if (tx_.used() > 0)
+            requestFlush();
+    }
+
+    int read() {
+        for (;;) {
+            if (pendingEof_) {
+                pendingEof_ = false;
+                return CHAR_CTRL_D;
+            }
+            auto hangups = hangups_.load();
+            if (hangups != hangupsSeen_) {
+                /*the input of the old client is dropped, the REPL exits*/
+                hangupsSeen_ = hangups;
+                rx_.clear();
+                pendingEof_ = true;
+                return CHAR_CTRL_C;
+            }
+            uint8_t c;
+            if (rx_.read(&c, 1) == 1)
+                return c;
+            flush(); /*prompt and echo*/
+            rxData_.wait();
+        }
+    }
+
+    bool waitClient(uint32_t timeout) {
+        while (client_.load() == nullptr) {
+            if (!connected_.wait(timeout))
+                return false;
+        }
+        return true;
+    }
+
+    void send() {
+        for (;;) {
+            txData_.wait();
+            while (tx_.used() > 0) {
+                /*the rest of the line has the idle time to come*/
+                if (!flush_.exchange(false))
+                    txData_.wait(TX_IDLE_MS);
+                flush_.store(false);
+                sendPending();
+            }
+        }
+    }
+
+    void listen() {
+        auto listener = netconn_new(NETCONN_TCP);
+        if (listener == nullptr ||
+            netconn_bind(listener, nullptr, CONSOLE_PORT) != ERR_OK ||
+            netconn_listen_with_backlog(listener, 1) != ERR_OK) {
+            DIAG(MP "console cannot listen on port %u", CONSOLE_PORT);
+            if (listener != nullptr)
+                netconn_delete(listener);
+            for (;;)
+                osDelay(10000);
+        }
+        DIAG(MP "console on port %u", CONSOLE_PORT);
+
+        for (;;) {
+            struct netconn *client;
+            auto err = netconn_accept(listener, &client);
+            if (err != ERR_OK) {
+                DIAG(MP "console accept error %d", err);
+                osDelay(100);
+                continue;
+            }
+            /*the output is batched here, a flush goes out at once*/
+            LOCK_TCPIP_CORE();
+            tcp_nagle_disable(client->pcb.tcp);
+            UNLOCK_TCPIP_CORE();
+
+            DIAG(MP "console client connected");
+            client_.store(client);
+            connected_.complete();
+            receive(client);
+            hangup(client);
+        }
+    }
+
+private:
+    void requestFlush() {
+        flush_.store(true);
+        txData_.complete();
+    }
+
+    void sendPending() {
+        sendLock_.acquire();
+        auto client = client_.load();
+        const uint8_t *data;
+        uint32_t length;
+        while ((length = tx_.peek(data)) > 0) {
+            /*on error the listener hangs up, the output goes away*/
+            if (client != nullptr &&
+                netconn_write(client, data, length, NETCONN_COPY) != ERR_OK)
+                client = nullptr;
+            tx_.consume(length);
+            txSpace_.complete();
+        }
+        sendLock_.release();
+    }
+
+    void receive(struct netconn *client) {
+        struct netbuf *buffer;
+        while (netconn_recv(client, &buffer) == ERR_OK) {
+            do {
+                void *data;
+                u16_t length;
+                netbuf_data(buffer, &data, &length);
+                push(static_cast<const uint8_t *>(data), length);
+            } while (netbuf_next(buffer) >= 0);
+            netbuf_delete(buffer);
+            rxData_.complete();
+        }
+    }
+
+    /*the interrupt character never reaches the ring, a full ring drops*/
+    void push(const uint8_t *data, uint32_t length) {
+        auto interrupt = mp_interrupt_char;
+        uint32_t start = 0;
+        for (uint32_t i = 0; i <= length; i++) {
+            if (i < length && data[i] != interrupt)
+                continue;
+            auto run = i - start;
+            dropped_ += run - rx_.write(data + start, run);
+            if (i < length)
+                mp_sched_keyboard_interrupt();
+            start = i + 1;
+        }
+    }
+
+    void hangup(struct netconn *client) {
+        client_.store(nullptr);
+        /*aborts a blocked write, then the sender leaves the client*/
+        netconn_close(client);
+        sendLock_.acquire();
+        sendLock_.release();
+        netconn_delete(client);
+        hangups_.fetch_add(1);
+        rxData_.complete();
+        txSpace_.complete();
+        DIAG(MP "console client disconnected, %lu input bytes dropped",
+             dropped_);
+        dropped_ = 0;
+    }
+
+    ByteRing<TX_SIZE> tx_;
+    ByteRing<RX_SIZE> rx_;
+    Completion txData_;
+    Completion txSpace_;
+    Completion rxData_;
+    Completion connected_;
+    Semaphore sendLock_;
+    std::atomic<struct netconn *> client_{nullptr};
+    std::atomic<bool> flush_{false};
+    std::atomic<uint32_t> hangups_{0};
+    uint32_t dropped_{0};     /*listen thread*/
+    uint32_t hangupsSeen_{0}; /*reader*/
+    bool pendingEof_{false};  /*reader*/
+};
+
+static Console console;
+
+class ConsoleSendThread : public StaticThread<configMINIMAL_STACK_SIZE * 4> {
+public:
+    ConsoleSendThread() : StaticThread("console_tx", osPriorityNormal) {}
+
+protected:
+    void run() override { console.send(); }
+};
+
+class ConsoleListenThread : public StaticThread<configMINIMAL_STACK_SIZE * 4> {
+public:
+    ConsoleListenThread() : StaticThread("console_rx", osPriorityNormal) {}
+
+protected:
+    void run() override { console.listen(); }
+};
+
+static ConsoleSendThread sendThread;
+static ConsoleListenThread listenThread;
+
+extern "C" {
+
+void carbon_console_start(void) {
+    console.init();
+    sendThread.start();
+    listenThread.start();
+}
+
+size_t carbon_console_write(const char *str, size_t len) {
+    return console.write(str, len);
+}
+
+void carbon_console_flush(void) { console.flush(); }
+
+int carbon_console_read(void) { return console.read(); }
+
+bool carbon_console_wait_client(uint32_t timeout) {
+    return console.waitClient(timeout);
+}
+}
@@ -0,0 +1,247 @@
+/**
+ ******************************************************************************
+ * @file           mpgc.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micropython heap areas, native code area and statistics
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <py/gc.h>
+#include <py/misc.h>
+#include <py/mpprint.h>
+#include <py/mpstate.h>
+#include <py/mpthread.h>
+
+#include <string.h>
+
+#include <carbon/mp_port/mpgc.h>
+
+/*
+ * Two areas of the split heap: the nursery in the cached AXI SRAM, first in
+ * the list, and the SDRAM area. The small objects, most of them short-lived,
+ * are placed in the nursery and spill over to the SDRAM when it is full, the
+ * large buffers go straight to the SDRAM.
+ */
+
+#define BYTES_PER_BLOCK (MICROPY_BYTES_PER_GC_BLOCK)
+#define BLOCKS_PER_ATB (4)
+#define EXEC_SIZE (32768) /*the MPU region of MPU_Config*/
+#define EXEC_ALIGN (32)   /*cache line*/
+
+typedef struct {
+    uint32_t count;
+    uint32_t lastUs;
+    uint32_t maxUs;
+    uint64_t totalUs;
+} gc_stats_t;
+
+static gc_stats_t stats;
+
+/*
+ * Native code, not traced by the GC: first fit over the area, in blocks of
+ * EXEC_ALIGN. MicroPython never frees the code of a function, so when no
+ * run fits, after a collection, the blocks no live object, thread stack nor
+ * state points into are reclaimed, e.g. functions redefined at the REPL.
+ */
+#define EXEC_BLOCKS (EXEC_SIZE / EXEC_ALIGN)
+
+static uint8_t exec_area[EXEC_SIZE]
+    __attribute__((aligned(EXEC_ALIGN), section(".mp_exec")));
+static uint16_t exec_length[EXEC_BLOCKS]; /*blocks, at the first block*/
+static uint8_t exec_live[EXEC_BLOCKS / 8];
+static size_t exec_used;
+static size_t exec_reclaimed;
+
+void mp_carbon_gc_init(void *nursery, size_t nursery_size, void *heap,
+                       size_t heap_size) {
+    gc_init(nursery, (uint8_t *)nursery + nursery_size);
+    gc_add(heap, (uint8_t *)heap + heap_size);
+    memset(exec_length, 0, sizeof(exec_length));
+    exec_used = 0;
+}
+
+/*first free run of count blocks, EXEC_BLOCKS if none; largest run*/
+static size_t exec_find(size_t count, size_t *largest) {
+    size_t run = 0;
+    *largest = 0;
+    for (size_t block = 0; block < EXEC_BLOCKS;) {
+        if (exec_length[block] != 0) {
+            block += exec_length[block];
+            run = 0;
+            continue;
+        }
+        block++;
+        run++;
+        if (run > *largest)
+            *largest = run;
+        if (run == count)
+            return block - run;
+    }
+    return EXEC_BLOCKS;
+}
+
+static void exec_mark(void **ptrs, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uintptr_t offset = (uintptr_t)ptrs[i] - (uintptr_t)exec_area;
+        if (offset < EXEC_SIZE) {
+            size_t block = offset / EXEC_ALIGN;
+            exec_live[block / 8] |= (uint8_t)(1 << (block % 8));
+        }
+    }
+}
+
+/*after a collection the allocated blocks of the heap are the live ones*/
+static void exec_mark_heap(void) {
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL;
+         area = area->next) {
+        size_t blocks = (size_t)(area->gc_pool_end - area->gc_pool_start) /
+                        BYTES_PER_BLOCK;
+        for (size_t block = 0; block < blocks; block++) {
+            uint8_t atb = area->gc_alloc_table_start[block / BLOCKS_PER_ATB];
+            if (((atb >> (2 * (block % BLOCKS_PER_ATB))) & 3) != 0)
+                exec_mark((void **)(area->gc_pool_start +
+                                    block * BYTES_PER_BLOCK),
+                          BYTES_PER_BLOCK / sizeof(void *));
+        }
+    }
+}
+
+static __attribute__((noinline)) void exec_reclaim(void) {
+    /*the callee saved registers of the callers go on this stack frame*/
+    __builtin_unwind_init();
+    void *sp = &sp;
+    memset(exec_live, 0, sizeof(exec_live));
+    exec_mark_heap();
+    exec_mark((void **)&mp_state_ctx, sizeof(mp_state_ctx) / sizeof(void *));
+    exec_mark((void **)&sp, (size_t)((uintptr_t)MP_STATE_THREAD(stack_top) -
+                                     (uintptr_t)&sp) /
+                                sizeof(void *));
+#if MICROPY_PY_THREAD
+    mp_thread_visit_other_stacks(exec_mark);
+#endif
+    for (size_t block = 0; block < EXEC_BLOCKS;) {
+        size_t length = exec_length[block];
+        if (length == 0) {
+            block++;
+            continue;
+        }
+        bool live = false;
+        for (size_t i = block; i < block + length && !live; i++)
+            live = (exec_live[i / 8] >> (i % 8)) & 1;
+        if (!live) {
+            exec_length[block] = 0;
+            exec_used -= length * EXEC_ALIGN;
+            exec_reclaimed += length * EXEC_ALIGN;
+        }
+        block += length;
+    }
+}
+
+void mp_carbon_exec_alloc(size_t min_size, void **ptr, size_t *size) {
+    size_t count = (min_size + EXEC_ALIGN - 1) / EXEC_ALIGN;
+    if (count == 0)
+        count = 1;
+    size_t largest;
+    size_t block = count <= EXEC_BLOCKS ? exec_find(count, &largest)
+                                        : EXEC_BLOCKS;
+    if (block == EXEC_BLOCKS && count <= EXEC_BLOCKS && !gc_is_locked()) {
+        gc_collect();
+        exec_reclaim();
+        block = exec_find(count, &largest);
+    }
+    if (block == EXEC_BLOCKS)
+        m_malloc_fail(min_size);
+    exec_length[block] = (uint16_t)count;
+    exec_used += count * EXEC_ALIGN;
+    *ptr = exec_area + block * EXEC_ALIGN;
+    *size = count * EXEC_ALIGN;
+}
+
+void mp_carbon_exec_free(void *ptr, size_t size) {
+    (void)size;
+    uintptr_t offset = (uintptr_t)ptr - (uintptr_t)exec_area;
+    if (offset >= EXEC_SIZE || offset % EXEC_ALIGN != 0)
+        return;
+    size_t block = offset / EXEC_ALIGN;
+    exec_used -= exec_length[block] * EXEC_ALIGN;
+    exec_length[block] = 0;
+}
+
+mp_state_mem_area_t *mp_carbon_gc_alloc_area(mp_state_mem_area_t *area,
+                                             size_t n_blocks) {
+    if (n_blocks > MICROPY_CARBON_GC_SMALL_BLOCKS &&
+        area == &MP_STATE_MEM(area) && area->next != NULL)
+        return area->next;
+    return area;
+}
+
+void mp_carbon_gc_collected(uint32_t us) {
+    stats.count++;
+    stats.lastUs = us;
+    if (us > stats.maxUs)
+        stats.maxUs = us;
+    stats.totalUs += us;
+}
+
+/*2 bits per block in the allocation table, 0 is free*/
+static void area_info(const mp_state_mem_area_t *area, size_t *blocks,
+                      size_t *free, size_t *maxFree) {
+    *blocks = (size_t)(area->gc_pool_end - area->gc_pool_start) /
+              BYTES_PER_BLOCK;
+    *free = 0;
+    *maxFree = 0;
+    size_t run = 0;
+    for (size_t block = 0; block < *blocks; block++) {
+        uint8_t atb = area->gc_alloc_table_start[block / BLOCKS_PER_ATB];
+        if (((atb >> (2 * (block % BLOCKS_PER_ATB))) & 3) == 0) {
+            (*free)++;
+            run++;
+            if (run > *maxFree)
+                *maxFree = run;
+        } else {
+            run = 0;
+        }
+    }
+}
+
+void mp_carbon_gc_dump_info(const mp_print_t *print) {
+    const mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    for (uint32_t index = 0; area != NULL; index++, area = area->next) {
+        size_t blocks, free, maxFree;
+        area_info(area, &blocks, &free, &maxFree);
+        /*share of the free memory not in the largest free run*/
+        unsigned fragmentation =
+            free == 0 ? 0 : (unsigned)(100 - (100 * maxFree) / free);
+        mp_printf(print,
+                  " %s at %p: total: %u, free: %u, max free sz: %u, "
+                  "fragmentation: %u%%\n",
+                  index == 0 ? "nursery" : "heap", area->gc_pool_start,
+                  (unsigned)(blocks * BYTES_PER_BLOCK),
+                  (unsigned)(free * BYTES_PER_BLOCK), (unsigned)maxFree,
+                  fragmentation);
+    }
+    size_t largest;
+    exec_find(EXEC_BLOCKS + 1, &largest);
+    mp_printf(print,
+              " native code: total: %u, used: %u, free: %u, largest free: %u, "
+              "reclaimed: %u\n",
+              (unsigned)EXEC_SIZE, (unsigned)exec_used,
+              (unsigned)(EXEC_SIZE - exec_used),
+              (unsigned)(largest * EXEC_ALIGN), (unsigned)exec_reclaimed);
+    unsigned averageUs =
+        stats.count == 0 ? 0 : (unsigned)(stats.totalUs / stats.count);
+    mp_printf(print,
+              " collections: %u, last: %u us, max: %u us, average: %u us\n",
+              (unsigned)stats.count, (unsigned)stats.lastUs,
+              (unsigned)stats.maxUs, averageUs);
+}
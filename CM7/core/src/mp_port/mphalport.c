@@ -18,26 +18,27 @@
 
 #include <mphalport.h>
 #include <py/mphal.h>
+#include <py/mpthread.h>
 
 #include <cmsis_os.h>
 
 #include <carbon/diag.hpp>
+#include <carbon/mp_port/mpconsole.h>
 #include <carbon/systime.hpp>
 
-mp_uint_t mp_carbon_stdout(const char *str, size_t len);
-int mp_carbon_stdint();
-
 // Send string of given length to stdout, converting \n to \r\n.
 mp_uint_t mp_hal_stdout_tx_strn(const char *str, size_t len) {
-    return mp_carbon_stdout(str, len);
+    return carbon_console_write(str, len);
 }
 
-inline void mp_hal_set_interrupt_char(int c) {
-    // DIAG(MP "mp_hal_set_interrupt_char, char:  %d", c);
+// The other micropython threads run while waiting for the client.
+int mp_hal_stdin_rx_chr(void) {
+    MP_THREAD_GIL_EXIT();
+    int c = carbon_console_read();
+    MP_THREAD_GIL_ENTER();
+    return c;
 }
 
-int mp_hal_stdin_rx_chr(void) { return mp_carbon_stdint(); }
-
 uintptr_t mp_hal_stdio_poll(uintptr_t poll_flags) { return 0; }
 
 void mp_hal_delay_ms(mp_uint_t ms) { osDelay(ms); }
@@ -46,9 +47,6 @@ void mp_hal_delay_us(mp_uint_t us) { delayUs(us); }
 
 mp_uint_t mp_hal_ticks_ms(void) { return HAL_GetTick(); }
 
-mp_uint_t mp_hal_ticks_us(void) { return HAL_GetTick() * 1000; }
+mp_uint_t mp_hal_ticks_us(void) { return (mp_uint_t)systimeUs(); }
 
-mp_uint_t mp_hal_ticks_cpu(void) {
-    DIAG(MP "mp_hal_ticks_cpu");
-    return DWT_CLOCKS;
-}
+mp_uint_t mp_hal_ticks_cpu(void) { return DWT->CYCCNT; }
@@ -0,0 +1,187 @@
+/**
+ ******************************************************************************
+ * @file           mpprofile.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micropython sampling profiler
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <py/bc.h>
+#include <py/mpprint.h>
+#include <py/objfun.h>
+#include <py/qstr.h>
+
+#include <carbon/mp_port/mpprofile.h>
+#include <carbon/systime.hpp>
+
+/*
+ * The systime timer only raises a flag, the VM takes the sample at the next
+ * branch or return, holding the GIL: the table is only touched by the VM.
+ * A tick finding the flag still raised counts as out of the VM (blocked,
+ * native code, other tasks).
+ */
+
+#define PROFILE_ENTRIES (128) /*power of two*/
+#define PROFILE_PROBES (8)
+#define PROFILE_MAX_RATE (10000)
+
+typedef struct {
+    qstr name;
+    qstr file;
+    uint32_t line;
+    uint32_t count;
+} profile_entry_t;
+
+static profile_entry_t entries[PROFILE_ENTRIES];
+static uint32_t samples;
+static uint32_t dropped; /*table full*/
+static volatile uint32_t missed;
+
+volatile uint32_t mp_carbon_profile_pending;
+
+static void profile_tick(void) {
+    if (mp_carbon_profile_pending)
+        missed++;
+    mp_carbon_profile_pending = 1;
+}
+
+static uint32_t profile_hash(qstr name, qstr file, uint32_t line) {
+    return (uint32_t)(name * 31u + file * 7u + line * 2654435761u) &
+           (PROFILE_ENTRIES - 1);
+}
+
+void mp_carbon_profile_sample(const mp_code_state_t *code_state,
+                              const uint8_t *ip) {
+    mp_carbon_profile_pending = 0;
+
+    /*as the traceback in py/vm.c*/
+    const mp_obj_fun_bc_t *fun = code_state->fun_bc;
+    const byte *prelude = fun->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(prelude);
+    MP_BC_PRELUDE_SIZE_DECODE(prelude);
+    const byte *line_info_top = prelude + n_info;
+    const byte *bytecode_start = prelude + n_info + n_cell;
+    qstr name = mp_decode_uint_value(prelude);
+    for (size_t i = 0; i < 1 + n_pos_args + n_kwonly_args; ++i)
+        prelude = mp_decode_uint_skip(prelude);
+#if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    name = fun->context->constants.qstr_table[name];
+    qstr file = fun->context->constants.qstr_table[0];
+#else
+    qstr file = fun->context->constants.source_file;
+#endif
+    uint32_t line = (uint32_t)mp_bytecode_get_source_line(
+        prelude, line_info_top, (size_t)(ip - bytecode_start));
+
+    samples++;
+    uint32_t index = profile_hash(name, file, line);
+    for (uint32_t probe = 0; probe < PROFILE_PROBES; probe++) {
+        profile_entry_t *entry = &entries[index];
+        if (entry->count == 0) {
+            entry->name = name;
+            entry->file = file;
+            entry->line = line;
+        }
+        if (entry->name == name && entry->file == file &&
+            entry->line == line) {
+            entry->count++;
+            return;
+        }
+        index = (index + 1) & (PROFILE_ENTRIES - 1);
+    }
+    dropped++;
+}
+
+bool mp_carbon_profile_start(uint32_t rate) {
+    if (rate > PROFILE_MAX_RATE)
+        return false;
+    if (rate == 0) {
+        systimeSampler(0, NULL);
+        mp_carbon_profile_pending = 0;
+        return true;
+    }
+    systimeSampler(1000000 / rate, profile_tick);
+    return true;
+}
+
+void mp_carbon_profile_reset(void) {
+    for (uint32_t i = 0; i < PROFILE_ENTRIES; i++)
+        entries[i].count = 0;
+    samples = 0;
+    dropped = 0;
+    missed = 0;
+}
+
+static uint32_t percent(uint32_t count) {
+    return samples == 0 ? 0 : (uint32_t)((100ull * count) / samples);
+}
+
+/*the unprinted line, or function, with the highest count, -1 at the end*/
+static int profile_next(bool printed[], bool byFunction, uint32_t *count) {
+    int best = -1;
+    uint32_t bestCount = 0;
+    for (uint32_t i = 0; i < PROFILE_ENTRIES; i++) {
+        if (printed[i] || entries[i].count == 0)
+            continue;
+        uint32_t total = entries[i].count;
+        if (byFunction) {
+            for (uint32_t j = i + 1; j < PROFILE_ENTRIES; j++) {
+                if (!printed[j] && entries[j].count != 0 &&
+                    entries[j].name == entries[i].name &&
+                    entries[j].file == entries[i].file)
+                    total += entries[j].count;
+            }
+        }
+        if (total > bestCount) {
+            best = (int)i;
+            bestCount = total;
+        }
+    }
+    if (best >= 0 && byFunction) {
+        for (uint32_t j = (uint32_t)best; j < PROFILE_ENTRIES; j++) {
+            if (entries[j].count != 0 &&
+                entries[j].name == entries[best].name &&
+                entries[j].file == entries[best].file)
+                printed[j] = true;
+        }
+    } else if (best >= 0) {
+        printed[best] = true;
+    }
+    *count = bestCount;
+    return best;
+}
+
+void mp_carbon_profile_dump(const mp_print_t *print) {
+    mp_printf(print, "%u samples, %u out of the VM, %u not in the table\n",
+              (unsigned)samples, (unsigned)missed, (unsigned)dropped);
+
+    bool printed[PROFILE_ENTRIES] = {false};
+    uint32_t count;
+    int index;
+    mp_printf(print, "%8s %4s  %s\n", "samples", "%", "function");
+    while ((index = profile_next(printed, true, &count)) >= 0) {
+        mp_printf(print, "%8u %3u%%  %s (%s)\n", (unsigned)count,
+                  (unsigned)percent(count), qstr_str(entries[index].name),
+                  qstr_str(entries[index].file));
+    }
+
+    for (uint32_t i = 0; i < PROFILE_ENTRIES; i++)
+        printed[i] = false;
+    mp_printf(print, "%8s %4s  %s\n", "samples", "%", "line");
+    while ((index = profile_next(printed, false, &count)) >= 0) {
+        mp_printf(print, "%8u %3u%%  %s:%u %s\n", (unsigned)count,
+                  (unsigned)percent(count), qstr_str(entries[index].file),
+                  (unsigned)entries[index].line,
+                  qstr_str(entries[index].name));
+    }
+}
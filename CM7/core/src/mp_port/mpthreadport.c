@@ -52,6 +52,15 @@
 
 #if MICROPY_PY_THREAD
 
+#ifdef CARBON_HOST
+/*the stack scanned by the GC must be the one the thread runs on*/
+#define MP_THREAD_DEFAULT_STACK portHOST_MIN_TASK_STACK
+#define MP_THREAD_MIN_STACK portHOST_MIN_TASK_STACK
+#else
+#define MP_THREAD_DEFAULT_STACK 4096
+#define MP_THREAD_MIN_STACK 2048
+#endif
+
 // this structure forms a linked list, one node per active thread
 typedef struct _mp_thread_t {
     TaskHandle_t id;  // system id of thread
@@ -97,6 +106,17 @@ void mp_thread_gc_others(void) {
     mp_thread_mutex_unlock(&thread_mutex);
 }
 
+void mp_thread_visit_other_stacks(void (*visit)(void **ptrs, size_t len)) {
+    mp_thread_mutex_lock(&thread_mutex, 1);
+    for (mp_thread_t *th = thread; th != NULL; th = th->next) {
+        if (th->id == xTaskGetCurrentTaskHandle() || !th->ready) {
+            continue;
+        }
+        visit(th->stack, th->stack_len);
+    }
+    mp_thread_mutex_unlock(&thread_mutex);
+}
+
 mp_state_thread_t *mp_thread_get_state(void) {
     return pvTaskGetThreadLocalStoragePointer(NULL, 0);
 }
@@ -137,9 +157,9 @@ mp_uint_t mp_thread_create(void *(*entry)(void *), void *arg,
     ext_thread_entry = entry;
 
     if (*stack_size == 0) {
-        *stack_size = 4096; // default stack size
-    } else if (*stack_size < 2048) {
-        *stack_size = 2048; // minimum stack size
+        *stack_size = MP_THREAD_DEFAULT_STACK; // default stack size
+    } else if (*stack_size < MP_THREAD_MIN_STACK) {
+        *stack_size = MP_THREAD_MIN_STACK; // minimum stack size
     }
 
     // allocate TCB, stack and linked-list node (must be outside thread_mutex
@@ -153,7 +173,7 @@ mp_uint_t mp_thread_create(void *(*entry)(void *), void *arg,
     // create thread
     TaskHandle_t id =
         xTaskCreateStatic(freertos_entry, "Thread",
-                          *stack_size / sizeof(void *), arg, 2, stack, tcb);
+                          *stack_size / sizeof(StackType_t), arg, 2, stack, tcb);
     if (id == NULL) {
         mp_thread_mutex_unlock(&thread_mutex);
         mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("can't create thread"));
@@ -0,0 +1,173 @@
+/**
+ ******************************************************************************
+ * @file           mp_mod_carbon.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          firmware services for the micropython carbon module
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/completion.hpp>
+#include <carbon/hsem.hpp>
+#ifndef CARBON_HOST
+#include <carbon/mdma_copy.hpp>
+#endif
+#include <carbon/modbus_master.hpp>
+#include <carbon/registry.hpp>
+#include <carbon/sd_bench.hpp>
+#include <carbon/shared_memory.hpp>
+#include <carbon/systime.hpp>
+#include <carbon/trace_format.hpp>
+
+#include <stm32h7xx.h>
+
+#include <cstring>
+
+using namespace CARBON;
+
+/*the constants of the module follow these values*/
+static_assert(static_cast<uint32_t>(RegistryId::NetLink) == 0);
+static_assert(static_cast<uint32_t>(RegistryId::SdCard) == 1);
+static_assert(static_cast<uint32_t>(RegistryId::Modbus) == 2);
+static_assert(static_cast<uint32_t>(RegistryId::CM4) == 3);
+static_assert(static_cast<uint32_t>(ErrorType::NetworkConnectionFailed) == 3);
+static_assert(static_cast<uint32_t>(ErrorType::NetworkInvalidIP) == 4);
+static_assert(static_cast<uint32_t>(ErrorType::FileNotFound) == 8);
+static_assert(static_cast<uint32_t>(ErrorType::DiskFull) == 9);
+static_assert(SD_BENCH_MAX_DEPTH == 4);
+static_assert(SD_BENCH_MAX_REQUEST == 65536);
+static_assert(SD_BENCH_MAX_DURATION == 600000);
+static_assert(SD_BENCH_DEFAULT_SPAN == 16 * 1024 * 1024);
+#ifndef CARBON_HOST
+static_assert(MdmaEngine::MAX_LENGTH == 16 * 65536);
+#endif
+
+static ModbusMaster modbusMaster;
+
+extern "C" {
+
+uint32_t carbon_mp_cycles(void) { return DWT->CYCCNT; }
+
+/*0 on success, else the ErrorType*/
+uint32_t carbon_mp_modbus_read(const char *ip, uint8_t slaveId,
+                               uint16_t address, uint16_t *values,
+                               uint16_t count, bool input) {
+    ModbusMaster::ModbusSlave slave;
+    if (!slave.setIP(ip))
+        return static_cast<uint32_t>(ErrorType::NetworkInvalidIP);
+    slave.slaveId = slaveId;
+    auto error =
+        input ? modbusMaster.readInputRegisters(slave, address, values, count)
+              : modbusMaster.readHoldingRegisters(slave, address, values,
+                                                  count);
+    return static_cast<uint32_t>(error.error());
+}
+
+uint32_t carbon_mp_modbus_max_registers(void) {
+    return ModbusMaster::MAX_READ_REGISTERS;
+}
+
+/*false if the trace fifo is full or the trace is not built*/
+bool carbon_mp_trace(uint16_t channel, const void *data, uint32_t length) {
+#ifdef FREERTOS_USE_TRACE
+    TraceUserEvent trc; // NOLINT
+    length = length < TRACE_USER_DATA_SIZE ? length : TRACE_USER_DATA_SIZE;
+    auto size = static_cast<uint32_t>(sizeof(TraceUserEvent) -
+                                      TRACE_USER_DATA_SIZE + length);
+    trc.header.eventSizeBits =
+        static_cast<TraceEventHeader::SizeType>(size << 3);
+    trc.header.timestamp = systimeUs();
+    trc.channel = channel;
+    trc.length = static_cast<uint16_t>(length);
+    std::memcpy(trc.data, data, length);
+    traceFifoClass::ContextPush context(traceFifo, size, hsemTrace);
+    return context.push_array(reinterpret_cast<uint8_t *>(&trc), size);
+#else
+    (void)channel;
+    (void)data;
+    (void)length;
+    return false;
+#endif
+}
+
+/*
+ * 0 on success, else the ErrorType; results: requests, errors, elapsed us,
+ * p50, p90, p99 and max us
+ */
+uint32_t carbon_mp_sd_bench(bool file, bool random, bool write,
+                            uint32_t requestSize, uint32_t depth,
+                            uint32_t durationMs, uint32_t spanBytes,
+                            uint32_t results[7]) {
+    SdBenchConfig config;
+    config.file = file;
+    config.random = random;
+    config.write = write;
+    config.requestSize = requestSize;
+    config.depth = depth;
+    config.durationMs = durationMs;
+    config.spanBytes = spanBytes;
+    SdBenchResult result;
+    auto error = sdBenchRun(config, result);
+    results[0] = result.requests;
+    results[1] = result.errors;
+    results[2] = result.elapsedUs;
+    results[3] = result.p50Us;
+    results[4] = result.p90Us;
+    results[5] = result.p99Us;
+    results[6] = result.maxUs;
+    return static_cast<uint32_t>(error.error());
+}
+
+#ifndef CARBON_HOST
+/*results: cpu and mdma cycles of a copy, the threshold in bytes*/
+bool carbon_mp_copy_bench(uint32_t size, uint32_t results[3]) {
+    CopyBenchmarkResult result;
+    bool done = copyBenchmark(size, result);
+    results[0] = result.cpuCycles;
+    results[1] = result.mdmaCycles;
+    results[2] = result.threshold;
+    return done;
+}
+#endif
+
+/*
+ * for the latency module, semaphore then completion: max, average and
+ * missed wake ups in cycles, on the otherwise unused CRS interrupt
+ */
+void carbon_mp_wakeup_bench(uint32_t results[6]) {
+    CompletionBenchmarkResult semaphore;
+    CompletionBenchmarkResult completion;
+    completionBenchmark(CRS_IRQn, semaphore, completion);
+    results[0] = semaphore.maxCycles;
+    results[1] = semaphore.averageCycles;
+    results[2] = semaphore.missed;
+    results[3] = completion.maxCycles;
+    results[4] = completion.averageCycles;
+    results[5] = completion.missed;
+}
+
+/*0 for an unknown id*/
+uint32_t carbon_mp_registry_size(uint32_t id) {
+    if (id >= registryTable.size())
+        return 0;
+    return registryTable[id].size;
+}
+
+/*size has to be the one of the entry, false if never written*/
+bool carbon_mp_registry_read(uint32_t id, void *value, uint32_t size,
+                             uint64_t *timestampUs) {
+    if (id >= registryTable.size())
+        return false;
+    return registryReadRaw(registryShared(), static_cast<RegistryId>(id),
+                           value, size, timestampUs);
+}
+}
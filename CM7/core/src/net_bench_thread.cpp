@@ -0,0 +1,580 @@
+/**
+ ******************************************************************************
+ * @file           net_bench_thread.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          network benchmark service
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/completion.hpp>
+#include <carbon/diag.hpp>
+#include <carbon/heap.hpp>
+#include <carbon/net_bench_format.hpp>
+#include <carbon/net_bench_thread.hpp>
+#include <carbon/systime.hpp>
+
+#include <ff.h>
+#include <lwip/api.h>
+#include <lwip/stats.h>
+
+#include <cmsis_os.h>
+#include <task.h>
+
+#include <cstring>
+
+using namespace CARBON;
+
+static constexpr uint32_t CONTROL_TIMEOUT = 5000; /*ms, request and accept*/
+static constexpr uint32_t RECV_TIMEOUT = 1000;    /*ms, a sender gone quiet*/
+static constexpr uint32_t END_GRACE = 2000; /*ms, a sender not closing*/
+static constexpr uint32_t UDP_MAX_DATAGRAM = 1472; /*one Ethernet frame*/
+static constexpr uint32_t SDRAM_RING_SIZE = 1024 * 1024;
+static constexpr uint32_t SD_CHUNK_SIZE = 16384;
+static constexpr char SD_FILE[] = "0:/netbench.bin";
+
+/*what the board sends, never freed: lwIP references it until acked*/
+static uint8_t txPattern[NET_BENCH_MAX_BUFFER] __attribute__((aligned(32)));
+
+/*where the received data goes, a write never blocks the network for long*/
+class Sink {
+public:
+    NetBenchStatus open(NetBenchSink kind) {
+        kind_ = kind;
+        position_ = 0;
+        errors_ = 0;
+        maxWriteUs_ = 0;
+        switch (kind_) {
+        case NetBenchSink::Sdram:
+            memory_ = static_cast<uint8_t *>(
+                heapAllocate(HeapClass::Bulk, SDRAM_RING_SIZE));
+            return memory_ ? NetBenchStatus::Ok : NetBenchStatus::NoMemory;
+        case NetBenchSink::Sd: {
+            /*whole cache lines, the SD DMA writes from them*/
+            memory_ = static_cast<uint8_t *>(
+                heapAllocate(HeapClass::Dma, SD_CHUNK_SIZE));
+            if (!memory_)
+                return NetBenchStatus::NoMemory;
+            FRESULT res = f_open(&file_, SD_FILE, FA_CREATE_ALWAYS | FA_WRITE);
+            if (res != FR_OK) {
+                DIAG(NET_BENCH_DIAG "cannot open %s: %d", SD_FILE, res);
+                heapFree(memory_);
+                memory_ = nullptr;
+                return (res == FR_NOT_READY || res == FR_NOT_ENABLED)
+                           ? NetBenchStatus::NoSdCard
+                           : NetBenchStatus::SinkError;
+            }
+            return NetBenchStatus::Ok;
+        }
+        default:
+            return NetBenchStatus::Ok;
+        }
+    }
+
+    void write(const void *data, uint32_t length) {
+        if (kind_ == NetBenchSink::Null)
+            return;
+        auto bytes = static_cast<const uint8_t *>(data);
+        uint32_t capacity =
+            kind_ == NetBenchSink::Sdram ? SDRAM_RING_SIZE : SD_CHUNK_SIZE;
+        uint64_t start = systimeUs();
+        while (length > 0) {
+            uint32_t n = capacity - position_;
+            if (n > length)
+                n = length;
+            std::memcpy(memory_ + position_, bytes, n);
+            position_ += n;
+            bytes += n;
+            length -= n;
+            if (position_ == capacity) {
+                if (kind_ == NetBenchSink::Sd)
+                    flush();
+                position_ = 0;
+            }
+        }
+        uint32_t us = static_cast<uint32_t>(systimeUs() - start);
+        if (us > maxWriteUs_)
+            maxWriteUs_ = us;
+    }
+
+    void close() {
+        if (kind_ == NetBenchSink::Sd && memory_) {
+            flush();
+            if (f_close(&file_) != FR_OK)
+                errors_++;
+        }
+        if (memory_)
+            heapFree(memory_);
+        memory_ = nullptr;
+    }
+
+    uint32_t errors() const { return errors_; }
+
+    uint32_t maxWriteUs() const { return maxWriteUs_; }
+
+private:
+    void flush() {
+        UINT written = 0;
+        if (position_ > 0 &&
+            (f_write(&file_, memory_, position_, &written) != FR_OK ||
+             written != position_))
+            errors_++;
+    }
+
+    NetBenchSink kind_{NetBenchSink::Null};
+    uint8_t *memory_{nullptr};
+    uint32_t position_{0};
+    uint32_t errors_{0};
+    uint32_t maxWriteUs_{0};
+    FIL file_;
+};
+
+/*
+ * The run time counter is in us and wraps every 71 minutes: the idle time
+ * of a run is the 32 bit difference of two samples, exact for a run shorter
+ * than the wrap.
+ */
+struct CpuSample {
+    uint32_t idleUs;
+    uint64_t us;
+};
+
+static CpuSample cpuSample() {
+    return {ulTaskGetIdleRunTimeCounter(), systimeUs()};
+}
+
+static uint32_t cpuLoad(const CpuSample &start, const CpuSample &end) {
+    if (end.us <= start.us || end.us - start.us > 0xFFFFFFFFULL)
+        return NET_BENCH_CPU_UNKNOWN;
+    uint64_t total = end.us - start.us;
+    uint64_t idle = static_cast<uint32_t>(end.idleUs - start.idleUs);
+    if (idle > total)
+        idle = total;
+    return static_cast<uint32_t>(1000 - idle * 1000 / total);
+}
+
+/*lwIP counters, over every connection of the board*/
+struct StatsSample {
+    uint32_t retransmits;
+    uint32_t tcpDrops;
+    uint32_t udpDrops;
+    uint32_t linkDrops;
+};
+
+static StatsSample statsSample() {
+    return {lwip_stats.mib2.tcpretranssegs, lwip_stats.tcp.drop,
+            lwip_stats.udp.drop, lwip_stats.link.drop};
+}
+
+/*the data the client sends, until it closes or stops*/
+static void tcpReceive(struct netconn *conn, Sink &sink, uint32_t durationMs,
+                       NetBenchReport &report) {
+    netconn_set_recvtimeout(conn, RECV_TIMEOUT);
+    uint64_t deadline = systimeUs() + (durationMs + END_GRACE) * 1000ULL;
+    while (systimeUs() < deadline) {
+        struct netbuf *buf;
+        err_t err = netconn_recv(conn, &buf);
+        if (err == ERR_TIMEOUT)
+            continue;
+        if (err != ERR_OK)
+            break;
+        do {
+            void *data;
+            u16_t length;
+            netbuf_data(buf, &data, &length);
+            sink.write(data, length);
+            report.rxBytes += length;
+        } while (netbuf_next(buf) >= 0);
+        netbuf_delete(buf);
+    }
+}
+
+/*the pattern, bufferSize bytes per write, then the end of the stream*/
+static void tcpSend(struct netconn *conn, uint32_t bufferSize,
+                    uint32_t durationMs, uint64_t &txBytes) {
+    uint64_t end = systimeUs() + durationMs * 1000ULL;
+    while (systimeUs() < end) {
+        if (netconn_write(conn, txPattern, bufferSize, NETCONN_NOCOPY) !=
+            ERR_OK)
+            break;
+        txBytes += bufferSize;
+    }
+    netconn_shutdown(conn, 0, 1);
+}
+
+/*the sending half of the bidirectional test*/
+class NetBenchTxThread : public StaticThread<configMINIMAL_STACK_SIZE * 4> {
+public:
+    NetBenchTxThread()
+        : StaticThread("net_bench_tx", osPriorityNormal), start_("net tx"),
+          done_("net tx done") {}
+
+    void send(struct netconn *conn, uint32_t bufferSize, uint32_t durationMs) {
+        conn_ = conn;
+        bufferSize_ = bufferSize;
+        durationMs_ = durationMs;
+        txBytes_ = 0;
+        start_.complete();
+    }
+
+    uint64_t wait() {
+        done_.wait();
+        return txBytes_;
+    }
+
+protected:
+    void run() override {
+        while (1) {
+            start_.wait();
+            tcpSend(conn_, bufferSize_, durationMs_, txBytes_);
+            done_.complete();
+        }
+    }
+
+private:
+    Completion start_;
+    Completion done_;
+    struct netconn *conn_{nullptr};
+    uint32_t bufferSize_{0};
+    uint32_t durationMs_{0};
+    uint64_t txBytes_{0};
+};
+
+static NetBenchTxThread txThread;
+
+/*datagrams of the client, RFC 3550 jitter scaled by 16*/
+static void udpReceive(struct netconn *conn, Sink &sink, uint32_t durationMs,
+                       NetBenchReport &report, uint64_t &startUs,
+                       uint64_t &endUs) {
+    netconn_set_recvtimeout(conn, CONTROL_TIMEOUT);
+    uint32_t next = 0;
+    int32_t lastTransit = 0;
+    uint32_t jitter = 0;
+    uint64_t deadline = 0;
+    while (deadline == 0 || systimeUs() < deadline) {
+        struct netbuf *buf;
+        err_t err = netconn_recv(conn, &buf);
+        if (err != ERR_OK)
+            break; /*the client stopped*/
+        uint64_t now = systimeUs();
+        if (deadline == 0) {
+            startUs = now;
+            deadline = now + (durationMs + END_GRACE) * 1000ULL;
+            netconn_set_recvtimeout(conn, RECV_TIMEOUT);
+        }
+        endUs = now;
+        NetBenchDatagram head;
+        if (netbuf_copy(buf, &head, sizeof(head)) == sizeof(head)) {
+            if (head.sequence >= next) {
+                report.lost += head.sequence - next;
+                next = head.sequence + 1;
+            } else {
+                report.outOfOrder++;
+                if (report.lost > 0)
+                    report.lost--;
+            }
+            auto transit =
+                static_cast<int32_t>(static_cast<uint32_t>(now) - head.sentUs);
+            if (report.datagrams > 0) {
+                int32_t d = transit - lastTransit;
+                uint32_t magnitude = static_cast<uint32_t>(d < 0 ? -d : d);
+                jitter += magnitude - ((jitter + 8) >> 4);
+            }
+            lastTransit = transit;
+        }
+        do {
+            void *data;
+            u16_t length;
+            netbuf_data(buf, &data, &length);
+            sink.write(data, length);
+            report.rxBytes += length;
+        } while (netbuf_next(buf) >= 0);
+        report.datagrams++;
+        netbuf_delete(buf);
+    }
+    report.jitterUs = jitter >> 4;
+}
+
+/*datagrams to the client at rateKbps, lost counts the ones not sent*/
+static void udpSend(struct netconn *conn, const ip_addr_t &address,
+                    uint16_t port, const NetBenchRequest &request,
+                    NetBenchReport &report) {
+    uint64_t start = systimeUs();
+    uint64_t end = start + request.durationMs * 1000ULL;
+    uint64_t intervalUs =
+        request.udpRateKbps
+            ? request.bufferSize * 8000ULL / request.udpRateKbps
+            : 0;
+    uint64_t nextUs = start;
+    NetBenchDatagram head;
+    while (1) {
+        uint64_t now = systimeUs();
+        if (now >= end)
+            break;
+        if (intervalUs) {
+            /*the tick is the sleep granularity, late datagrams go at once*/
+            if (nextUs > now + 1000) {
+                osDelay(1);
+                continue;
+            }
+            nextUs += intervalUs;
+        }
+        struct netbuf *buf = netbuf_new();
+        void *data = buf ? netbuf_alloc(buf, request.bufferSize) : nullptr;
+        if (!data) {
+            if (buf)
+                netbuf_delete(buf);
+            report.lost++;
+            osDelay(1);
+            continue;
+        }
+        head.sentUs = static_cast<uint32_t>(systimeUs());
+        std::memcpy(data, txPattern, request.bufferSize);
+        std::memcpy(data, &head, sizeof(head));
+        if (netconn_sendto(conn, buf, &address, port) == ERR_OK) {
+            report.txBytes += request.bufferSize;
+            report.datagrams++;
+        } else {
+            report.lost++;
+        }
+        head.sequence++;
+        netbuf_delete(buf);
+    }
+}
+
+static NetBenchStatus validate(const NetBenchRequest &request) {
+    if (request.magic != NET_BENCH_MAGIC ||
+        request.version != NET_BENCH_VERSION ||
+        request.mode >= NetBenchMode::Count ||
+        request.sink >= NetBenchSink::Count || request.durationMs == 0 ||
+        request.durationMs > NET_BENCH_MAX_DURATION ||
+        request.bufferSize == 0 || request.bufferSize > NET_BENCH_MAX_BUFFER)
+        return NetBenchStatus::BadRequest;
+    bool udp = request.mode == NetBenchMode::UdpRx ||
+               request.mode == NetBenchMode::UdpTx;
+    if (udp && (request.bufferSize < sizeof(NetBenchDatagram) ||
+                request.bufferSize > UDP_MAX_DATAGRAM))
+        return NetBenchStatus::BadRequest;
+    if (request.mode == NetBenchMode::UdpTx && request.udpPort == 0)
+        return NetBenchStatus::BadRequest;
+    return NetBenchStatus::Ok;
+}
+
+static bool receiveRequest(struct netconn *control, NetBenchRequest &request) {
+    auto bytes = reinterpret_cast<uint8_t *>(&request);
+    uint16_t received = 0;
+    netconn_set_recvtimeout(control, CONTROL_TIMEOUT);
+    while (received < sizeof(request)) {
+        struct netbuf *buf;
+        if (netconn_recv(control, &buf) != ERR_OK)
+            return false;
+        received += netbuf_copy(buf, bytes + received,
+                                static_cast<u16_t>(sizeof(request) - received));
+        netbuf_delete(buf);
+    }
+    return true;
+}
+
+static bool sendReport(struct netconn *control, const NetBenchReport &report) {
+    return netconn_write(control, &report, sizeof(report), NETCONN_COPY) ==
+           ERR_OK;
+}
+
+static struct netconn *acceptData(struct netconn *listener) {
+    struct netconn *conn = nullptr;
+    if (netconn_accept(listener, &conn) != ERR_OK)
+        return nullptr;
+    return conn;
+}
+
+static void closeData(struct netconn *conn) {
+    if (!conn)
+        return;
+    netconn_close(conn);
+    netconn_delete(conn);
+}
+
+static void serve(struct netconn *control, struct netconn *dataListener) {
+    NetBenchRequest request;
+    if (!receiveRequest(control, request))
+        return;
+
+    NetBenchReport report;
+    report.mode = request.mode;
+    report.sink = request.sink;
+    report.status = validate(request);
+
+    Sink sink;
+    bool receives = request.mode == NetBenchMode::TcpRx ||
+                    request.mode == NetBenchMode::TcpBidir ||
+                    request.mode == NetBenchMode::UdpRx;
+    if (report.status == NetBenchStatus::Ok)
+        report.status =
+            sink.open(receives ? request.sink : NetBenchSink::Null);
+
+    /*bound before the answer, the client sends right after it*/
+    struct netconn *udp = nullptr;
+    if (report.status == NetBenchStatus::Ok &&
+        (request.mode == NetBenchMode::UdpRx ||
+         request.mode == NetBenchMode::UdpTx)) {
+        udp = netconn_new(NETCONN_UDP);
+        if (!udp || (request.mode == NetBenchMode::UdpRx &&
+                     netconn_bind(udp, IP_ADDR_ANY, NET_BENCH_DATA_PORT) !=
+                         ERR_OK))
+            report.status = NetBenchStatus::NetworkError;
+    }
+
+    if (!sendReport(control, report) ||
+        report.status != NetBenchStatus::Ok) {
+        DIAG(NET_BENCH_DIAG "test refused, status %u",
+             static_cast<unsigned>(report.status));
+        if (udp)
+            netconn_delete(udp);
+        sink.close();
+        return;
+    }
+
+    DIAG(NET_BENCH_DIAG "test mode %u sink %u buffer %lu for %lu ms",
+         static_cast<unsigned>(request.mode),
+         static_cast<unsigned>(request.sink), request.bufferSize,
+         request.durationMs);
+
+    netconn_set_recvtimeout(dataListener, CONTROL_TIMEOUT);
+    StatsSample stats = statsSample();
+    CpuSample cpu = cpuSample();
+    uint64_t startUs = systimeUs();
+    uint64_t endUs = 0; /*the last datagram, not the wait after it*/
+
+    switch (request.mode) {
+    case NetBenchMode::TcpRx: {
+        struct netconn *conn = acceptData(dataListener);
+        if (!conn) {
+            report.status = NetBenchStatus::NoConnection;
+            break;
+        }
+        startUs = systimeUs();
+        tcpReceive(conn, sink, request.durationMs, report);
+        closeData(conn);
+        break;
+    }
+    case NetBenchMode::TcpTx: {
+        struct netconn *conn = acceptData(dataListener);
+        if (!conn) {
+            report.status = NetBenchStatus::NoConnection;
+            break;
+        }
+        startUs = systimeUs();
+        tcpSend(conn, request.bufferSize, request.durationMs, report.txBytes);
+        closeData(conn);
+        break;
+    }
+    case NetBenchMode::TcpBidir: {
+        /*the client connects the stream it sends first*/
+        struct netconn *rx = acceptData(dataListener);
+        struct netconn *tx = rx ? acceptData(dataListener) : nullptr;
+        if (!tx) {
+            report.status = NetBenchStatus::NoConnection;
+            closeData(rx);
+            break;
+        }
+        startUs = systimeUs();
+        txThread.send(tx, request.bufferSize, request.durationMs);
+        tcpReceive(rx, sink, request.durationMs, report);
+        report.txBytes = txThread.wait();
+        closeData(tx);
+        closeData(rx);
+        break;
+    }
+    case NetBenchMode::UdpRx:
+        udpReceive(udp, sink, request.durationMs, report, startUs, endUs);
+        if (report.datagrams == 0)
+            report.status = NetBenchStatus::NoConnection;
+        break;
+    case NetBenchMode::UdpTx: {
+        ip_addr_t address;
+        u16_t port;
+        netconn_peer(control, &address, &port);
+        startUs = systimeUs();
+        udpSend(udp, address, request.udpPort, request, report);
+        break;
+    }
+    default:
+        break;
+    }
+
+    if (endUs == 0)
+        endUs = systimeUs();
+    report.elapsedUs = static_cast<uint32_t>(endUs - startUs);
+    report.cpuLoadPermille = cpuLoad(cpu, cpuSample());
+    StatsSample now = statsSample();
+    report.retransmits = now.retransmits - stats.retransmits;
+    report.tcpDrops = now.tcpDrops - stats.tcpDrops;
+    report.udpDrops = now.udpDrops - stats.udpDrops;
+    report.linkDrops = now.linkDrops - stats.linkDrops;
+    if (udp)
+        netconn_delete(udp);
+    sink.close();
+    report.sinkErrors = sink.errors();
+    report.sinkMaxWriteUs = sink.maxWriteUs();
+    if (report.status == NetBenchStatus::Ok && report.sinkErrors > 0)
+        report.status = NetBenchStatus::SinkError;
+
+    DIAG(NET_BENCH_DIAG "test done, status %u, rx %lu KB tx %lu KB in %lu ms",
+         static_cast<unsigned>(report.status),
+         static_cast<uint32_t>(report.rxBytes / 1024),
+         static_cast<uint32_t>(report.txBytes / 1024),
+         report.elapsedUs / 1000);
+
+    sendReport(control, report);
+}
+
+static struct netconn *listen(uint16_t port) {
+    struct netconn *conn = netconn_new(NETCONN_TCP);
+    if (!conn)
+        return nullptr;
+    if (netconn_bind(conn, IP_ADDR_ANY, port) != ERR_OK ||
+        netconn_listen_with_backlog(conn, 2) != ERR_OK) {
+        DIAG(NET_BENCH_DIAG "cannot listen on port %u", port);
+        netconn_delete(conn);
+        return nullptr;
+    }
+    return conn;
+}
+
+NetBenchThread::NetBenchThread()
+    : StaticThread("net_bench", osPriorityNormal) {}
+
+void NetBenchThread::run() {
+    for (uint32_t i = 0; i < sizeof(txPattern); i++)
+        txPattern[i] = static_cast<uint8_t>(i);
+
+    struct netconn *controlListener = listen(NET_BENCH_CONTROL_PORT);
+    struct netconn *dataListener = listen(NET_BENCH_DATA_PORT);
+    if (!controlListener || !dataListener) {
+        while (1)
+            osDelay(10000);
+    }
+
+    txThread.start();
+
+    DIAG(NET_BENCH_DIAG "accepting tests on port %u",
+         NET_BENCH_CONTROL_PORT);
+
+    while (1) {
+        struct netconn *control;
+        if (netconn_accept(controlListener, &control) != ERR_OK)
+            continue;
+        serve(control, dataListener);
+        netconn_close(control);
+        netconn_delete(control);
+    }
+}
@@ -25,6 +25,18 @@
 
 struct netif gnetif; /* network interface structure */
 
+#define NETIF_THREAD_STACK_SIZE (configMINIMAL_STACK_SIZE * 6)
+
+/*started once, never deleted*/
+#if LWIP_NETIF_LINK_CALLBACK
+static StackType_t linkThreadStack[NETIF_THREAD_STACK_SIZE];
+static StaticTask_t linkThreadTcb;
+#endif
+#if LWIP_DHCP
+static StackType_t dhcpThreadStack[NETIF_THREAD_STACK_SIZE];
+static StaticTask_t dhcpThreadTcb;
+#endif
+
 void netif_config(void) {
     tcpip_init(NULL, NULL);
 
@@ -55,15 +67,16 @@ void netif_config(void) {
 #if LWIP_NETIF_LINK_CALLBACK
     netif_set_link_callback(&gnetif, ethernet_link_status_updated);
 
-    osThreadDef(EthLink, carbon_lwip_link_thread, osPriorityNormal, 0,
-                configMINIMAL_STACK_SIZE * 6);
+    osThreadStaticDef(EthLink, carbon_lwip_link_thread, osPriorityNormal, 0,
+                      NETIF_THREAD_STACK_SIZE, linkThreadStack,
+                      &linkThreadTcb);
     osThreadCreate(osThread(EthLink), &gnetif);
 #endif
 
 #if LWIP_DHCP
     /* Start DHCPClient */
-    osThreadDef(DHCP, DHCP_Thread, osPriorityNormal, 0,
-                configMINIMAL_STACK_SIZE * 6);
+    osThreadStaticDef(DHCP, DHCP_Thread, osPriorityNormal, 0,
+                      NETIF_THREAD_STACK_SIZE, dhcpThreadStack, &dhcpThreadTcb);
     osThreadCreate(osThread(DHCP), &gnetif);
 #endif
 }
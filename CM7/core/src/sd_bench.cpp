@@ -0,0 +1,278 @@
+/**
+ ******************************************************************************
+ * @file           sd_bench.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          SD card throughput and latency benchmark
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/completion.hpp>
+#include <carbon/diag.hpp>
+#include <carbon/heap.hpp>
+#include <carbon/latency_histogram.hpp>
+#include <carbon/sd_bench.hpp>
+#include <carbon/semaphore.hpp>
+#include <carbon/systime.hpp>
+#include <carbon/thread.hpp>
+
+#include <diskio.h>
+#include <ff.h>
+
+#include <cmsis_os.h>
+
+#include <atomic>
+
+using namespace CARBON;
+
+static constexpr char SD_BENCH_FILE[] = "0:/sdbench.bin";
+static constexpr uint32_t SECTOR_SIZE = 512;
+static constexpr FSIZE_t CREATE_LINK_MAP = ~FSIZE_t{0}; /*CREATE_LINKMAP*/
+
+/*what the tasks of a run share*/
+struct SdBenchRun {
+    SdBenchConfig config;
+    FIL *file;            /*file requests, else raw*/
+    FATFS *fs;
+    uint32_t firstSector; /*raw requests*/
+    uint32_t slots;       /*requests in the span*/
+    std::atomic<uint32_t> next;
+    uint64_t endUs;
+};
+
+/*f_lseek() and the transfer of a request together*/
+static Semaphore fileLock(1);
+
+static bool rawTransfer(SdBenchRun &run, uint8_t *buffer, uint32_t slot) {
+    auto count = run.config.requestSize / SECTOR_SIZE;
+    auto sector = run.firstSector + slot * count;
+    /*as FatFs does, the SD driver serves one task at a time*/
+    if (!ff_req_grant(run.fs->sobj))
+        return false;
+    DRESULT res = run.config.write
+                      ? disk_write(run.fs->drv, buffer, sector, count)
+                      : disk_read(run.fs->drv, buffer, sector, count);
+    ff_rel_grant(run.fs->sobj);
+    return res == RES_OK;
+}
+
+static bool fileTransfer(SdBenchRun &run, uint8_t *buffer, uint32_t slot) {
+    UINT done = 0;
+    fileLock.acquire();
+    FRESULT res = f_lseek(run.file, FSIZE_t{slot} * run.config.requestSize);
+    if (res == FR_OK)
+        res = run.config.write
+                  ? f_write(run.file, buffer, run.config.requestSize, &done)
+                  : f_read(run.file, buffer, run.config.requestSize, &done);
+    fileLock.release();
+    return res == FR_OK && done == run.config.requestSize;
+}
+
+class SdBenchWorker : public StaticThread<configMINIMAL_STACK_SIZE * 6> {
+public:
+    SdBenchWorker(const char *name)
+        : StaticThread(name, osPriorityNormal), start_("sd bench"),
+          done_("sd bench done") {}
+
+    void begin(SdBenchRun &run, uint8_t *buffer, uint32_t seed) {
+        run_ = &run;
+        buffer_ = buffer;
+        seed_ = seed;
+        requests_ = 0;
+        errors_ = 0;
+        latency_.reset();
+        start_.complete();
+    }
+
+    void wait() { done_.wait(); }
+
+    uint32_t requests() const { return requests_; }
+
+    uint32_t errors() const { return errors_; }
+
+    const LatencyHistogram &latency() const { return latency_; }
+
+protected:
+    void run() override {
+        while (1) {
+            start_.wait();
+            work();
+            done_.complete();
+        }
+    }
+
+private:
+    /*xorshift32, the same sequence for the same seed*/
+    uint32_t random() {
+        seed_ ^= seed_ << 13;
+        seed_ ^= seed_ >> 17;
+        seed_ ^= seed_ << 5;
+        return seed_;
+    }
+
+    void work() {
+        auto &run = *run_;
+        while (systimeUs() < run.endUs) {
+            uint32_t slot = run.config.random
+                                ? random() % run.slots
+                                : run.next.fetch_add(1) % run.slots;
+            uint64_t start = systimeUs();
+            bool ok = run.file ? fileTransfer(run, buffer_, slot)
+                               : rawTransfer(run, buffer_, slot);
+            latency_.record(static_cast<uint32_t>(systimeUs() - start));
+            requests_++;
+            if (!ok) {
+                errors_++;
+                break;
+            }
+        }
+    }
+
+    Completion start_;
+    Completion done_;
+    SdBenchRun *run_{nullptr};
+    uint8_t *buffer_{nullptr};
+    uint32_t seed_{1};
+    uint32_t requests_{0};
+    uint32_t errors_{0};
+    LatencyHistogram latency_;
+};
+
+static SdBenchWorker workers[SD_BENCH_MAX_DEPTH] = {
+    {"sd_bench_0"}, {"sd_bench_1"}, {"sd_bench_2"}, {"sd_bench_3"}};
+
+static bool workersStarted = false;
+
+static Error fileError(FRESULT res) {
+    switch (res) {
+    case FR_NOT_READY:
+    case FR_NOT_ENABLED:
+    case FR_NO_FILESYSTEM:
+    case FR_INVALID_DRIVE:
+        return FileNotFound;
+    case FR_DENIED:
+        return DiskFull;
+    default:
+        return FileSystemError;
+    }
+}
+
+/*one fragment: size, clusters and first cluster, then the end mark*/
+static bool contiguous(FIL &file, uint32_t &firstCluster) {
+    DWORD linkMap[4] = {4};
+    file.cltbl = linkMap;
+    FRESULT res = f_lseek(&file, CREATE_LINK_MAP);
+    /*without the map the requests walk the cluster chain as usual*/
+    file.cltbl = nullptr;
+    firstCluster = linkMap[2];
+    return res == FR_OK;
+}
+
+/*the file of the span, kept between runs once laid out in one piece*/
+static Error openSpan(FIL &file, uint32_t span, uint32_t &firstSector) {
+    FRESULT res = f_open(&file, SD_BENCH_FILE,
+                         FA_OPEN_ALWAYS | FA_READ | FA_WRITE);
+    if (res != FR_OK)
+        return fileError(res);
+    uint32_t cluster = 0;
+    if (f_size(&file) != span || !contiguous(file, cluster)) {
+        f_close(&file);
+        res = f_open(&file, SD_BENCH_FILE,
+                     FA_CREATE_ALWAYS | FA_READ | FA_WRITE);
+        if (res == FR_OK)
+            res = f_expand(&file, span, 1);
+        if (res == FR_OK)
+            res = f_sync(&file);
+        if (res != FR_OK || !contiguous(file, cluster)) {
+            DIAG(SD "benchmark file of %lu bytes: %d", span, res);
+            f_close(&file);
+            return res == FR_OK ? FileSystemError : fileError(res);
+        }
+    }
+    FATFS *fs = file.obj.fs;
+    firstSector = fs->database + (cluster - 2) * fs->csize;
+    return Success;
+}
+
+Error CARBON::sdBenchRun(const SdBenchConfig &config, SdBenchResult &result) {
+    result = {};
+    if (config.requestSize == 0 || config.requestSize % SECTOR_SIZE != 0 ||
+        config.requestSize > SD_BENCH_MAX_REQUEST || config.depth == 0 ||
+        config.depth > SD_BENCH_MAX_DEPTH || config.durationMs == 0 ||
+        config.durationMs > SD_BENCH_MAX_DURATION ||
+        config.spanBytes < config.requestSize)
+        return InternalError;
+    /*whole requests*/
+    auto span = config.spanBytes - config.spanBytes % config.requestSize;
+
+    static FIL file;
+    static SdBenchRun run;
+    run.config = config;
+    run.slots = span / config.requestSize;
+    run.next = 0;
+    Error error = openSpan(file, span, run.firstSector);
+    if (error)
+        return error;
+    run.fs = file.obj.fs;
+    run.file = config.file ? &file : nullptr;
+
+    /*SDRAM, reachable by the SDMMC DMA, aligned for its cache maintenance*/
+    uint8_t *memory[SD_BENCH_MAX_DEPTH]{};
+    uint8_t *buffers[SD_BENCH_MAX_DEPTH]{};
+    for (uint32_t i = 0; i < config.depth && !error; i++) {
+        memory[i] = static_cast<uint8_t *>(heapAllocate(
+            HeapClass::Bulk, config.requestSize + CACHE_ALIGNMENT - 1));
+        if (memory[i] == nullptr) {
+            DIAG(SD "no memory for the benchmark buffers");
+            error = InternalError;
+            break;
+        }
+        auto address = reinterpret_cast<uintptr_t>(memory[i]);
+        buffers[i] = reinterpret_cast<uint8_t *>(
+            (address + CACHE_ALIGNMENT - 1) & ~uintptr_t{CACHE_ALIGNMENT - 1});
+        for (uint32_t j = 0; j < config.requestSize; j++)
+            buffers[i][j] = static_cast<uint8_t>(i + j);
+    }
+
+    if (!error) {
+        fileLock.init();
+        if (!workersStarted) {
+            for (auto &worker : workers)
+                worker.start();
+            workersStarted = true;
+        }
+        uint64_t start = systimeUs();
+        run.endUs = start + config.durationMs * 1000ULL;
+        for (uint32_t i = 0; i < config.depth; i++)
+            workers[i].begin(run, buffers[i], 0x9E3779B9U * (i + 1));
+        LatencyHistogram latency;
+        for (uint32_t i = 0; i < config.depth; i++) {
+            workers[i].wait();
+            result.requests += workers[i].requests();
+            result.errors += workers[i].errors();
+            latency.merge(workers[i].latency());
+        }
+        result.elapsedUs = static_cast<uint32_t>(systimeUs() - start);
+        result.p50Us = latency.percentile(50);
+        result.p90Us = latency.percentile(90);
+        result.p99Us = latency.percentile(99);
+        result.maxUs = latency.max();
+    }
+
+    for (auto pointer : memory) {
+        if (pointer)
+            heapFree(pointer);
+    }
+    if (f_close(&file) != FR_OK && !error)
+        error = FileSystemError;
+    return error;
+}
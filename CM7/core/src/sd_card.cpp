@@ -83,8 +83,12 @@
 
 /* Includes ------------------------------------------------------------------*/
 
+#include <carbon/common.hpp>
+#include <carbon/completion.hpp>
 #include <carbon/diag.hpp>
+#include <carbon/dma_buffer.hpp>
 #include <carbon/error.hpp>
+#include <carbon/registry.hpp>
 #include <carbon/sd_card.hpp>
 #include <carbon/semaphore.hpp>
 #include <stm32h7xx_ll_tim.h>
@@ -109,8 +113,8 @@ EXTI_HandleTypeDef hsd_exti[SD_INSTANCES_NBR];
 
 static uint32_t PinDetect[SD_INSTANCES_NBR] = {SD_DETECT_PIN};
 
-static BinarySemaphore semDMATX;
-static BinarySemaphore semDMARX;
+static CARBON::Completion dmaTxDone("sd tx", CARBON_LATENCY_SDMMC);
+static CARBON::Completion dmaRxDone("sd rx", CARBON_LATENCY_SDMMC);
 
 static BinarySemaphore semDetect;
 
@@ -119,6 +123,23 @@ static RCC_ClkInitTypeDef clkConfig{};
 
 #define DMA_TIMEOUT 10000UL
 
+static CARBON::RegistrySdCard sdStats{};
+
+static void sd_publish_stats(int32_t ret, uint32_t blocks, bool write) {
+    auto present = BSP_SD_IsDetected(0) == SD_PRESENT ? 1UL : 0UL;
+    CARBON::IRQ::lockRecursive();
+    if (ret != BSP_ERROR_NONE)
+        sdStats.errors++;
+    else if (write)
+        sdStats.writtenBlocks += blocks;
+    else
+        sdStats.readBlocks += blocks;
+    sdStats.present = present;
+    auto stats = sdStats;
+    CARBON::IRQ::unLockRecursive();
+    CARBON::registryPublish<CARBON::RegistryId::SdCard>(stats);
+}
+
 extern "C" {
 
 static Error init_detect_pin_tim();
@@ -238,9 +259,6 @@ int32_t BSP_SD_Init(uint32_t Instance) {
         }
     }
 
-    semDMARX.init();
-    semDMATX.init();
-
     return ret;
 }
 
@@ -571,8 +589,9 @@ int32_t BSP_SD_ReadBlocks_DMA(uint32_t Instance, uint32_t *pData,
             osDelay(3);
         }
 
-        SCB_InvalidateDCache_by_Addr(pData, BLOCK_SIZE * BlocksNbr);
+        CARBON::dmaPrepareReceive(pData, BLOCK_SIZE * BlocksNbr);
 
+        dmaRxDone.reset();
         HAL_StatusTypeDef status = HAL_SD_ReadBlocks_DMA(
             &hsd_sdmmc[Instance], (uint8_t *)pData, BlockIdx, BlocksNbr);
 
@@ -580,17 +599,21 @@ int32_t BSP_SD_ReadBlocks_DMA(uint32_t Instance, uint32_t *pData,
             DIAG(SD "error reading SD %lu, status %lu, block %lu",
                  hsd_sdmmc[Instance].ErrorCode, status, BlockIdx);
             ret = BSP_ERROR_PERIPH_FAILURE;
+            sd_publish_stats(ret, BlocksNbr, false);
             return ret;
         }
 
-        if (!semDMARX.acquire(DMA_TIMEOUT)) {
+        if (!dmaRxDone.wait(DMA_TIMEOUT)) {
             DIAG(SD "time out waiting RX DMA");
             ret = BSP_ERROR_PERIPH_FAILURE;
         }
+        /*lines fetched speculatively during the transfer*/
+        CARBON::dmaCompleteReceive(pData, BLOCK_SIZE * BlocksNbr);
 
         while (BSP_SD_GetCardState(0)) {
             osDelay(3);
         }
+        sd_publish_stats(ret, BlocksNbr, false);
     }
 
     /* Return BSP status   */
@@ -618,8 +641,9 @@ int32_t BSP_SD_WriteBlocks_DMA(uint32_t Instance, uint32_t *pData,
             osDelay(3);
         }
 
-        SCB_CleanDCache_by_Addr(pData, BLOCK_SIZE * BlocksNbr);
+        CARBON::dmaPrepareTransmit(pData, BLOCK_SIZE * BlocksNbr);
 
+        dmaTxDone.reset();
         HAL_StatusTypeDef status = HAL_SD_WriteBlocks_DMA(
             &hsd_sdmmc[Instance], (uint8_t *)pData, BlockIdx, BlocksNbr);
 
@@ -627,9 +651,10 @@ int32_t BSP_SD_WriteBlocks_DMA(uint32_t Instance, uint32_t *pData,
             DIAG(SD "error writing SD %lu, status %lu, block %lu",
                  hsd_sdmmc[Instance].ErrorCode, status, BlockIdx);
             ret = BSP_ERROR_PERIPH_FAILURE;
+            sd_publish_stats(ret, BlocksNbr, true);
             return ret;
         }
-        if (!semDMATX.acquire(DMA_TIMEOUT)) {
+        if (!dmaTxDone.wait(DMA_TIMEOUT)) {
             DIAG(SD "time out waiting TX DMA");
             ret = BSP_ERROR_PERIPH_FAILURE;
         }
@@ -637,6 +662,7 @@ int32_t BSP_SD_WriteBlocks_DMA(uint32_t Instance, uint32_t *pData,
         while (BSP_SD_GetCardState(0)) {
             osDelay(3);
         }
+        sd_publish_stats(ret, BlocksNbr, true);
     }
 
     /* Return BSP status   */
@@ -835,7 +861,7 @@ void BSP_SD_DETECT_IRQHandler(uint32_t Instance) {
  * @param  Instance  SD Instance
  * @retval None
  */
-void BSP_SD_IRQHandler(uint32_t Instance) {
+CARBON_FAST_CODE void BSP_SD_IRQHandler(uint32_t Instance) {
     HAL_SD_IRQHandler(&hsd_sdmmc[Instance]);
 }
 
@@ -854,14 +880,18 @@ __weak void BSP_SD_AbortCallback(uint32_t Instance) {
  * @param  Instance     SD Instance
  * @retval None
  */
-__weak void BSP_SD_WriteCpltCallback(uint32_t Instance) { semDMATX.release(); }
+__weak void BSP_SD_WriteCpltCallback(uint32_t Instance) {
+    dmaTxDone.complete();
+}
 
 /**
  * @brief BSP Rx Transfer completed callbacks
  * @param  Instance     SD Instance
  * @retval None
  */
-__weak void BSP_SD_ReadCpltCallback(uint32_t Instance) { semDMARX.release(); }
+__weak void BSP_SD_ReadCpltCallback(uint32_t Instance) {
+    dmaRxDone.complete();
+}
 
 /**
  * @}
@@ -20,7 +20,6 @@
 #include <carbon/error.hpp>
 #include <carbon/sd_thread.hpp>
 
-#include <io_utils.h>
 #include <sd_diskio.h>
 
 #include <cmsis_os.h>
@@ -29,18 +28,16 @@
 static char sdPath[4];
 static FATFS sdFATFS;
 
+static constexpr uint32_t SD_DETECT_PERIOD = 500; /*ms*/
+
 static uint8_t workBuffer[_MAX_SS]
     __attribute__((aligned(32), section(".sdram_bank2")));
 
 static BSP_SD_CardInfo cardInfo;
 static BSP_SD_CardCID cardCID;
 
-extern "C" {
-FRESULT copy_file(const char *srcPath, const char *dstPath);
-}
-
 SDThread::SDThread()
-    : Thread("sd_thread", osPriorityNormal, configMINIMAL_STACK_SIZE * 64) {}
+    : StaticThread("sd_thread", osPriorityNormal), mounted_("sd mount") {}
 
 void SDThread::run() {
     DIAG(SD "starting SD thread");
@@ -91,6 +88,7 @@ void SDThread::run() {
 
         if (fres == 0) {
             DIAG(SD "Logical volume %s for sd card mounted", &sdPath[0]);
+            mounted_.complete();
         } else if (fres == 13) {
             fres =
                 f_mkfs(&sdPath[0], FM_ANY, 0, workBuffer, sizeof(workBuffer));
@@ -100,6 +98,7 @@ void SDThread::run() {
                 if (fres == 0) {
                     DIAG(SD "Logical volume %s mounted after formatting",
                          &sdPath[0]);
+                    mounted_.complete();
                 } else {
                     DIAG(SD "Error mounting logical volume %s: %d", &sdPath[0],
                          fres);
@@ -111,53 +110,11 @@ void SDThread::run() {
         } else {
             DIAG(SD "Error mounting logical volume %s: %d", &sdPath[0], fres);
         }
-#if 0
-        FRESULT test_res = copy_file("0:/original/ocean_birds.avi",
-                                     "0:/test1/ocean_birds.avi");
-        DIAG(SD "copying file 1 error %lu", test_res);
-
-        test_res =
-            copy_file("0:/original/rain_drops.avi", "0:/test1/rain_drops.avi");
-        DIAG(SD "copying file 2 error %lu", test_res);
-
-        test_res = copy_file("0:/original/Stream.avi", "0:/test1/Stream.avi");
-        DIAG(SD "copying file 3 error %lu", test_res);
-
-        test_res = copy_file("0:/original/tropicalfish.avi",
-                             "0:/test1/tropicalfish.avi");
-        DIAG(SD "copying file 4 error %lu", test_res);
-
-        test_res = copy_file("0:/original/ocean_birds.avi",
-                                     "0:/test2/ocean_birds.avi");
-        DIAG(SD "copying file 1 error %lu", test_res);
-
-        test_res =
-            copy_file("0:/original/rain_drops.avi", "0:/test2/rain_drops.avi");
-        DIAG(SD "copying file 2 error %lu", test_res);
-
-        test_res = copy_file("0:/original/Stream.avi", "0:/test2/Stream.avi");
-        DIAG(SD "copying file 3 error %lu", test_res);
-
-        test_res = copy_file("0:/original/tropicalfish.avi",
-                             "0:/test2/tropicalfish.avi");
-        DIAG(SD "copying file 4 error %lu", test_res);
-
-        test_res = copy_file("0:/original/ocean_birds.avi",
-                                     "0:/test3/ocean_birds.avi");
-        DIAG(SD "copying file 1 error %lu", test_res);
-
-        test_res =
-            copy_file("0:/original/rain_drops.avi", "0:/test3/rain_drops.avi");
-        DIAG(SD "copying file 2 error %lu", test_res);
-
-        test_res = copy_file("0:/original/Stream.avi", "0:/test3/Stream.avi");
-        DIAG(SD "copying file 3 error %lu", test_res);
-
-        test_res = copy_file("0:/original/tropicalfish.avi",
-                             "0:/test3/tropicalfish.avi");
-        DIAG(SD "copying file 4 error %lu", test_res);
-#endif
+        /*the volume stays until the card is removed*/
+        while (BSP_SD_IsDetected(0) == SD_PRESENT)
+            osDelay(SD_DETECT_PERIOD);
         BSP_SD_DeInit(0);
+        mounted_.reset();
         /* Unmount volume */
         f_mount(NULL, &sdPath[0], 0);
         DIAG(SD "volume %s unmounted", &sdPath[0]);
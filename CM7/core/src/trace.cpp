@@ -96,8 +96,8 @@ void Trace::pullEvent(struct netconn *conn) {
         traceFifoClass::ContextPull context(traceFifo, hsemTrace);
         uint32_t len1;
         uint32_t len2;
-        uint32_t ptr1;
-        uint32_t ptr2;
+        uintptr_t ptr1;
+        uintptr_t ptr2;
 
         context.getDataLengthByte(len1, len2);
         context.getDataPtr(ptr1, ptr2);
@@ -21,8 +21,7 @@
 
 #include <cmsis_os.h>
 
-TraceThread::TraceThread()
-    : Thread("trace_thread", osPriorityNormal, configMINIMAL_STACK_SIZE * 5) {}
+TraceThread::TraceThread() : StaticThread("trace_thread", osPriorityNormal) {}
 
 void TraceThread::run() {
     if (!CARBON::Trace::instance().init()) {
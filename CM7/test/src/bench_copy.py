@@ -0,0 +1,32 @@
+# CPU and MDMA copy times in SDRAM, cold caches, to tune COPY_THRESHOLD of
+# carbon/mdma_copy.hpp. Copy to the SD card and run with
+#   import bench_copy
+# from the console. run() for one size, sweep() with other sizes.
+
+import array
+import carbon
+
+SIZES = tuple(256 << i for i in range(9))
+
+results = array.array("I", range(3))
+
+
+# (cpu cycles, mdma cycles, threshold bytes)
+def run(size):
+    carbon.copy_bench(results, size)
+    return tuple(results)
+
+
+def sweep(sizes=SIZES):
+    print("%8s %10s %10s" % ("bytes", "cpu", "mdma"))
+    crossover = 0
+    threshold = 0
+    for size in sizes:
+        cpu, mdma, threshold = run(size)
+        print("%8d %10d %10d" % (size, cpu, mdma))
+        if crossover == 0 and mdma <= cpu:
+            crossover = size
+    print("threshold %d, mdma faster from %d bytes" % (threshold, crossover))
+
+
+sweep()
@@ -0,0 +1,156 @@
+# Numeric kernels: bytecode against @micropython.native and
+# @micropython.viper. Copy to the SD card and run with
+#   import bench_native
+# from the console, or as main.py.
+
+import array
+import micropython
+import time
+
+N = 2000
+TAPS = 16
+REPEAT = 5
+
+samples = array.array("h", ((i * 37) % 2001 - 1000 for i in range(N)))
+coeffs = array.array("h", (1000 - 60 * i for i in range(TAPS)))
+output = array.array("i", range(N))
+xs = [i * 0.5 for i in range(N)]
+ys = [1.0 - i * 0.25 for i in range(N)]
+
+# 01. integer loop
+
+
+def isum_bc(n):
+    acc = 0
+    for i in range(n):
+        acc += (i * i) & 0xFF
+    return acc
+
+
+@micropython.native
+def isum_native(n):
+    acc = 0
+    for i in range(n):
+        acc += (i * i) & 0xFF
+    return acc
+
+
+@micropython.viper
+def isum_viper(n: int) -> int:
+    acc = 0
+    i = 0
+    while i < n:
+        acc += (i * i) & 0xFF
+        i += 1
+    return acc
+
+
+# 02. FIR filter, int16 samples and Q15 coefficients
+
+
+def fir_bc(x, h, y, n, taps):
+    for i in range(taps, n):
+        acc = 0
+        for k in range(taps):
+            acc += x[i - k] * h[k]
+        y[i] = acc >> 15
+
+
+@micropython.native
+def fir_native(x, h, y, n, taps):
+    for i in range(taps, n):
+        acc = 0
+        for k in range(taps):
+            acc += x[i - k] * h[k]
+        y[i] = acc >> 15
+
+
+@micropython.viper
+def fir_viper(x, h, y, n: int, taps: int):
+    px = ptr16(x)
+    ph = ptr16(h)
+    py = ptr32(y)
+    i = taps
+    while i < n:
+        acc = 0
+        k = 0
+        while k < taps:
+            # ptr16 loads are unsigned, sign extend
+            s = (px[i - k] ^ 0x8000) - 0x8000
+            c = (ph[k] ^ 0x8000) - 0x8000
+            acc += s * c
+            k += 1
+        py[i] = acc >> 15
+        i += 1
+
+
+# 03. float dot product, viper has no float type
+
+
+def dot_bc(a, b, n):
+    acc = 0.0
+    for i in range(n):
+        acc += a[i] * b[i]
+    return acc
+
+
+@micropython.native
+def dot_native(a, b, n):
+    acc = 0.0
+    for i in range(n):
+        acc += a[i] * b[i]
+    return acc
+
+
+def measure(fun, *args):
+    best = None
+    for _ in range(REPEAT):
+        start = time.ticks_us()
+        fun(*args)
+        elapsed = time.ticks_diff(time.ticks_us(), start)
+        if best is None or elapsed < best:
+            best = elapsed
+    return best
+
+
+def row(name, bc, native, viper):
+    line = "{:<8} {:>10} {:>10} {:>6.1f}x".format(name, bc, native, bc / native)
+    if viper is None:
+        line += "{:>11} {:>7}".format("-", "-")
+    else:
+        line += "{:>11} {:>6.1f}x".format(viper, bc / viper)
+    print(line)
+
+
+def check():
+    assert isum_bc(N) == isum_native(N) == isum_viper(N)
+    expected = array.array("i", output)
+    fir_bc(samples, coeffs, expected, N, TAPS)
+    for fir in (fir_native, fir_viper):
+        result = array.array("i", output)
+        fir(samples, coeffs, result, N, TAPS)
+        assert result == expected, fir
+    assert dot_bc(xs, ys, N) == dot_native(xs, ys, N)
+
+
+check()
+print("best of {}, us".format(REPEAT))
+print(
+    "{:<8} {:>10} {:>10} {:>7} {:>10} {:>7}".format(
+        "kernel", "bytecode", "native", "", "viper", ""
+    )
+)
+row(
+    "isum",
+    measure(isum_bc, N),
+    measure(isum_native, N),
+    measure(isum_viper, N),
+)
+row(
+    "fir",
+    measure(fir_bc, samples, coeffs, output, N, TAPS),
+    measure(fir_native, samples, coeffs, output, N, TAPS),
+    measure(fir_viper, samples, coeffs, output, N, TAPS),
+)
+row("dot", measure(dot_bc, xs, ys, N), measure(dot_native, xs, ys, N), None)
+micropython.mem_info()
@@ -0,0 +1,48 @@
+# SD card throughput and latency: raw sectors and FatFs, sequential and
+# random, read and write, over request sizes and depths. Copy to the SD
+# card and run with
+#   import bench_sd
+# from the console, or as main.py. run() for one configuration, sweep()
+# with other sizes, depths or time.
+
+import array
+import carbon
+
+SIZES = (512, 4096, 16384, 65536)
+DEPTHS = (1, 4)
+TIME_MS = 2000
+
+results = array.array("I", range(7))
+
+
+def name(mode):
+    return "%-4s %-4s %-5s" % (
+        "file" if mode & carbon.SD_FILE else "raw",
+        "rand" if mode & carbon.SD_RANDOM else "seq",
+        "write" if mode & carbon.SD_WRITE else "read",
+    )
+
+
+# (MB/s, IOPS, requests, errors, p50, p90, p99, max us)
+def run(mode, size, depth=1, time_ms=TIME_MS):
+    carbon.sd_bench(results, mode, size, depth, time_ms)
+    requests, errors, elapsed = results[0], results[1], results[2]
+    mbs = requests * size / elapsed
+    iops = requests * 1000000 // elapsed
+    return (mbs, iops, requests, errors) + tuple(results[3:])
+
+
+def sweep(sizes=SIZES, depths=DEPTHS, time_ms=TIME_MS):
+    print("%-16s %6s %5s %8s %7s %7s %7s %7s %7s %6s" % (
+        "mode", "size", "depth", "MB/s", "IOPS", "p50", "p90", "p99",
+        "max", "errors"))
+    for mode in range(8):
+        for size in sizes:
+            for depth in depths:
+                r = run(mode, size, depth, time_ms)
+                print("%-16s %6d %5d %8.2f %7d %7d %7d %7d %7d %6d" % (
+                    name(mode), size, depth, r[0], r[1], r[4], r[5], r[6],
+                    r[7], r[3]))
+
+
+sweep()
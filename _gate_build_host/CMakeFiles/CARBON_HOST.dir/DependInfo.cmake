@@ -0,0 +1,73 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/CM7/core/src/app_ethernet.c" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/app_ethernet.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/app_ethernet.c.o.d"
+  "/root/repo/CM7/core/src/mp_port/gccollect.c" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/gccollect.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/gccollect.c.o.d"
+  "/root/repo/CM7/core/src/mp_port/mpcarbon.c" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpcarbon.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpcarbon.c.o.d"
+  "/root/repo/CM7/core/src/mp_port/mpgc.c" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpgc.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpgc.c.o.d"
+  "/root/repo/CM7/core/src/mp_port/mphalport.c" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mphalport.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mphalport.c.o.d"
+  "/root/repo/CM7/core/src/mp_port/mpprofile.c" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpprofile.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpprofile.c.o.d"
+  "/root/repo/CM7/core/src/mp_port/mpthreadport.c" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpthreadport.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpthreadport.c.o.d"
+  "/root/repo/CM7/core/src/mp_thread.c" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_thread.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_thread.c.o.d"
+  "/root/repo/CM7/core/src/netif_conf.c" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/netif_conf.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/netif_conf.c.o.d"
+  "/root/repo/common/src/setup_idle_task.c" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/setup_idle_task.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/setup_idle_task.c.o.d"
+  "/root/repo/host/src/cortex.c" "CMakeFiles/CARBON_HOST.dir/src/cortex.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/src/cortex.c.o.d"
+  "/root/repo/host/src/ethernetif.c" "CMakeFiles/CARBON_HOST.dir/src/ethernetif.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/src/ethernetif.c.o.d"
+  "/root/repo/host/src/hal.c" "CMakeFiles/CARBON_HOST.dir/src/hal.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/src/hal.c.o.d"
+  "/root/repo/host/src/interrupts.c" "CMakeFiles/CARBON_HOST.dir/src/interrupts.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/src/interrupts.c.o.d"
+  "/root/repo/host/src/syscalls.c" "CMakeFiles/CARBON_HOST.dir/src/syscalls.c.o" "gcc" "CMakeFiles/CARBON_HOST.dir/src/syscalls.c.o.d"
+  "/root/repo/CM7/core/src/boot.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/boot.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/boot.cpp.o.d"
+  "/root/repo/CM7/core/src/diag_thread.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/diag_thread.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/diag_thread.cpp.o.d"
+  "/root/repo/CM7/core/src/dma_buffer.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/dma_buffer.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/dma_buffer.cpp.o.d"
+  "/root/repo/CM7/core/src/ftp_thread.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/ftp_thread.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/ftp_thread.cpp.o.d"
+  "/root/repo/CM7/core/src/heap.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/heap.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/heap.cpp.o.d"
+  "/root/repo/CM7/core/src/hsem.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/hsem.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/hsem.cpp.o.d"
+  "/root/repo/CM7/core/src/modbus_master.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/modbus_master.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/modbus_master.cpp.o.d"
+  "/root/repo/CM7/core/src/mp_port/mpconsole.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpconsole.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpconsole.cpp.o.d"
+  "/root/repo/CM7/core/src/mp_port/user_module/mp_mod_carbon.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/user_module/mp_mod_carbon.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/user_module/mp_mod_carbon.cpp.o.d"
+  "/root/repo/CM7/core/src/mp_port/user_module/mp_mod_led.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/user_module/mp_mod_led.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/user_module/mp_mod_led.cpp.o.d"
+  "/root/repo/CM7/core/src/net_bench_thread.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/net_bench_thread.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/net_bench_thread.cpp.o.d"
+  "/root/repo/CM7/core/src/sd_bench.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/sd_bench.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/sd_bench.cpp.o.d"
+  "/root/repo/CM7/core/src/sd_thread.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/sd_thread.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/sd_thread.cpp.o.d"
+  "/root/repo/CM7/core/src/trace.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/trace.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/trace.cpp.o.d"
+  "/root/repo/CM7/core/src/trace_thread.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/trace_thread.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/trace_thread.cpp.o.d"
+  "/root/repo/common/src/common.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/common.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/common.cpp.o.d"
+  "/root/repo/common/src/completion.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/completion.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/completion.cpp.o.d"
+  "/root/repo/common/src/diag.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/diag.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/diag.cpp.o.d"
+  "/root/repo/common/src/error.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/error.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/error.cpp.o.d"
+  "/root/repo/common/src/freeRTOSTrace.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/freeRTOSTrace.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/freeRTOSTrace.cpp.o.d"
+  "/root/repo/common/src/hsem.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/hsem.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/hsem.cpp.o.d"
+  "/root/repo/common/src/irq.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/irq.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/irq.cpp.o.d"
+  "/root/repo/common/src/latency.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/latency.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/latency.cpp.o.d"
+  "/root/repo/common/src/registry.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/registry.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/registry.cpp.o.d"
+  "/root/repo/common/src/shared_memory.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/shared_memory.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/shared_memory.cpp.o.d"
+  "/root/repo/common/src/sys/cpp.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/sys/cpp.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/sys/cpp.cpp.o.d"
+  "/root/repo/common/src/sys/oshooks.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/sys/oshooks.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/sys/oshooks.cpp.o.d"
+  "/root/repo/common/src/timebase.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/timebase.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/timebase.cpp.o.d"
+  "/root/repo/common/src/timebase_estimator.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/timebase_estimator.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/timebase_estimator.cpp.o.d"
+  "/root/repo/common/src/tlsf.cpp" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/tlsf.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/tlsf.cpp.o.d"
+  "/root/repo/host/src/main.cpp" "CMakeFiles/CARBON_HOST.dir/src/main.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/src/main.cpp.o.d"
+  "/root/repo/host/src/main_thread.cpp" "CMakeFiles/CARBON_HOST.dir/src/main_thread.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/src/main_thread.cpp.o.d"
+  "/root/repo/host/src/sd_card.cpp" "CMakeFiles/CARBON_HOST.dir/src/sd_card.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/src/sd_card.cpp.o.d"
+  "/root/repo/host/src/systime.cpp" "CMakeFiles/CARBON_HOST.dir/src/systime.cpp.o" "gcc" "CMakeFiles/CARBON_HOST.dir/src/systime.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_host/printf/CMakeFiles/printf_CARBON_HOST.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_host/freertos/CMakeFiles/freertos_CARBON_HOST.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_host/lwip/CMakeFiles/lwip_CARBON_HOST.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_host/micropython/CMakeFiles/micropython_CARBON_HOST.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_host/fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_host/FTP/CMakeFiles/ftp_CARBON_HOST.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
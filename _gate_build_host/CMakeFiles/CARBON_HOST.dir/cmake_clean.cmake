@@ -0,0 +1,107 @@
+file(REMOVE_RECURSE
+  "CARBON_HOST"
+  "CARBON_HOST.pdb"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/app_ethernet.c.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/app_ethernet.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/boot.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/boot.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/diag_thread.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/diag_thread.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/dma_buffer.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/dma_buffer.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/ftp_thread.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/ftp_thread.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/heap.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/heap.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/hsem.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/hsem.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/modbus_master.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/modbus_master.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/gccollect.c.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/gccollect.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpcarbon.c.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpcarbon.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpconsole.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpconsole.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpgc.c.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpgc.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mphalport.c.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mphalport.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpprofile.c.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpprofile.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpthreadport.c.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/mpthreadport.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/user_module/mp_mod_carbon.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/user_module/mp_mod_carbon.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/user_module/mp_mod_led.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_port/user_module/mp_mod_led.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_thread.c.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/mp_thread.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/net_bench_thread.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/net_bench_thread.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/netif_conf.c.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/netif_conf.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/sd_bench.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/sd_bench.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/sd_thread.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/sd_thread.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/trace.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/trace.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/trace_thread.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/CM7/core/src/trace_thread.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/common.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/common.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/completion.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/completion.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/diag.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/diag.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/error.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/error.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/freeRTOSTrace.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/freeRTOSTrace.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/hsem.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/hsem.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/irq.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/irq.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/latency.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/latency.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/registry.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/registry.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/setup_idle_task.c.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/setup_idle_task.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/shared_memory.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/shared_memory.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/sys/cpp.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/sys/cpp.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/sys/oshooks.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/sys/oshooks.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/timebase.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/timebase.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/timebase_estimator.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/timebase_estimator.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/tlsf.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/root/repo/common/src/tlsf.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/src/cortex.c.o"
+  "CMakeFiles/CARBON_HOST.dir/src/cortex.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/src/ethernetif.c.o"
+  "CMakeFiles/CARBON_HOST.dir/src/ethernetif.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/src/hal.c.o"
+  "CMakeFiles/CARBON_HOST.dir/src/hal.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/src/interrupts.c.o"
+  "CMakeFiles/CARBON_HOST.dir/src/interrupts.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/src/main.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/src/main.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/src/main_thread.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/src/main_thread.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/src/sd_card.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/src/sd_card.cpp.o.d"
+  "CMakeFiles/CARBON_HOST.dir/src/syscalls.c.o"
+  "CMakeFiles/CARBON_HOST.dir/src/syscalls.c.o.d"
+  "CMakeFiles/CARBON_HOST.dir/src/systime.cpp.o"
+  "CMakeFiles/CARBON_HOST.dir/src/systime.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/CARBON_HOST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
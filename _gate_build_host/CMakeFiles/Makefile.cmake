@@ -0,0 +1,86 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/common/cmake/flags.cmake"
+  "/root/repo/host/CMakeLists.txt"
+  "/root/repo/lib/CMSIS/CMakeLists.txt"
+  "/root/repo/lib/FTP/CMakeLists.txt"
+  "/root/repo/lib/fatfs/CMakeLists.txt"
+  "/root/repo/lib/freertos/CMakeLists.txt"
+  "/root/repo/lib/hal/CMakeLists.txt"
+  "/root/repo/lib/lwip/CMakeLists.txt"
+  "/root/repo/lib/micropython/CMakeLists.txt"
+  "/root/repo/lib/micropython/micropython/extmod/extmod.cmake"
+  "/root/repo/lib/micropython/micropython/py/mkrules.cmake"
+  "/root/repo/lib/micropython/micropython/py/py.cmake"
+  "/root/repo/lib/printf/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "cmsis/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "printf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "freertos/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lwip/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "micropython/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fatfs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "FTP/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/CARBON_HOST.dir/DependInfo.cmake"
+  "printf/CMakeFiles/printf_CARBON_HOST.dir/DependInfo.cmake"
+  "freertos/CMakeFiles/freertos_CARBON_HOST.dir/DependInfo.cmake"
+  "lwip/CMakeFiles/lwip_CARBON_HOST.dir/DependInfo.cmake"
+  "micropython/CMakeFiles/micropython_CARBON_HOST.dir/DependInfo.cmake"
+  "micropython/CMakeFiles/BUILD_VERSION_HEADER.dir/DependInfo.cmake"
+  "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/DependInfo.cmake"
+  "FTP/CMakeFiles/ftp_CARBON_HOST.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/FTP/src/ftp.c" "FTP/CMakeFiles/ftp_CARBON_HOST.dir/src/ftp.c.o" "gcc" "FTP/CMakeFiles/ftp_CARBON_HOST.dir/src/ftp.c.o.d"
+  "/root/repo/lib/FTP/src/ftp_file.c" "FTP/CMakeFiles/ftp_CARBON_HOST.dir/src/ftp_file.c.o" "gcc" "FTP/CMakeFiles/ftp_CARBON_HOST.dir/src/ftp_file.c.o.d"
+  "/root/repo/lib/FTP/src/ftp_server.c" "FTP/CMakeFiles/ftp_CARBON_HOST.dir/src/ftp_server.c.o" "gcc" "FTP/CMakeFiles/ftp_CARBON_HOST.dir/src/ftp_server.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_host/freertos/CMakeFiles/freertos_CARBON_HOST.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_host/lwip/CMakeFiles/lwip_CARBON_HOST.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_host/fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_host/printf/CMakeFiles/printf_CARBON_HOST.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftp_CARBON_HOST.dir/src/ftp.c.o"
+  "CMakeFiles/ftp_CARBON_HOST.dir/src/ftp.c.o.d"
+  "CMakeFiles/ftp_CARBON_HOST.dir/src/ftp_file.c.o"
+  "CMakeFiles/ftp_CARBON_HOST.dir/src/ftp_file.c.o.d"
+  "CMakeFiles/ftp_CARBON_HOST.dir/src/ftp_server.c.o"
+  "CMakeFiles/ftp_CARBON_HOST.dir/src/ftp_server.c.o.d"
+  "libftp_CARBON_HOST.a"
+  "libftp_CARBON_HOST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ftp_CARBON_HOST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
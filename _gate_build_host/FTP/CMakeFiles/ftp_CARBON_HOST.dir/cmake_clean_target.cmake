@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libftp_CARBON_HOST.a"
+)
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/fatfs/src/diskio.c" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/diskio.c.o" "gcc" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/diskio.c.o.d"
+  "/root/repo/lib/fatfs/src/ff.c" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/ff.c.o" "gcc" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/ff.c.o.d"
+  "/root/repo/lib/fatfs/src/ff_gen_drv.c" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/ff_gen_drv.c.o" "gcc" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/ff_gen_drv.c.o.d"
+  "/root/repo/lib/fatfs/src/io_utils.c" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/io_utils.c.o" "gcc" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/io_utils.c.o.d"
+  "/root/repo/lib/fatfs/src/option/ccsbcs.c" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/option/ccsbcs.c.o" "gcc" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/option/ccsbcs.c.o.d"
+  "/root/repo/lib/fatfs/src/option/syscall.c" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/option/syscall.c.o" "gcc" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/option/syscall.c.o.d"
+  "/root/repo/lib/fatfs/src/option/unicode.c" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/option/unicode.c.o" "gcc" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/option/unicode.c.o.d"
+  "/root/repo/lib/fatfs/src/sd_diskio.c" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/sd_diskio.c.o" "gcc" "fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/src/sd_diskio.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_host/freertos/CMakeFiles/freertos_CARBON_HOST.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/diskio.c.o"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/diskio.c.o.d"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/ff.c.o"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/ff.c.o.d"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/ff_gen_drv.c.o"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/ff_gen_drv.c.o.d"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/io_utils.c.o"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/io_utils.c.o.d"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/option/ccsbcs.c.o"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/option/ccsbcs.c.o.d"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/option/syscall.c.o"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/option/syscall.c.o.d"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/option/unicode.c.o"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/option/unicode.c.o.d"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/sd_diskio.c.o"
+  "CMakeFiles/fatfs_CARBON_HOST.dir/src/sd_diskio.c.o.d"
+  "libfatfs_CARBON_HOST.a"
+  "libfatfs_CARBON_HOST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/fatfs_CARBON_HOST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
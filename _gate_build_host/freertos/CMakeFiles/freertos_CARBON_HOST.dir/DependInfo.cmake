@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/freertos/CMSIS_RTOS/cmsis_os.c" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/CMSIS_RTOS/cmsis_os.c.o" "gcc" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/CMSIS_RTOS/cmsis_os.c.o.d"
+  "/root/repo/lib/freertos/croutine.c" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/croutine.c.o" "gcc" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/croutine.c.o.d"
+  "/root/repo/lib/freertos/event_groups.c" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/event_groups.c.o" "gcc" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/event_groups.c.o.d"
+  "/root/repo/lib/freertos/list.c" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/list.c.o" "gcc" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/list.c.o.d"
+  "/root/repo/lib/freertos/portable/GCC/Posix/port.c" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/portable/GCC/Posix/port.c.o" "gcc" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/portable/GCC/Posix/port.c.o.d"
+  "/root/repo/lib/freertos/queue.c" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/queue.c.o" "gcc" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/queue.c.o.d"
+  "/root/repo/lib/freertos/stream_buffer.c" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/stream_buffer.c.o" "gcc" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/stream_buffer.c.o.d"
+  "/root/repo/lib/freertos/tasks.c" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/tasks.c.o" "gcc" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/tasks.c.o.d"
+  "/root/repo/lib/freertos/timers.c" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/timers.c.o" "gcc" "freertos/CMakeFiles/freertos_CARBON_HOST.dir/timers.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/freertos_CARBON_HOST.dir/CMSIS_RTOS/cmsis_os.c.o"
+  "CMakeFiles/freertos_CARBON_HOST.dir/CMSIS_RTOS/cmsis_os.c.o.d"
+  "CMakeFiles/freertos_CARBON_HOST.dir/croutine.c.o"
+  "CMakeFiles/freertos_CARBON_HOST.dir/croutine.c.o.d"
+  "CMakeFiles/freertos_CARBON_HOST.dir/event_groups.c.o"
+  "CMakeFiles/freertos_CARBON_HOST.dir/event_groups.c.o.d"
+  "CMakeFiles/freertos_CARBON_HOST.dir/list.c.o"
+  "CMakeFiles/freertos_CARBON_HOST.dir/list.c.o.d"
+  "CMakeFiles/freertos_CARBON_HOST.dir/portable/GCC/Posix/port.c.o"
+  "CMakeFiles/freertos_CARBON_HOST.dir/portable/GCC/Posix/port.c.o.d"
+  "CMakeFiles/freertos_CARBON_HOST.dir/queue.c.o"
+  "CMakeFiles/freertos_CARBON_HOST.dir/queue.c.o.d"
+  "CMakeFiles/freertos_CARBON_HOST.dir/stream_buffer.c.o"
+  "CMakeFiles/freertos_CARBON_HOST.dir/stream_buffer.c.o.d"
+  "CMakeFiles/freertos_CARBON_HOST.dir/tasks.c.o"
+  "CMakeFiles/freertos_CARBON_HOST.dir/tasks.c.o.d"
+  "CMakeFiles/freertos_CARBON_HOST.dir/timers.c.o"
+  "CMakeFiles/freertos_CARBON_HOST.dir/timers.c.o.d"
+  "libfreertos_CARBON_HOST.a"
+  "libfreertos_CARBON_HOST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/freertos_CARBON_HOST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libfreertos_CARBON_HOST.a"
+)
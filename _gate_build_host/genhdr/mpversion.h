@@ -0,0 +1,4 @@
+// This file was generated by py/makeversionhdr.py
+#define MICROPY_GIT_TAG "b7cefe4-dirty"
+#define MICROPY_GIT_HASH "b7cefe4"
+#define MICROPY_BUILD_DATE "2026-10-19"
@@ -0,0 +1,403 @@
+// This file was automatically generated by makeqstrdata.py
+
+QDEF0(MP_QSTRnull, 0, 0, "")
+QDEF0(MP_QSTR_, 5, 0, "")
+QDEF0(MP_QSTR___dir__, 122, 7, "__dir__")
+QDEF0(MP_QSTR__0x0a_, 175, 1, "\x0a")
+QDEF0(MP_QSTR__space_, 133, 1, " ")
+QDEF0(MP_QSTR__star_, 143, 1, "*")
+QDEF0(MP_QSTR__slash_, 138, 1, "/")
+QDEF0(MP_QSTR__lt_module_gt_, 189, 8, "<module>")
+QDEF0(MP_QSTR__, 250, 1, "_")
+QDEF0(MP_QSTR___call__, 167, 8, "__call__")
+QDEF0(MP_QSTR___class__, 43, 9, "__class__")
+QDEF0(MP_QSTR___delitem__, 253, 11, "__delitem__")
+QDEF0(MP_QSTR___enter__, 109, 9, "__enter__")
+QDEF0(MP_QSTR___exit__, 69, 8, "__exit__")
+QDEF0(MP_QSTR___getattr__, 64, 11, "__getattr__")
+QDEF0(MP_QSTR___getitem__, 38, 11, "__getitem__")
+QDEF0(MP_QSTR___hash__, 247, 8, "__hash__")
+QDEF0(MP_QSTR___init__, 95, 8, "__init__")
+QDEF0(MP_QSTR___int__, 22, 7, "__int__")
+QDEF0(MP_QSTR___iter__, 207, 8, "__iter__")
+QDEF0(MP_QSTR___len__, 226, 7, "__len__")
+QDEF0(MP_QSTR___main__, 142, 8, "__main__")
+QDEF0(MP_QSTR___module__, 255, 10, "__module__")
+QDEF0(MP_QSTR___name__, 226, 8, "__name__")
+QDEF0(MP_QSTR___new__, 121, 7, "__new__")
+QDEF0(MP_QSTR___next__, 2, 8, "__next__")
+QDEF0(MP_QSTR___qualname__, 107, 12, "__qualname__")
+QDEF0(MP_QSTR___repr__, 16, 8, "__repr__")
+QDEF0(MP_QSTR___setitem__, 50, 11, "__setitem__")
+QDEF0(MP_QSTR___str__, 208, 7, "__str__")
+QDEF0(MP_QSTR_ArithmeticError, 45, 15, "ArithmeticError")
+QDEF0(MP_QSTR_AssertionError, 151, 14, "AssertionError")
+QDEF0(MP_QSTR_AttributeError, 33, 14, "AttributeError")
+QDEF0(MP_QSTR_BaseException, 7, 13, "BaseException")
+QDEF0(MP_QSTR_EOFError, 145, 8, "EOFError")
+QDEF0(MP_QSTR_Ellipsis, 240, 8, "Ellipsis")
+QDEF0(MP_QSTR_Exception, 242, 9, "Exception")
+QDEF0(MP_QSTR_GeneratorExit, 22, 13, "GeneratorExit")
+QDEF0(MP_QSTR_ImportError, 32, 11, "ImportError")
+QDEF0(MP_QSTR_IndentationError, 92, 16, "IndentationError")
+QDEF0(MP_QSTR_IndexError, 131, 10, "IndexError")
+QDEF0(MP_QSTR_KeyError, 234, 8, "KeyError")
+QDEF0(MP_QSTR_KeyboardInterrupt, 175, 17, "KeyboardInterrupt")
+QDEF0(MP_QSTR_LookupError, 255, 11, "LookupError")
+QDEF0(MP_QSTR_MemoryError, 220, 11, "MemoryError")
+QDEF0(MP_QSTR_NameError, 186, 9, "NameError")
+QDEF0(MP_QSTR_NoneType, 23, 8, "NoneType")
+QDEF0(MP_QSTR_NotImplementedError, 198, 19, "NotImplementedError")
+QDEF0(MP_QSTR_OSError, 161, 7, "OSError")
+QDEF0(MP_QSTR_OverflowError, 129, 13, "OverflowError")
+QDEF0(MP_QSTR_RuntimeError, 97, 12, "RuntimeError")
+QDEF0(MP_QSTR_StopIteration, 234, 13, "StopIteration")
+QDEF0(MP_QSTR_SyntaxError, 148, 11, "SyntaxError")
+QDEF0(MP_QSTR_SystemExit, 32, 10, "SystemExit")
+QDEF0(MP_QSTR_TypeError, 37, 9, "TypeError")
+QDEF0(MP_QSTR_ValueError, 150, 10, "ValueError")
+QDEF0(MP_QSTR_ZeroDivisionError, 182, 17, "ZeroDivisionError")
+QDEF0(MP_QSTR_abs, 149, 3, "abs")
+QDEF0(MP_QSTR_all, 68, 3, "all")
+QDEF0(MP_QSTR_any, 19, 3, "any")
+QDEF0(MP_QSTR_append, 107, 6, "append")
+QDEF0(MP_QSTR_args, 194, 4, "args")
+QDEF0(MP_QSTR_bool, 235, 4, "bool")
+QDEF0(MP_QSTR_builtins, 247, 8, "builtins")
+QDEF0(MP_QSTR_bytearray, 118, 9, "bytearray")
+QDEF0(MP_QSTR_bytecode, 34, 8, "bytecode")
+QDEF0(MP_QSTR_bytes, 92, 5, "bytes")
+QDEF0(MP_QSTR_callable, 13, 8, "callable")
+QDEF0(MP_QSTR_chr, 220, 3, "chr")
+QDEF0(MP_QSTR_classmethod, 180, 11, "classmethod")
+QDEF0(MP_QSTR_clear, 124, 5, "clear")
+QDEF0(MP_QSTR_close, 51, 5, "close")
+QDEF0(MP_QSTR_const, 192, 5, "const")
+QDEF0(MP_QSTR_copy, 224, 4, "copy")
+QDEF0(MP_QSTR_count, 166, 5, "count")
+QDEF0(MP_QSTR_dict, 63, 4, "dict")
+QDEF0(MP_QSTR_dir, 250, 3, "dir")
+QDEF0(MP_QSTR_divmod, 184, 6, "divmod")
+QDEF0(MP_QSTR_end, 10, 3, "end")
+QDEF0(MP_QSTR_endswith, 27, 8, "endswith")
+QDEF0(MP_QSTR_eval, 155, 4, "eval")
+QDEF0(MP_QSTR_exec, 30, 4, "exec")
+QDEF0(MP_QSTR_extend, 99, 6, "extend")
+QDEF0(MP_QSTR_find, 1, 4, "find")
+QDEF0(MP_QSTR_format, 38, 6, "format")
+QDEF0(MP_QSTR_from_bytes, 53, 10, "from_bytes")
+QDEF0(MP_QSTR_get, 51, 3, "get")
+QDEF0(MP_QSTR_getattr, 192, 7, "getattr")
+QDEF0(MP_QSTR_globals, 157, 7, "globals")
+QDEF0(MP_QSTR_hasattr, 140, 7, "hasattr")
+QDEF0(MP_QSTR_hash, 183, 4, "hash")
+QDEF0(MP_QSTR_id, 40, 2, "id")
+QDEF0(MP_QSTR_index, 123, 5, "index")
+QDEF0(MP_QSTR_insert, 18, 6, "insert")
+QDEF0(MP_QSTR_int, 22, 3, "int")
+QDEF0(MP_QSTR_isalpha, 235, 7, "isalpha")
+QDEF0(MP_QSTR_isdigit, 168, 7, "isdigit")
+QDEF0(MP_QSTR_isinstance, 182, 10, "isinstance")
+QDEF0(MP_QSTR_islower, 252, 7, "islower")
+QDEF0(MP_QSTR_isspace, 91, 7, "isspace")
+QDEF0(MP_QSTR_issubclass, 181, 10, "issubclass")
+QDEF0(MP_QSTR_isupper, 221, 7, "isupper")
+QDEF0(MP_QSTR_items, 227, 5, "items")
+QDEF0(MP_QSTR_iter, 143, 4, "iter")
+QDEF0(MP_QSTR_join, 167, 4, "join")
+QDEF0(MP_QSTR_key, 50, 3, "key")
+QDEF0(MP_QSTR_keys, 1, 4, "keys")
+QDEF0(MP_QSTR_len, 98, 3, "len")
+QDEF0(MP_QSTR_list, 39, 4, "list")
+QDEF0(MP_QSTR_little, 137, 6, "little")
+QDEF0(MP_QSTR_locals, 59, 6, "locals")
+QDEF0(MP_QSTR_lower, 198, 5, "lower")
+QDEF0(MP_QSTR_lstrip, 229, 6, "lstrip")
+QDEF0(MP_QSTR_main, 206, 4, "main")
+QDEF0(MP_QSTR_map, 185, 3, "map")
+QDEF0(MP_QSTR_micropython, 11, 11, "micropython")
+QDEF0(MP_QSTR_next, 66, 4, "next")
+QDEF0(MP_QSTR_object, 144, 6, "object")
+QDEF0(MP_QSTR_open, 209, 4, "open")
+QDEF0(MP_QSTR_ord, 28, 3, "ord")
+QDEF0(MP_QSTR_pop, 42, 3, "pop")
+QDEF0(MP_QSTR_popitem, 191, 7, "popitem")
+QDEF0(MP_QSTR_pow, 45, 3, "pow")
+QDEF0(MP_QSTR_print, 84, 5, "print")
+QDEF0(MP_QSTR_range, 26, 5, "range")
+QDEF0(MP_QSTR_read, 183, 4, "read")
+QDEF0(MP_QSTR_readinto, 75, 8, "readinto")
+QDEF0(MP_QSTR_readline, 249, 8, "readline")
+QDEF0(MP_QSTR_remove, 99, 6, "remove")
+QDEF0(MP_QSTR_replace, 73, 7, "replace")
+QDEF0(MP_QSTR_repr, 208, 4, "repr")
+QDEF0(MP_QSTR_reverse, 37, 7, "reverse")
+QDEF0(MP_QSTR_rfind, 210, 5, "rfind")
+QDEF0(MP_QSTR_rindex, 233, 6, "rindex")
+QDEF0(MP_QSTR_round, 231, 5, "round")
+QDEF0(MP_QSTR_rsplit, 165, 6, "rsplit")
+QDEF0(MP_QSTR_rstrip, 59, 6, "rstrip")
+QDEF0(MP_QSTR_self, 121, 4, "self")
+QDEF0(MP_QSTR_send, 185, 4, "send")
+QDEF0(MP_QSTR_sep, 35, 3, "sep")
+QDEF0(MP_QSTR_set, 39, 3, "set")
+QDEF0(MP_QSTR_setattr, 212, 7, "setattr")
+QDEF0(MP_QSTR_setdefault, 108, 10, "setdefault")
+QDEF0(MP_QSTR_sort, 191, 4, "sort")
+QDEF0(MP_QSTR_sorted, 94, 6, "sorted")
+QDEF0(MP_QSTR_split, 183, 5, "split")
+QDEF0(MP_QSTR_start, 133, 5, "start")
+QDEF0(MP_QSTR_startswith, 116, 10, "startswith")
+QDEF0(MP_QSTR_staticmethod, 98, 12, "staticmethod")
+QDEF0(MP_QSTR_step, 87, 4, "step")
+QDEF0(MP_QSTR_stop, 157, 4, "stop")
+QDEF0(MP_QSTR_str, 80, 3, "str")
+QDEF0(MP_QSTR_strip, 41, 5, "strip")
+QDEF0(MP_QSTR_sum, 46, 3, "sum")
+QDEF0(MP_QSTR_super, 196, 5, "super")
+QDEF0(MP_QSTR_throw, 179, 5, "throw")
+QDEF0(MP_QSTR_to_bytes, 216, 8, "to_bytes")
+QDEF0(MP_QSTR_tuple, 253, 5, "tuple")
+QDEF0(MP_QSTR_type, 157, 4, "type")
+QDEF0(MP_QSTR_update, 180, 6, "update")
+QDEF0(MP_QSTR_upper, 39, 5, "upper")
+QDEF0(MP_QSTR_utf_hyphen_8, 183, 5, "utf-8")
+QDEF0(MP_QSTR_value, 78, 5, "value")
+QDEF0(MP_QSTR_values, 125, 6, "values")
+QDEF0(MP_QSTR_write, 152, 5, "write")
+QDEF0(MP_QSTR_zip, 230, 3, "zip")
+QDEF1(MP_QSTR__percent__hash_o, 108, 3, "%#o")
+QDEF1(MP_QSTR__percent__hash_x, 123, 3, "%#x")
+QDEF1(MP_QSTR__dot__dot__dot__space_, 139, 4, "... ")
+QDEF1(MP_QSTR__slash_lib, 141, 4, "/lib")
+QDEF0(MP_QSTR__lt_dictcomp_gt_, 204, 10, "<dictcomp>")
+QDEF0(MP_QSTR__lt_genexpr_gt_, 52, 9, "<genexpr>")
+QDEF0(MP_QSTR__lt_lambda_gt_, 128, 8, "<lambda>")
+QDEF0(MP_QSTR__lt_listcomp_gt_, 212, 10, "<listcomp>")
+QDEF0(MP_QSTR__lt_setcomp_gt_, 84, 9, "<setcomp>")
+QDEF1(MP_QSTR__lt_stdin_gt_, 227, 7, "<stdin>")
+QDEF1(MP_QSTR__lt_string_gt_, 82, 8, "<string>")
+QDEF1(MP_QSTR__gt__gt__gt__space_, 155, 4, ">>> ")
+QDEF1(MP_QSTR_BytesIO, 26, 7, "BytesIO")
+QDEF1(MP_QSTR_FileIO, 197, 6, "FileIO")
+QDEF1(MP_QSTR_LockType, 54, 8, "LockType")
+QDEF1(MP_QSTR_None, 111, 4, "None")
+QDEF1(MP_QSTR_REGISTRY_CM4, 53, 12, "REGISTRY_CM4")
+QDEF1(MP_QSTR_REGISTRY_MODBUS, 141, 15, "REGISTRY_MODBUS")
+QDEF1(MP_QSTR_REGISTRY_NET_LINK, 143, 17, "REGISTRY_NET_LINK")
+QDEF1(MP_QSTR_REGISTRY_SD_CARD, 147, 16, "REGISTRY_SD_CARD")
+QDEF1(MP_QSTR_SD_FILE, 107, 7, "SD_FILE")
+QDEF1(MP_QSTR_SD_RANDOM, 22, 9, "SD_RANDOM")
+QDEF1(MP_QSTR_SD_WRITE, 208, 8, "SD_WRITE")
+QDEF1(MP_QSTR_StopAsyncIteration, 236, 18, "StopAsyncIteration")
+QDEF1(MP_QSTR_StringIO, 118, 8, "StringIO")
+QDEF1(MP_QSTR_TextIOWrapper, 173, 13, "TextIOWrapper")
+QDEF1(MP_QSTR_ViperTypeError, 221, 14, "ViperTypeError")
+QDEF0(MP_QSTR___add__, 196, 7, "__add__")
+QDEF1(MP_QSTR___aenter__, 76, 10, "__aenter__")
+QDEF1(MP_QSTR___aexit__, 196, 9, "__aexit__")
+QDEF1(MP_QSTR___aiter__, 78, 9, "__aiter__")
+QDEF1(MP_QSTR___anext__, 131, 9, "__anext__")
+QDEF1(MP_QSTR___bases__, 3, 9, "__bases__")
+QDEF0(MP_QSTR___bool__, 43, 8, "__bool__")
+QDEF1(MP_QSTR___build_class__, 66, 15, "__build_class__")
+QDEF0(MP_QSTR___complex__, 197, 11, "__complex__")
+QDEF0(MP_QSTR___contains__, 198, 12, "__contains__")
+QDEF1(MP_QSTR___del__, 104, 7, "__del__")
+QDEF1(MP_QSTR___dict__, 127, 8, "__dict__")
+QDEF0(MP_QSTR___eq__, 113, 6, "__eq__")
+QDEF1(MP_QSTR___file__, 3, 8, "__file__")
+QDEF0(MP_QSTR___float__, 53, 9, "__float__")
+QDEF0(MP_QSTR___ge__, 167, 6, "__ge__")
+QDEF0(MP_QSTR___gt__, 182, 6, "__gt__")
+QDEF0(MP_QSTR___iadd__, 109, 8, "__iadd__")
+QDEF1(MP_QSTR___import__, 56, 10, "__import__")
+QDEF0(MP_QSTR___isub__, 8, 8, "__isub__")
+QDEF0(MP_QSTR___le__, 204, 6, "__le__")
+QDEF0(MP_QSTR___lt__, 93, 6, "__lt__")
+QDEF0(MP_QSTR___ne__, 14, 6, "__ne__")
+QDEF1(MP_QSTR___path__, 200, 8, "__path__")
+QDEF1(MP_QSTR___repl_print__, 1, 14, "__repl_print__")
+QDEF1(MP_QSTR___reversed__, 97, 12, "__reversed__")
+QDEF0(MP_QSTR___sub__, 33, 7, "__sub__")
+QDEF1(MP_QSTR___traceback__, 79, 13, "__traceback__")
+QDEF1(MP_QSTR__machine, 191, 8, "_machine")
+QDEF1(MP_QSTR__mpy, 94, 4, "_mpy")
+QDEF1(MP_QSTR__thread, 212, 7, "_thread")
+QDEF1(MP_QSTR_acos, 27, 4, "acos")
+QDEF1(MP_QSTR_acquire, 29, 7, "acquire")
+QDEF1(MP_QSTR_add, 68, 3, "add")
+QDEF1(MP_QSTR_allocate_lock, 236, 13, "allocate_lock")
+QDEF1(MP_QSTR_argv, 199, 4, "argv")
+QDEF1(MP_QSTR_array, 124, 5, "array")
+QDEF1(MP_QSTR_asin, 80, 4, "asin")
+QDEF1(MP_QSTR_atan, 31, 4, "atan")
+QDEF1(MP_QSTR_atan2, 205, 5, "atan2")
+QDEF1(MP_QSTR_bin, 224, 3, "bin")
+QDEF1(MP_QSTR_bound_method, 151, 12, "bound_method")
+QDEF1(MP_QSTR_byteorder, 97, 9, "byteorder")
+QDEF1(MP_QSTR_calcsize, 77, 8, "calcsize")
+QDEF1(MP_QSTR_carbon, 22, 6, "carbon")
+QDEF1(MP_QSTR_ceil, 6, 4, "ceil")
+QDEF1(MP_QSTR_closure, 116, 7, "closure")
+QDEF1(MP_QSTR_cmath, 182, 5, "cmath")
+QDEF1(MP_QSTR_code, 104, 4, "code")
+QDEF1(MP_QSTR_collect, 155, 7, "collect")
+QDEF1(MP_QSTR_collections, 224, 11, "collections")
+QDEF1(MP_QSTR_compile, 244, 7, "compile")
+QDEF1(MP_QSTR_complex, 197, 7, "complex")
+QDEF1(MP_QSTR_copysign, 51, 8, "copysign")
+QDEF1(MP_QSTR_cos, 122, 3, "cos")
+QDEF1(MP_QSTR_cycles, 166, 6, "cycles")
+QDEF1(MP_QSTR_cycles_per_us, 103, 13, "cycles_per_us")
+QDEF1(MP_QSTR_decode, 169, 6, "decode")
+QDEF1(MP_QSTR_default, 206, 7, "default")
+QDEF1(MP_QSTR_degrees, 2, 7, "degrees")
+QDEF1(MP_QSTR_delattr, 219, 7, "delattr")
+QDEF1(MP_QSTR_deleter, 110, 7, "deleter")
+QDEF1(MP_QSTR_dict_view, 45, 9, "dict_view")
+QDEF1(MP_QSTR_difference, 114, 10, "difference")
+QDEF1(MP_QSTR_difference_update, 156, 17, "difference_update")
+QDEF1(MP_QSTR_disable, 145, 7, "disable")
+QDEF1(MP_QSTR_discard, 15, 7, "discard")
+QDEF1(MP_QSTR_doc, 45, 3, "doc")
+QDEF1(MP_QSTR_dump, 233, 4, "dump")
+QDEF1(MP_QSTR_e, 192, 1, "e")
+QDEF1(MP_QSTR_enable, 4, 6, "enable")
+QDEF1(MP_QSTR_encode, 67, 6, "encode")
+QDEF1(MP_QSTR_enumerate, 113, 9, "enumerate")
+QDEF1(MP_QSTR_errno, 193, 5, "errno")
+QDEF1(MP_QSTR_exit, 133, 4, "exit")
+QDEF1(MP_QSTR_exp, 200, 3, "exp")
+QDEF1(MP_QSTR_fabs, 147, 4, "fabs")
+QDEF1(MP_QSTR_file, 195, 4, "file")
+QDEF1(MP_QSTR_filter, 37, 6, "filter")
+QDEF1(MP_QSTR_float, 53, 5, "float")
+QDEF1(MP_QSTR_floor, 125, 5, "floor")
+QDEF1(MP_QSTR_flush, 97, 5, "flush")
+QDEF1(MP_QSTR_fmod, 229, 4, "fmod")
+QDEF1(MP_QSTR_frexp, 28, 5, "frexp")
+QDEF1(MP_QSTR_fromkeys, 55, 8, "fromkeys")
+QDEF1(MP_QSTR_function, 39, 8, "function")
+QDEF1(MP_QSTR_gc, 97, 2, "gc")
+QDEF1(MP_QSTR_generator, 150, 9, "generator")
+QDEF1(MP_QSTR_get_ident, 254, 9, "get_ident")
+QDEF1(MP_QSTR_getter, 144, 6, "getter")
+QDEF1(MP_QSTR_getvalue, 120, 8, "getvalue")
+QDEF1(MP_QSTR_group, 186, 5, "group")
+QDEF1(MP_QSTR_heap_lock, 173, 9, "heap_lock")
+QDEF1(MP_QSTR_heap_unlock, 86, 11, "heap_unlock")
+QDEF1(MP_QSTR_help, 148, 4, "help")
+QDEF1(MP_QSTR_hex, 112, 3, "hex")
+QDEF1(MP_QSTR_imag, 71, 4, "imag")
+QDEF1(MP_QSTR_implementation, 23, 14, "implementation")
+QDEF1(MP_QSTR_intersection, 40, 12, "intersection")
+QDEF1(MP_QSTR_intersection_update, 6, 19, "intersection_update")
+QDEF1(MP_QSTR_io, 35, 2, "io")
+QDEF1(MP_QSTR_isdisjoint, 247, 10, "isdisjoint")
+QDEF1(MP_QSTR_isenabled, 154, 9, "isenabled")
+QDEF1(MP_QSTR_isfinite, 166, 8, "isfinite")
+QDEF1(MP_QSTR_isinf, 62, 5, "isinf")
+QDEF1(MP_QSTR_isnan, 158, 5, "isnan")
+QDEF1(MP_QSTR_issubset, 185, 8, "issubset")
+QDEF1(MP_QSTR_issuperset, 252, 10, "issuperset")
+QDEF1(MP_QSTR_iterable, 37, 8, "iterable")
+QDEF1(MP_QSTR_iterator, 71, 8, "iterator")
+QDEF1(MP_QSTR_kbd_intr, 246, 8, "kbd_intr")
+QDEF1(MP_QSTR_latency, 173, 7, "latency")
+QDEF1(MP_QSTR_ldexp, 64, 5, "ldexp")
+QDEF1(MP_QSTR_led, 104, 3, "led")
+QDEF1(MP_QSTR_lock, 174, 4, "lock")
+QDEF1(MP_QSTR_locked, 15, 6, "locked")
+QDEF1(MP_QSTR_log, 33, 3, "log")
+QDEF1(MP_QSTR_match, 150, 5, "match")
+QDEF1(MP_QSTR_math, 53, 4, "math")
+QDEF1(MP_QSTR_max, 177, 3, "max")
+QDEF1(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, 115, 32, "maximum recursion depth exceeded")
+QDEF1(MP_QSTR_mem_alloc, 82, 9, "mem_alloc")
+QDEF1(MP_QSTR_mem_free, 203, 8, "mem_free")
+QDEF1(MP_QSTR_mem_info, 209, 8, "mem_info")
+QDEF1(MP_QSTR_min, 175, 3, "min")
+QDEF1(MP_QSTR_modbus_read, 202, 11, "modbus_read")
+QDEF1(MP_QSTR_mode, 38, 4, "mode")
+QDEF1(MP_QSTR_modf, 37, 4, "modf")
+QDEF1(MP_QSTR_module, 191, 6, "module")
+QDEF1(MP_QSTR_modules, 236, 7, "modules")
+QDEF1(MP_QSTR_name, 162, 4, "name")
+QDEF1(MP_QSTR_namedtuple, 30, 10, "namedtuple")
+QDEF1(MP_QSTR_native, 132, 6, "native")
+QDEF1(MP_QSTR_oct, 253, 3, "oct")
+QDEF1(MP_QSTR_opt_level, 135, 9, "opt_level")
+QDEF1(MP_QSTR_pack, 188, 4, "pack")
+QDEF1(MP_QSTR_pack_into, 31, 9, "pack_into")
+QDEF1(MP_QSTR_path, 136, 4, "path")
+QDEF1(MP_QSTR_pend_throw, 243, 10, "pend_throw")
+QDEF1(MP_QSTR_phase, 106, 5, "phase")
+QDEF1(MP_QSTR_pi, 28, 2, "pi")
+QDEF1(MP_QSTR_polar, 5, 5, "polar")
+QDEF1(MP_QSTR_print_exception, 28, 15, "print_exception")
+QDEF1(MP_QSTR_probe, 79, 5, "probe")
+QDEF1(MP_QSTR_profile, 78, 7, "profile")
+QDEF1(MP_QSTR_profile_dump, 61, 12, "profile_dump")
+QDEF1(MP_QSTR_profile_reset, 68, 13, "profile_reset")
+QDEF1(MP_QSTR_property, 194, 8, "property")
+QDEF1(MP_QSTR_ps1, 247, 3, "ps1")
+QDEF1(MP_QSTR_ps2, 244, 3, "ps2")
+QDEF1(MP_QSTR_ptr, 83, 3, "ptr")
+QDEF1(MP_QSTR_ptr16, 244, 5, "ptr16")
+QDEF1(MP_QSTR_ptr32, 178, 5, "ptr32")
+QDEF1(MP_QSTR_ptr8, 139, 4, "ptr8")
+QDEF1(MP_QSTR_qstr_info, 176, 9, "qstr_info")
+QDEF1(MP_QSTR_r, 215, 1, "r")
+QDEF1(MP_QSTR_radians, 135, 7, "radians")
+QDEF1(MP_QSTR_re, 210, 2, "re")
+QDEF1(MP_QSTR_readlines, 106, 9, "readlines")
+QDEF1(MP_QSTR_real, 191, 4, "real")
+QDEF1(MP_QSTR_rect, 229, 4, "rect")
+QDEF1(MP_QSTR_registry_read, 61, 13, "registry_read")
+QDEF1(MP_QSTR_registry_size, 42, 13, "registry_size")
+QDEF1(MP_QSTR_release, 236, 7, "release")
+QDEF1(MP_QSTR_reset, 16, 5, "reset")
+QDEF1(MP_QSTR_reversed, 161, 8, "reversed")
+QDEF1(MP_QSTR_sd_bench, 175, 8, "sd_bench")
+QDEF1(MP_QSTR_search, 171, 6, "search")
+QDEF1(MP_QSTR_seek, 157, 4, "seek")
+QDEF1(MP_QSTR_setter, 4, 6, "setter")
+QDEF1(MP_QSTR_sin, 177, 3, "sin")
+QDEF1(MP_QSTR_single, 63, 6, "single")
+QDEF1(MP_QSTR_sleep, 234, 5, "sleep")
+QDEF1(MP_QSTR_sleep_ms, 11, 8, "sleep_ms")
+QDEF1(MP_QSTR_sleep_us, 19, 8, "sleep_us")
+QDEF1(MP_QSTR_slice, 181, 5, "slice")
+QDEF1(MP_QSTR_sqrt, 33, 4, "sqrt")
+QDEF1(MP_QSTR_stack_size, 49, 10, "stack_size")
+QDEF1(MP_QSTR_stack_use, 151, 9, "stack_use")
+QDEF1(MP_QSTR_start_new_thread, 215, 16, "start_new_thread")
+QDEF1(MP_QSTR_struct, 18, 6, "struct")
+QDEF1(MP_QSTR_symmetric_difference, 206, 20, "symmetric_difference")
+QDEF1(MP_QSTR_symmetric_difference_update, 96, 27, "symmetric_difference_update")
+QDEF1(MP_QSTR_sys, 188, 3, "sys")
+QDEF1(MP_QSTR_table, 123, 5, "table")
+QDEF1(MP_QSTR_tan, 254, 3, "tan")
+QDEF1(MP_QSTR_tell, 20, 4, "tell")
+QDEF1(MP_QSTR_threshold, 242, 9, "threshold")
+QDEF1(MP_QSTR_ticks_add, 157, 9, "ticks_add")
+QDEF1(MP_QSTR_ticks_cpu, 26, 9, "ticks_cpu")
+QDEF1(MP_QSTR_ticks_diff, 177, 10, "ticks_diff")
+QDEF1(MP_QSTR_ticks_ms, 66, 8, "ticks_ms")
+QDEF1(MP_QSTR_ticks_us, 90, 8, "ticks_us")
+QDEF1(MP_QSTR_time, 240, 4, "time")
+QDEF1(MP_QSTR_toggle_orange, 184, 13, "toggle_orange")
+QDEF1(MP_QSTR_toggle_red, 27, 10, "toggle_red")
+QDEF1(MP_QSTR_trace, 164, 5, "trace")
+QDEF1(MP_QSTR_trunc, 91, 5, "trunc")
+QDEF1(MP_QSTR_uint, 227, 4, "uint")
+QDEF1(MP_QSTR_union, 246, 5, "union")
+QDEF1(MP_QSTR_unpack, 7, 6, "unpack")
+QDEF1(MP_QSTR_unpack_from, 14, 11, "unpack_from")
+QDEF1(MP_QSTR_usys, 201, 4, "usys")
+QDEF1(MP_QSTR_version, 191, 7, "version")
+QDEF1(MP_QSTR_version_info, 110, 12, "version_info")
+QDEF1(MP_QSTR_viper, 93, 5, "viper")
+QDEF1(MP_QSTR_wakeup, 120, 6, "wakeup")
+QDEF1(MP_QSTR__brace_open__colon__hash_b_brace_close_, 88, 5, "{:#b}")
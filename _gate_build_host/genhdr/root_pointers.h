@@ -0,0 +1,6 @@
+// Automatically generated by make_root_pointers.py.
+
+const char *readline_hist[(16)];
+mp_obj_list_t mp_sys_argv_obj;
+mp_obj_t persistent_code_root_pointers;
+mp_obj_t sys_mutable[MP_SYS_MUTABLE_NUM];
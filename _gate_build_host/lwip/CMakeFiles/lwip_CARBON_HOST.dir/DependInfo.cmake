@@ -0,0 +1,67 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/lwip/src/api/api_lib.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/api_lib.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/api_lib.c.o.d"
+  "/root/repo/lib/lwip/src/api/api_msg.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/api_msg.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/api_msg.c.o.d"
+  "/root/repo/lib/lwip/src/api/err.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/err.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/err.c.o.d"
+  "/root/repo/lib/lwip/src/api/if_api.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/if_api.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/if_api.c.o.d"
+  "/root/repo/lib/lwip/src/api/netbuf.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/netbuf.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/netbuf.c.o.d"
+  "/root/repo/lib/lwip/src/api/netdb.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/netdb.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/netdb.c.o.d"
+  "/root/repo/lib/lwip/src/api/netifapi.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/netifapi.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/netifapi.c.o.d"
+  "/root/repo/lib/lwip/src/api/sockets.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/sockets.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/sockets.c.o.d"
+  "/root/repo/lib/lwip/src/api/tcpip.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/tcpip.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/api/tcpip.c.o.d"
+  "/root/repo/lib/lwip/src/core/altcp.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp.c.o.d"
+  "/root/repo/lib/lwip/src/core/altcp_alloc.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp_alloc.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp_alloc.c.o.d"
+  "/root/repo/lib/lwip/src/core/altcp_tcp.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp_tcp.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp_tcp.c.o.d"
+  "/root/repo/lib/lwip/src/core/def.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/def.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/def.c.o.d"
+  "/root/repo/lib/lwip/src/core/dns.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/dns.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/dns.c.o.d"
+  "/root/repo/lib/lwip/src/core/inet_chksum.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/inet_chksum.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/inet_chksum.c.o.d"
+  "/root/repo/lib/lwip/src/core/init.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/init.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/init.c.o.d"
+  "/root/repo/lib/lwip/src/core/ip.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ip.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ip.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv4/autoip.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/autoip.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/autoip.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv4/dhcp.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/dhcp.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/dhcp.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv4/etharp.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/etharp.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/etharp.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv4/icmp.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/icmp.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/icmp.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv4/igmp.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/igmp.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/igmp.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv4/ip4.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv4/ip4_addr.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4_addr.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4_addr.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv4/ip4_frag.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4_frag.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4_frag.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv6/dhcp6.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/dhcp6.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/dhcp6.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv6/ethip6.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ethip6.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ethip6.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv6/icmp6.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/icmp6.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/icmp6.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv6/inet6.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/inet6.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/inet6.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv6/ip6.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv6/ip6_addr.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6_addr.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6_addr.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv6/ip6_frag.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6_frag.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6_frag.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv6/mld6.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/mld6.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/mld6.c.o.d"
+  "/root/repo/lib/lwip/src/core/ipv6/nd6.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/nd6.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/nd6.c.o.d"
+  "/root/repo/lib/lwip/src/core/mem.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/mem.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/mem.c.o.d"
+  "/root/repo/lib/lwip/src/core/memp.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/memp.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/memp.c.o.d"
+  "/root/repo/lib/lwip/src/core/netif.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/netif.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/netif.c.o.d"
+  "/root/repo/lib/lwip/src/core/pbuf.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/pbuf.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/pbuf.c.o.d"
+  "/root/repo/lib/lwip/src/core/raw.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/raw.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/raw.c.o.d"
+  "/root/repo/lib/lwip/src/core/stats.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/stats.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/stats.c.o.d"
+  "/root/repo/lib/lwip/src/core/sys.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/sys.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/sys.c.o.d"
+  "/root/repo/lib/lwip/src/core/tcp.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp.c.o.d"
+  "/root/repo/lib/lwip/src/core/tcp_in.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp_in.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp_in.c.o.d"
+  "/root/repo/lib/lwip/src/core/tcp_out.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp_out.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp_out.c.o.d"
+  "/root/repo/lib/lwip/src/core/timeouts.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/timeouts.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/timeouts.c.o.d"
+  "/root/repo/lib/lwip/src/core/udp.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/udp.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/core/udp.c.o.d"
+  "/root/repo/lib/lwip/src/netif/ethernet.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/netif/ethernet.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/src/netif/ethernet.c.o.d"
+  "/root/repo/lib/lwip/system/OS/sys_arch.c" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/system/OS/sys_arch.c.o" "gcc" "lwip/CMakeFiles/lwip_CARBON_HOST.dir/system/OS/sys_arch.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_host/freertos/CMakeFiles/freertos_CARBON_HOST.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,105 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/api_lib.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/api_lib.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/api_msg.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/api_msg.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/err.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/err.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/if_api.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/if_api.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/netbuf.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/netbuf.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/netdb.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/netdb.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/netifapi.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/netifapi.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/sockets.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/sockets.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/tcpip.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/api/tcpip.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp_alloc.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp_alloc.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp_tcp.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/altcp_tcp.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/def.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/def.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/dns.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/dns.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/inet_chksum.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/inet_chksum.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/init.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/init.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ip.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ip.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/autoip.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/autoip.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/dhcp.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/dhcp.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/etharp.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/etharp.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/icmp.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/icmp.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/igmp.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/igmp.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4_addr.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4_addr.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4_frag.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv4/ip4_frag.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/dhcp6.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/dhcp6.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ethip6.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ethip6.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/icmp6.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/icmp6.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/inet6.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/inet6.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6_addr.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6_addr.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6_frag.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/ip6_frag.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/mld6.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/mld6.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/nd6.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/ipv6/nd6.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/mem.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/mem.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/memp.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/memp.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/netif.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/netif.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/pbuf.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/pbuf.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/raw.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/raw.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/stats.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/stats.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/sys.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/sys.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp_in.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp_in.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp_out.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/tcp_out.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/timeouts.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/timeouts.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/udp.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/core/udp.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/netif/ethernet.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/src/netif/ethernet.c.o.d"
+  "CMakeFiles/lwip_CARBON_HOST.dir/system/OS/sys_arch.c.o"
+  "CMakeFiles/lwip_CARBON_HOST.dir/system/OS/sys_arch.c.o.d"
+  "liblwip_CARBON_HOST.a"
+  "liblwip_CARBON_HOST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lwip_CARBON_HOST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
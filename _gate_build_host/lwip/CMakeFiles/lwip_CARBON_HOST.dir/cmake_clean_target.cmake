@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "liblwip_CARBON_HOST.a"
+)
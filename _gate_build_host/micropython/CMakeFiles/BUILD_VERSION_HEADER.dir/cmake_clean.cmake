@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../genhdr/mpversion.h"
+  "CMakeFiles/BUILD_VERSION_HEADER"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/BUILD_VERSION_HEADER.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,213 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/micropython/micropython/extmod/btstack/modbluetooth_btstack.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/btstack/modbluetooth_btstack.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/btstack/modbluetooth_btstack.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_adc.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_adc.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_adc.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_adc_block.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_adc_block.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_adc_block.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_bitstream.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_bitstream.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_bitstream.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_i2c.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_i2c.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_i2c.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_i2s.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_i2s.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_i2s.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_mem.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_mem.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_mem.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_pulse.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_pulse.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_pulse.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_pwm.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_pwm.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_pwm.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_signal.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_signal.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_signal.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_spi.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_spi.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_spi.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_uart.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_uart.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_uart.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_usb_device.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_usb_device.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_usb_device.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/machine_wdt.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_wdt.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_wdt.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modasyncio.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modasyncio.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modasyncio.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modbinascii.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modbinascii.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modbinascii.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modbluetooth.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modbluetooth.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modbluetooth.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modcryptolib.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modcryptolib.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modcryptolib.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/moddeflate.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/moddeflate.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/moddeflate.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modframebuf.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modframebuf.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modframebuf.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modhashlib.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modhashlib.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modhashlib.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modheapq.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modheapq.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modheapq.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modjson.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modjson.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modjson.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modlwip.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modlwip.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modlwip.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modmachine.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modmachine.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modmachine.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modnetwork.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modnetwork.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modnetwork.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modonewire.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modonewire.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modonewire.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modos.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modos.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modos.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modplatform.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modplatform.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modplatform.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modrandom.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modrandom.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modrandom.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modre.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modre.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modre.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modselect.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modselect.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modselect.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modsocket.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modsocket.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modsocket.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modtime.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtime.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtime.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modtls_axtls.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtls_axtls.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtls_axtls.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modtls_mbedtls.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtls_mbedtls.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtls_mbedtls.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/moductypes.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/moductypes.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/moductypes.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modvfs.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modvfs.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modvfs.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modwebrepl.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modwebrepl.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modwebrepl.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/modwebsocket.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modwebsocket.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modwebsocket.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/network_cyw43.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_cyw43.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_cyw43.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/network_lwip.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_lwip.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_lwip.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/network_ninaw10.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_ninaw10.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_ninaw10.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/network_ppp_lwip.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_ppp_lwip.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_ppp_lwip.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/network_wiznet5k.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_wiznet5k.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_wiznet5k.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/nimble/modbluetooth_nimble.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/nimble/modbluetooth_nimble.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/nimble/modbluetooth_nimble.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/os_dupterm.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/os_dupterm.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/os_dupterm.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/vfs.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/vfs_blockdev.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_blockdev.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_blockdev.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/vfs_fat.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/vfs_fat_diskio.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat_diskio.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat_diskio.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/vfs_fat_file.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat_file.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat_file.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/vfs_lfs.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_lfs.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_lfs.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/vfs_posix.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_posix.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_posix.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/vfs_posix_file.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_posix_file.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_posix_file.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/vfs_reader.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_reader.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_reader.c.o.d"
+  "/root/repo/lib/micropython/micropython/extmod/virtpin.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/virtpin.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/virtpin.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/argcheck.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/argcheck.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/argcheck.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/asmarm.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmarm.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmarm.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/asmbase.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmbase.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmbase.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/asmrv32.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmrv32.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmrv32.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/asmthumb.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmthumb.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmthumb.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/asmx64.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmx64.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmx64.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/asmx86.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmx86.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmx86.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/asmxtensa.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmxtensa.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmxtensa.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/bc.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/bc.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/bc.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/binary.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/binary.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/binary.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/builtinevex.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinevex.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinevex.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/builtinhelp.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinhelp.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinhelp.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/builtinimport.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinimport.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinimport.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/compile.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/compile.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/compile.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/cstack.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/cstack.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/cstack.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitbc.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitbc.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitbc.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitcommon.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitcommon.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitcommon.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitglue.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitglue.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitglue.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitinlinethumb.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitinlinethumb.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitinlinethumb.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitinlinextensa.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitinlinextensa.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitinlinextensa.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitnarm.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnarm.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnarm.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitndebug.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitndebug.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitndebug.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitnrv32.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnrv32.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnrv32.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitnthumb.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnthumb.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnthumb.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitnx64.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnx64.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnx64.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitnx86.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnx86.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnx86.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitnxtensa.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnxtensa.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnxtensa.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/emitnxtensawin.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnxtensawin.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnxtensawin.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/formatfloat.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/formatfloat.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/formatfloat.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/frozenmod.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/frozenmod.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/frozenmod.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/gc.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/gc.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/gc.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/lexer.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/lexer.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/lexer.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/malloc.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/malloc.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/malloc.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/map.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/map.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/map.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modarray.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modarray.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modarray.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modbuiltins.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modbuiltins.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modbuiltins.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modcmath.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modcmath.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modcmath.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modcollections.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modcollections.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modcollections.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/moderrno.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/moderrno.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/moderrno.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modgc.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modgc.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modgc.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modio.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modio.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modio.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modmath.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modmath.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modmath.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modmicropython.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modmicropython.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modmicropython.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modstruct.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modstruct.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modstruct.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modsys.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modsys.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modsys.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/modthread.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modthread.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modthread.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/mpprint.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpprint.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpprint.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/mpstate.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpstate.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpstate.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/mpz.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpz.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpz.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nativeglue.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nativeglue.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nativeglue.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nlr.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlr.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlr.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nlrmips.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrmips.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrmips.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nlrpowerpc.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrpowerpc.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrpowerpc.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nlrrv32.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrrv32.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrrv32.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nlrrv64.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrrv64.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrrv64.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nlrsetjmp.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrsetjmp.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrsetjmp.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nlrthumb.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrthumb.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrthumb.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nlrx64.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrx64.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrx64.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nlrx86.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrx86.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrx86.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/nlrxtensa.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrxtensa.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrxtensa.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/obj.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/obj.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/obj.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objarray.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objarray.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objarray.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objattrtuple.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objattrtuple.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objattrtuple.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objbool.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objbool.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objbool.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objboundmeth.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objboundmeth.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objboundmeth.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objcell.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objcell.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objcell.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objclosure.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objclosure.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objclosure.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objcomplex.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objcomplex.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objcomplex.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objdeque.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objdeque.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objdeque.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objdict.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objdict.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objdict.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objenumerate.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objenumerate.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objenumerate.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objexcept.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objexcept.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objexcept.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objfilter.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfilter.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfilter.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objfloat.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfloat.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfloat.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objfun.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfun.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfun.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objgenerator.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objgenerator.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objgenerator.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objgetitemiter.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objgetitemiter.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objgetitemiter.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objint.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objint_longlong.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint_longlong.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint_longlong.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objint_mpz.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint_mpz.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint_mpz.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objlist.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objlist.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objlist.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objmap.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objmap.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objmap.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objmodule.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objmodule.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objmodule.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objnamedtuple.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objnamedtuple.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objnamedtuple.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objnone.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objnone.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objnone.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objobject.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objobject.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objobject.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objpolyiter.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objpolyiter.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objpolyiter.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objproperty.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objproperty.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objproperty.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objrange.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objrange.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objrange.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objreversed.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objreversed.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objreversed.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objringio.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objringio.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objringio.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objset.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objset.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objset.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objsingleton.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objsingleton.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objsingleton.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objslice.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objslice.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objslice.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objstr.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstr.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstr.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objstringio.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstringio.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstringio.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objstrunicode.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstrunicode.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstrunicode.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objtuple.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objtuple.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objtuple.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objtype.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objtype.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objtype.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/objzip.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objzip.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objzip.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/opmethods.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/opmethods.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/opmethods.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/pairheap.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/pairheap.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/pairheap.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/parse.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parse.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parse.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/parsenum.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parsenum.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parsenum.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/parsenumbase.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parsenumbase.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parsenumbase.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/persistentcode.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/persistentcode.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/persistentcode.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/profile.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/profile.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/profile.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/pystack.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/pystack.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/pystack.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/qstr.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/qstr.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/qstr.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/reader.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/reader.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/reader.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/repl.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/repl.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/repl.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/ringbuf.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/ringbuf.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/ringbuf.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/runtime.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/runtime.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/runtime.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/runtime_utils.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/runtime_utils.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/runtime_utils.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/scheduler.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/scheduler.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/scheduler.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/scope.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/scope.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/scope.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/sequence.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/sequence.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/sequence.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/showbc.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/showbc.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/showbc.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/smallint.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/smallint.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/smallint.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/stackctrl.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/stackctrl.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/stackctrl.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/stream.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/stream.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/stream.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/unicode.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/unicode.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/unicode.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/vm.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/vm.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/vm.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/vstr.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/vstr.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/vstr.c.o.d"
+  "/root/repo/lib/micropython/micropython/py/warning.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/warning.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/warning.c.o.d"
+  "/root/repo/lib/micropython/micropython/shared/libc/abort_.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/libc/abort_.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/libc/abort_.c.o.d"
+  "/root/repo/lib/micropython/micropython/shared/libc/printf.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/libc/printf.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/libc/printf.c.o.d"
+  "/root/repo/lib/micropython/micropython/shared/readline/readline.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/readline/readline.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/readline/readline.c.o.d"
+  "/root/repo/lib/micropython/micropython/shared/runtime/gchelper_generic.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/gchelper_generic.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/gchelper_generic.c.o.d"
+  "/root/repo/lib/micropython/micropython/shared/runtime/interrupt_char.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/interrupt_char.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/interrupt_char.c.o.d"
+  "/root/repo/lib/micropython/micropython/shared/runtime/pyexec.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/pyexec.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/pyexec.c.o.d"
+  "/root/repo/lib/micropython/micropython/shared/runtime/stdout_helpers.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/stdout_helpers.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/stdout_helpers.c.o.d"
+  "/root/repo/lib/micropython/port/user_module/carbon.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/carbon.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/carbon.c.o.d"
+  "/root/repo/lib/micropython/port/user_module/latency.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/latency.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/latency.c.o.d"
+  "/root/repo/lib/micropython/port/user_module/led.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/led.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/led.c.o.d"
+  "/root/repo/lib/micropython/port/vfs_carbon.c" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/port/vfs_carbon.c.o" "gcc" "micropython/CMakeFiles/micropython_CARBON_HOST.dir/port/vfs_carbon.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_host/freertos/CMakeFiles/freertos_CARBON_HOST.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_host/fatfs/CMakeFiles/fatfs_CARBON_HOST.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,409 @@
+file(REMOVE_RECURSE
+  "../genhdr/moduledefs.collected"
+  "../genhdr/moduledefs.collected.hash"
+  "../genhdr/moduledefs.h"
+  "../genhdr/moduledefs.split"
+  "../genhdr/qstr.i.last"
+  "../genhdr/qstr.split"
+  "../genhdr/qstrdefs.collected.h"
+  "../genhdr/qstrdefs.collected.h.hash"
+  "../genhdr/qstrdefs.generated.h"
+  "../genhdr/qstrdefs.preprocessed.h"
+  "../genhdr/root_pointers.collected"
+  "../genhdr/root_pointers.collected.hash"
+  "../genhdr/root_pointers.h"
+  "../genhdr/root_pointers.split"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/btstack/modbluetooth_btstack.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/btstack/modbluetooth_btstack.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_adc.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_adc.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_adc_block.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_adc_block.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_bitstream.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_bitstream.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_i2c.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_i2c.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_i2s.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_i2s.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_mem.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_mem.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_pulse.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_pulse.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_pwm.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_pwm.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_signal.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_signal.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_spi.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_spi.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_uart.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_uart.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_usb_device.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_usb_device.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_wdt.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/machine_wdt.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modasyncio.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modasyncio.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modbinascii.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modbinascii.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modbluetooth.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modbluetooth.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modcryptolib.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modcryptolib.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/moddeflate.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/moddeflate.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modframebuf.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modframebuf.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modhashlib.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modhashlib.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modheapq.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modheapq.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modjson.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modjson.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modlwip.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modlwip.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modmachine.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modmachine.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modnetwork.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modnetwork.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modonewire.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modonewire.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modos.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modos.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modplatform.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modplatform.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modrandom.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modrandom.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modre.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modre.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modselect.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modselect.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modsocket.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modsocket.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtime.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtime.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtls_axtls.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtls_axtls.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtls_mbedtls.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modtls_mbedtls.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/moductypes.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/moductypes.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modvfs.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modvfs.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modwebrepl.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modwebrepl.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modwebsocket.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/modwebsocket.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_cyw43.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_cyw43.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_lwip.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_lwip.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_ninaw10.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_ninaw10.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_ppp_lwip.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_ppp_lwip.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_wiznet5k.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/network_wiznet5k.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/nimble/modbluetooth_nimble.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/nimble/modbluetooth_nimble.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/os_dupterm.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/os_dupterm.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_blockdev.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_blockdev.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat_diskio.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat_diskio.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat_file.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_fat_file.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_lfs.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_lfs.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_posix.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_posix.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_posix_file.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_posix_file.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_reader.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/vfs_reader.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/virtpin.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/extmod/virtpin.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/argcheck.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/argcheck.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmarm.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmarm.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmbase.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmbase.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmrv32.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmrv32.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmthumb.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmthumb.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmx64.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmx64.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmx86.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmx86.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmxtensa.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/asmxtensa.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/bc.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/bc.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/binary.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/binary.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinevex.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinevex.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinhelp.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinhelp.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinimport.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/builtinimport.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/compile.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/compile.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/cstack.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/cstack.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitbc.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitbc.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitcommon.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitcommon.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitglue.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitglue.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitinlinethumb.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitinlinethumb.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitinlinextensa.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitinlinextensa.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnarm.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnarm.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitndebug.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitndebug.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnrv32.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnrv32.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnthumb.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnthumb.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnx64.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnx64.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnx86.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnx86.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnxtensa.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnxtensa.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnxtensawin.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/emitnxtensawin.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/formatfloat.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/formatfloat.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/frozenmod.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/frozenmod.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/gc.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/gc.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/lexer.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/lexer.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/malloc.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/malloc.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/map.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/map.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modarray.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modarray.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modbuiltins.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modbuiltins.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modcmath.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modcmath.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modcollections.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modcollections.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/moderrno.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/moderrno.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modgc.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modgc.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modio.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modio.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modmath.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modmath.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modmicropython.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modmicropython.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modstruct.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modstruct.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modsys.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modsys.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modthread.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/modthread.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpprint.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpprint.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpstate.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpstate.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpz.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/mpz.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nativeglue.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nativeglue.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlr.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlr.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrmips.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrmips.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrpowerpc.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrpowerpc.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrrv32.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrrv32.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrrv64.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrrv64.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrsetjmp.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrsetjmp.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrthumb.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrthumb.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrx64.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrx64.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrx86.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrx86.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrxtensa.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/nlrxtensa.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/obj.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/obj.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objarray.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objarray.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objattrtuple.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objattrtuple.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objbool.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objbool.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objboundmeth.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objboundmeth.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objcell.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objcell.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objclosure.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objclosure.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objcomplex.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objcomplex.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objdeque.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objdeque.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objdict.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objdict.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objenumerate.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objenumerate.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objexcept.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objexcept.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfilter.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfilter.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfloat.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfloat.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfun.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objfun.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objgenerator.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objgenerator.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objgetitemiter.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objgetitemiter.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint_longlong.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint_longlong.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint_mpz.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objint_mpz.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objlist.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objlist.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objmap.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objmap.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objmodule.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objmodule.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objnamedtuple.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objnamedtuple.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objnone.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objnone.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objobject.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objobject.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objpolyiter.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objpolyiter.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objproperty.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objproperty.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objrange.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objrange.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objreversed.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objreversed.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objringio.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objringio.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objset.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objset.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objsingleton.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objsingleton.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objslice.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objslice.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstr.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstr.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstringio.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstringio.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstrunicode.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objstrunicode.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objtuple.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objtuple.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objtype.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objtype.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objzip.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/objzip.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/opmethods.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/opmethods.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/pairheap.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/pairheap.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parse.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parse.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parsenum.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parsenum.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parsenumbase.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/parsenumbase.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/persistentcode.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/persistentcode.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/profile.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/profile.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/pystack.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/pystack.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/qstr.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/qstr.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/reader.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/reader.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/repl.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/repl.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/ringbuf.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/ringbuf.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/runtime.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/runtime.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/runtime_utils.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/runtime_utils.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/scheduler.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/scheduler.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/scope.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/scope.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/sequence.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/sequence.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/showbc.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/showbc.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/smallint.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/smallint.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/stackctrl.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/stackctrl.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/stream.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/stream.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/unicode.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/unicode.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/vm.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/vm.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/vstr.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/vstr.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/warning.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/py/warning.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/libc/abort_.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/libc/abort_.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/libc/printf.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/libc/printf.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/readline/readline.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/readline/readline.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/gchelper_generic.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/gchelper_generic.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/interrupt_char.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/interrupt_char.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/pyexec.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/pyexec.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/stdout_helpers.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/micropython/shared/runtime/stdout_helpers.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/carbon.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/carbon.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/latency.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/latency.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/led.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/port/user_module/led.c.o.d"
+  "CMakeFiles/micropython_CARBON_HOST.dir/port/vfs_carbon.c.o"
+  "CMakeFiles/micropython_CARBON_HOST.dir/port/vfs_carbon.c.o.d"
+  "libmicropython_CARBON_HOST.a"
+  "libmicropython_CARBON_HOST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/micropython_CARBON_HOST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libmicropython_CARBON_HOST.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/printf_CARBON_HOST.dir/printf.c.o"
+  "CMakeFiles/printf_CARBON_HOST.dir/printf.c.o.d"
+  "libprintf_CARBON_HOST.a"
+  "libprintf_CARBON_HOST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/printf_CARBON_HOST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libprintf_CARBON_HOST.a"
+)
@@ -2,52 +2,7 @@ enable_language(C CXX ASM)
 
 set(CMAKE_BUILD_TYPE Debug)
 
-set(WARN_FLAGS
-    -Wall
-    -Wextra
-    -Werror
-    -Werror=vla
-    #-Wundef
-    -Wformat=2
-    -Wformat-truncation
-    -Wformat-overflow=2
-    -Wformat-signedness
-    -Wno-format-nonliteral
-    -Wstack-usage=2048
-    -Wno-unused-parameter
-    -Wlogical-op
-    -Wdouble-promotion
-    -Wfloat-conversion
-    -Warith-conversion
-    -Wshadow=local
-    -Wduplicated-cond
-    -Wstringop-overflow=4
-    -Wnull-dereference
-)
-
-set(MISC_FLAGS
-    -fno-common
-#    -fstack-usage
-    -fdata-sections
-    -ffunction-sections
-    -funwind-tables
-    -fno-omit-frame-pointer
-    -fdelete-null-pointer-checks
-)
-
-set(HAL_COMMON
-    -DUSE_MULTI_CORE_SHARED_CODE
-    -DSTM32H747xx
-)
-
-set(CPP_FLAGS
-    -std=c++23
-    -fno-rtti
-    -fno-exceptions
-    -fno-threadsafe-statics
-    -Wold-style-cast
-    -Wno-volatile
-)
+include(${CMAKE_CURRENT_LIST_DIR}/flags.cmake)
 
 add_compile_options(${ARM_FLAGS})
 add_compile_options(${WARN_FLAGS})
@@ -97,13 +52,21 @@ SET(COMMON_SOURCE
     ${PROJECT_ROOT_DIR}/common/src/sys/newlib.c
     ${PROJECT_ROOT_DIR}/common/src/sys/cpp.cpp
     ${PROJECT_ROOT_DIR}/common/src/sys/oshooks.cpp
+    ${PROJECT_ROOT_DIR}/common/src/completion.cpp
     ${PROJECT_ROOT_DIR}/common/src/diag.cpp
     ${PROJECT_ROOT_DIR}/common/src/error.cpp
     ${PROJECT_ROOT_DIR}/common/src/freeRTOSTrace.cpp
     ${PROJECT_ROOT_DIR}/common/src/hsem.cpp
+    ${PROJECT_ROOT_DIR}/common/src/ipc.cpp
     ${PROJECT_ROOT_DIR}/common/src/irq.cpp
+    ${PROJECT_ROOT_DIR}/common/src/latency.cpp
     ${PROJECT_ROOT_DIR}/common/src/mpu.cpp
+    ${PROJECT_ROOT_DIR}/common/src/offload.cpp
+    ${PROJECT_ROOT_DIR}/common/src/registry.cpp
     ${PROJECT_ROOT_DIR}/common/src/systime.cpp
+    ${PROJECT_ROOT_DIR}/common/src/timebase.cpp
+    ${PROJECT_ROOT_DIR}/common/src/timebase_estimator.cpp
+    ${PROJECT_ROOT_DIR}/common/src/tlsf.cpp
     ${PROJECT_ROOT_DIR}/common/src/sdram.cpp
     ${PROJECT_ROOT_DIR}/common/src/shared_memory.cpp
     ${PROJECT_ROOT_DIR}/common/src/setup_idle_task.c
@@ -0,0 +1,48 @@
+# warnings and code generation shared by the target and the host builds
+
+set(WARN_FLAGS
+    -Wall
+    -Wextra
+    -Werror
+    -Werror=vla
+    #-Wundef
+    -Wformat=2
+    -Wformat-truncation
+    -Wformat-overflow=2
+    -Wformat-signedness
+    -Wno-format-nonliteral
+    -Wstack-usage=2048
+    -Wno-unused-parameter
+    -Wlogical-op
+    -Wdouble-promotion
+    -Wfloat-conversion
+    -Warith-conversion
+    -Wshadow=local
+    -Wduplicated-cond
+    -Wstringop-overflow=4
+    -Wnull-dereference
+)
+
+set(MISC_FLAGS
+    -fno-common
+#    -fstack-usage
+    -fdata-sections
+    -ffunction-sections
+    -funwind-tables
+    -fno-omit-frame-pointer
+    -fdelete-null-pointer-checks
+)
+
+set(HAL_COMMON
+    -DUSE_MULTI_CORE_SHARED_CODE
+    -DSTM32H747xx
+)
+
+set(CPP_FLAGS
+    -std=c++23
+    -fno-rtti
+    -fno-exceptions
+    -fno-threadsafe-statics
+    -Wold-style-cast
+    -Wno-volatile
+)
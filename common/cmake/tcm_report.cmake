@@ -0,0 +1,64 @@
+# Build report of the tightly coupled memories: what landed in ITCM and DTCM
+# and its size. Run as a post build step:
+#   cmake -DELF=<file.elf> -DNM=<arm-none-eabi-nm> -DREPORT=<file.txt> -P tcm_report.cmake
+
+if(NOT ELF OR NOT NM OR NOT REPORT)
+    message(FATAL_ERROR "usage: cmake -DELF=.. -DNM=.. -DREPORT=.. -P tcm_report.cmake")
+endif()
+
+# name:start:size
+set(REGIONS
+    ITCM:0x00000000:65536
+    DTCM:0x20000000:131072
+)
+
+execute_process(
+    COMMAND ${NM} -S -C --size-sort -r ${ELF}
+    OUTPUT_VARIABLE NM_OUTPUT
+    RESULT_VARIABLE NM_RESULT
+)
+
+if(NOT NM_RESULT EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${ELF}")
+endif()
+
+string(REPLACE ";" "," NM_OUTPUT "${NM_OUTPUT}")
+string(REPLACE "\n" ";" NM_LINES "${NM_OUTPUT}")
+
+set(OUTPUT "")
+
+foreach(REGION ${REGIONS})
+    string(REPLACE ":" ";" REGION "${REGION}")
+    list(GET REGION 0 REGION_NAME)
+    list(GET REGION 1 REGION_START)
+    list(GET REGION 2 REGION_SIZE)
+    math(EXPR REGION_END "${REGION_START} + ${REGION_SIZE}")
+
+    set(REGION_USED 0)
+    set(REGION_LINES "")
+    foreach(LINE ${NM_LINES})
+        if(NOT LINE MATCHES "^([0-9a-fA-F]+) ([0-9a-fA-F]+) ([a-zA-Z]) (.*)$")
+            continue()
+        endif()
+        set(ADDRESS "0x${CMAKE_MATCH_1}")
+        set(SIZE "0x${CMAKE_MATCH_2}")
+        set(TYPE "${CMAKE_MATCH_3}")
+        set(NAME "${CMAKE_MATCH_4}")
+        math(EXPR ADDRESS "${ADDRESS}")
+        if(ADDRESS LESS REGION_START OR NOT ADDRESS LESS REGION_END)
+            continue()
+        endif()
+        math(EXPR SIZE "${SIZE}")
+        math(EXPR REGION_USED "${REGION_USED} + ${SIZE}")
+        math(EXPR HEX_ADDRESS "${ADDRESS}" OUTPUT_FORMAT HEXADECIMAL)
+        string(APPEND REGION_LINES "  ${HEX_ADDRESS} ${SIZE}\t${TYPE} ${NAME}\n")
+    endforeach()
+
+    math(EXPR PERCENT "${REGION_USED} * 100 / ${REGION_SIZE}")
+    string(APPEND OUTPUT
+        "${REGION_NAME}: ${REGION_USED} of ${REGION_SIZE} bytes (${PERCENT}%) in symbols\n"
+        "${REGION_LINES}")
+endforeach()
+
+file(WRITE ${REPORT} "${OUTPUT}")
+message("${OUTPUT}")
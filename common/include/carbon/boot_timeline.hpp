@@ -0,0 +1,92 @@
+/**
+ ******************************************************************************
+ * @file           boot_timeline.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          boot milestones surviving the reset
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace CARBON {
+
+struct BootMilestone {
+    uint64_t us; /*from the reset*/
+    char name[16];
+};
+
+/*
+ * Kept in a section not initialized by the startup: after a reset the
+ * milestones of the previous boot are still there, also if it never
+ * completed. A wrong magic or count after a power on starts from scratch.
+ * Not thread safe, the caller serializes the marks.
+ */
+template <uint32_t MaxMilestones = 32> struct BootTimeline {
+    static constexpr uint32_t MAGIC = 0xB0071E11;
+
+    uint32_t magic;
+    uint32_t boots;
+    uint32_t count;
+    uint32_t previousCount;
+    BootMilestone milestones[MaxMilestones];
+    BootMilestone previous[MaxMilestones];
+
+    /*first thing after the reset*/
+    void start() {
+        if (magic == MAGIC && count <= MaxMilestones &&
+            previousCount <= MaxMilestones) {
+            std::memcpy(previous, milestones, sizeof(milestones));
+            previousCount = count;
+            boots++;
+        } else {
+            magic = MAGIC;
+            previousCount = 0;
+            boots = 1;
+        }
+        count = 0;
+    }
+
+    /*the name is copied, truncated; false when full*/
+    bool mark(const char *name, uint64_t us) {
+        if (count >= MaxMilestones)
+            return false;
+        auto &milestone = milestones[count];
+        milestone.us = us;
+        size_t length = 0;
+        while (length < sizeof(milestone.name) - 1 && name[length] != 0)
+            length++;
+        std::memcpy(milestone.name, name, length);
+        milestone.name[length] = 0;
+        count++;
+        return true;
+    }
+
+    /*the previous names come from the memory as found, terminated here*/
+    template <typename Function> void forEachPrevious(Function &&function) {
+        for (uint32_t i = 0; i < previousCount; i++) {
+            previous[i].name[sizeof(previous[i].name) - 1] = 0;
+            function(previous[i]);
+        }
+    }
+
+    template <typename Function> void forEach(Function &&function) const {
+        for (uint32_t i = 0; i < count; i++)
+            function(milestones[i]);
+    }
+};
+
+} // namespace CARBON
@@ -0,0 +1,109 @@
+/**
+ ******************************************************************************
+ * @file           byte_ring.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          single producer single consumer byte ring
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+namespace CARBON {
+
+/*
+ * One task writes, one task reads, no lock. The indices run free and wrap
+ * at 2^32, the difference is the number of bytes in the ring. The consumer
+ * can hand the contiguous bytes over in place (peek() and consume()),
+ * e.g. to a copying send, instead of copying them out first.
+ */
+template <uint32_t Size> class ByteRing {
+public:
+    static_assert(Size > 0 && (Size & (Size - 1)) == 0, "power of two size");
+
+    ByteRing() = default;
+
+    PREVENT_COPY_AND_MOVE(ByteRing)
+
+    /*producer, copies what fits, returns the bytes copied*/
+    uint32_t write(const void *data, uint32_t length) {
+        auto head = head_.load(std::memory_order_relaxed);
+        auto tail = tail_.load(std::memory_order_acquire);
+        auto count = std::min(length, Size - (head - tail));
+        auto offset = head & MASK;
+        auto first = std::min(count, Size - offset);
+        auto bytes = static_cast<const uint8_t *>(data);
+        std::memcpy(buffer_ + offset, bytes, first);
+        std::memcpy(buffer_, bytes + first, count - first);
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    /*consumer, the contiguous bytes at the tail, 0 when empty*/
+    uint32_t peek(const uint8_t *&data) const {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        auto head = head_.load(std::memory_order_acquire);
+        auto offset = tail & MASK;
+        data = buffer_ + offset;
+        return std::min(head - tail, Size - offset);
+    }
+
+    /*consumer, after peek(), at most the bytes it gave*/
+    void consume(uint32_t length) {
+        tail_.store(tail_.load(std::memory_order_relaxed) + length,
+                    std::memory_order_release);
+    }
+
+    /*consumer, copies up to length bytes out*/
+    uint32_t read(void *data, uint32_t length) {
+        auto bytes = static_cast<uint8_t *>(data);
+        uint32_t count = 0;
+        const uint8_t *chunk;
+        uint32_t available;
+        while (count < length && (available = peek(chunk)) > 0) {
+            auto n = std::min(available, length - count);
+            std::memcpy(bytes + count, chunk, n);
+            consume(n);
+            count += n;
+        }
+        return count;
+    }
+
+    /*consumer, drops what was written so far*/
+    void clear() {
+        tail_.store(head_.load(std::memory_order_acquire),
+                    std::memory_order_release);
+    }
+
+    uint32_t used() const {
+        auto tail = tail_.load(std::memory_order_acquire);
+        return head_.load(std::memory_order_acquire) - tail;
+    }
+
+    uint32_t space() const { return Size - used(); }
+
+private:
+    static constexpr uint32_t MASK = Size - 1;
+
+    std::atomic<uint32_t> head_{0};
+    std::atomic<uint32_t> tail_{0};
+    uint8_t buffer_[Size];
+};
+
+} // namespace CARBON
@@ -62,4 +62,29 @@ void carbon_assert(unsigned long line, const char *filename,
 
 #define ALIGN(value, alignment) ((value + alignment - 1)) & (~(alignment - 1))
 #define CACHE_ALIGNMENT 32
+
+/*
+ * CM7 tightly coupled memories, copied in by the startup: code in ITCM, data
+ * in DTCM. No cache and no wait states, but not reachable by the CM4 and by
+ * the DMAs. Without effect on the CM4 and on the host.
+ */
+#ifdef CORE_CM7
+#define CARBON_FAST_CODE __attribute__((section(".itcm_text")))
+#define CARBON_FAST_DATA __attribute__((section(".dtcm_data")))
+#define CARBON_FAST_BSS __attribute__((section(".dtcm_bss")))
+#else
+#define CARBON_FAST_CODE
+#define CARBON_FAST_DATA
+#define CARBON_FAST_BSS
+#endif
+
+/*
+ * Not initialized by the startup, the content survives a reset. Only for
+ * objects without constructor, checked at the start by a magic number.
+ */
+#ifdef CORE_CM7
+#define CARBON_NOINIT __attribute__((section(".noinit")))
+#else
+#define CARBON_NOINIT
+#endif
 // end of the file
\ No newline at end of file
@@ -0,0 +1,239 @@
+/**
+ ******************************************************************************
+ * @file           completion.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          interrupt to task completion on the task notifications
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+#include <carbon/latency.hpp>
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdbool.h>
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct CarbonCompletion CarbonCompletion;
+
+/*never destroyed, the name is kept for the report*/
+CarbonCompletion *carbon_completion_create(const char *name,
+                                           CarbonLatencySource source);
+
+/*timeout in ms or osWaitForever, returns false on timeout or cancel*/
+bool carbon_completion_wait(CarbonCompletion *completion, uint32_t timeout);
+
+/*from an interrupt or a task*/
+void carbon_completion_complete(CarbonCompletion *completion);
+
+void carbon_completion_reset(CarbonCompletion *completion);
+
+void carbon_completion_benchmark_isr(void);
+
+#ifdef __cplusplus
+}
+
+#include <carbon/irq.hpp>
+
+#include <cmsis_os.h>
+
+namespace CARBON {
+
+struct CompletionStats {
+    uint32_t completions;
+    uint32_t timeouts;
+    uint32_t cancels;
+    uint32_t wakeups;      /*completions found the task waiting*/
+    uint32_t maxLatency;   /*DWT cycles from complete() to the task running*/
+    uint64_t totalLatency; /*over the wakeups*/
+};
+
+/*
+ * One task waits for one event signalled by an interrupt: the waiting task
+ * is recorded and woken up by its notification, no kernel object. The
+ * notification value is shared with the other users of the task (copy()),
+ * a wake up without the completion is taken as spurious.
+ *
+ * A completion coming while nobody waits is kept for the next wait(), call
+ * reset() before starting the transfer to drop a late one. Objects are
+ * linked for the report and never destroyed.
+ *
+ * With a latency source the wakeups are also recorded in its histogram,
+ * from the entry in the interrupt handler calling complete().
+ */
+class Completion {
+public:
+    explicit Completion(const char *name,
+                        CarbonLatencySource source = CARBON_LATENCY_NONE)
+        : name_(name), source_(source), task_(nullptr), done_(false),
+          cancelled_(false), stamp_(0), entry_(0), stats_{}, next_(nullptr) {
+        auto previous = IRQ::raise();
+        next_ = first_;
+        first_ = this;
+        IRQ::restore(previous);
+    }
+
+    PREVENT_COPY_AND_MOVE(Completion)
+
+    /*from a task, timeout in ms, false on timeout or cancel()*/
+    bool wait(uint32_t timeout = osWaitForever) {
+        ASSERT(!IRQ::isInIRQ());
+        auto self = xTaskGetCurrentTaskHandle();
+        auto start = xTaskGetTickCount();
+        auto ticks = timeout / portTICK_PERIOD_MS;
+
+        auto previous = IRQ::raise();
+        if (done_) {
+            done_ = false;
+            IRQ::restore(previous);
+            return true;
+        }
+        ASSERT(task_ == nullptr);
+        task_ = self;
+        IRQ::restore(previous);
+
+        for (;;) {
+            TickType_t delay = portMAX_DELAY;
+            if (timeout != osWaitForever) {
+                auto elapsed = xTaskGetTickCount() - start;
+                delay = elapsed < ticks ? ticks - elapsed : 0;
+            }
+            ulTaskNotifyTake(pdTRUE, delay);
+            auto now = DWT->CYCCNT;
+
+            previous = IRQ::raise();
+            bool done = done_;
+            bool cancelled = cancelled_;
+            if (done) {
+                done_ = false;
+                auto latency = now - stamp_;
+                stats_.wakeups++;
+                stats_.totalLatency += latency;
+                if (latency > stats_.maxLatency)
+                    stats_.maxLatency = latency;
+                latencyWakeup(source_, now - entry_);
+            } else if (cancelled || delay == 0) {
+                stats_.timeouts += cancelled ? 0 : 1;
+            } else {
+                IRQ::restore(previous);
+                continue;
+            }
+            task_ = nullptr;
+            cancelled_ = false;
+            IRQ::restore(previous);
+            return done;
+        }
+    }
+
+    /*from an interrupt or a task, wakes up the waiting task*/
+    void complete() {
+        auto stamp = DWT->CYCCNT;
+        auto previous = IRQ::raise();
+        done_ = true;
+        stamp_ = stamp;
+        if (source_ < CARBON_LATENCY_SOURCES)
+            entry_ = carbon_latency_entry_stamp[source_];
+        stats_.completions++;
+        auto task = task_;
+        IRQ::restore(previous);
+        notify(task);
+    }
+
+    /*the waiting task returns false, nothing if nobody waits*/
+    void cancel() {
+        auto previous = IRQ::raise();
+        auto task = task_;
+        if (task != nullptr) {
+            cancelled_ = true;
+            stats_.cancels++;
+        }
+        IRQ::restore(previous);
+        notify(task);
+    }
+
+    /*drops a completion nobody waited for*/
+    void reset() {
+        auto previous = IRQ::raise();
+        done_ = false;
+        IRQ::restore(previous);
+    }
+
+    const char *name() const { return name_; }
+
+    CompletionStats stats() {
+        auto previous = IRQ::raise();
+        auto stats = stats_;
+        IRQ::restore(previous);
+        return stats;
+    }
+
+    template <typename Function> static void forEach(Function &&function) {
+        for (auto completion = first_; completion != nullptr;
+             completion = completion->next_)
+            function(*completion);
+    }
+
+    static void report();
+
+private:
+    static void notify(TaskHandle_t task) {
+        if (task == nullptr)
+            return;
+        if (IRQ::isInIRQ()) {
+            BaseType_t woken = pdFALSE;
+            vTaskNotifyGiveFromISR(task, &woken);
+            portYIELD_FROM_ISR(woken);
+        } else {
+            xTaskNotifyGive(task);
+        }
+    }
+
+    const char *name_;
+    CarbonLatencySource source_;
+    TaskHandle_t task_;
+    bool done_;
+    bool cancelled_;
+    uint32_t stamp_;
+    uint32_t entry_;
+    CompletionStats stats_;
+    Completion *next_;
+    static inline Completion *first_{nullptr};
+};
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+struct CompletionBenchmarkResult {
+    uint32_t maxCycles;
+    uint32_t averageCycles;
+    uint32_t missed; /*wake ups not seen within the timeout*/
+};
+
+/*
+ * Interrupt to task latency of a semaphore and of a completion, from a
+ * software triggered interrupt at the ceiling priority. On demand, from one
+ * task at a time: latency.wakeup(). The interrupt is enabled only for the
+ * run, its handler calls carbon_completion_benchmark_isr().
+ */
+void completionBenchmark(IRQn_Type irq, CompletionBenchmarkResult &semaphore,
+                         CompletionBenchmarkResult &completion);
+#endif
+
+} // namespace CARBON
+#endif
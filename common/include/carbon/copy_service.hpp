@@ -0,0 +1,211 @@
+/**
+ ******************************************************************************
+ * @file           copy_service.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Asynchronous memory copies by a DMA engine, CPU fall back
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+#include <carbon/inplace_function.hpp>
+#include <carbon/sync.hpp>
+
+#include <cstdint>
+#include <utility>
+
+namespace CARBON {
+
+enum class CopyStatus : uint32_t {
+    Done,
+    Error, /*reported by the engine, the destination is undefined*/
+};
+
+using CopyCallback = inplace_function<void(CopyStatus), 16>;
+using CopyEngineHandler = inplace_function<void(bool), 16>;
+
+struct CopyStats {
+    uint32_t cpuCopies; /*below the threshold*/
+    uint32_t fallbacks; /*above the threshold, queue full or too long*/
+    uint32_t offloaded;
+    uint32_t errors;
+    uint64_t cpuBytes; /*including the misaligned edges of the offloaded*/
+    uint64_t offloadedBytes;
+    uint32_t maxPending;
+};
+
+/*
+ * The engine copies one request at a time, split in its own linked list:
+ *   static constexpr size_t MAX_LENGTH;
+ *   void setHandler(CopyEngineHandler handler);
+ *   void start(void *dst, const void *src, size_t length);
+ * start() is called with the lock held, the handler is called once per
+ * start() from the completion context (interrupt on the target), also when
+ * the transfer failed, never from start() itself.
+ *
+ * The platform provides the CPU copy and the cache maintenance:
+ *   cpuCopy(dst, src, length);
+ *   prepareSource(src, length), prepareDestination(dst, length) before the
+ *   transfer, completeDestination(dst, length) after it.
+ *
+ * The engine gets only the whole cache lines of the destination, the edges
+ * sharing a line with other data are copied by the CPU before queueing.
+ * Source and destination must not be touched until the completion.
+ */
+template <typename Engine, typename Lock, typename Platform,
+          uint32_t MaxPending = 8>
+class CopyService {
+public:
+    CopyService(Engine &engine, size_t threshold)
+        : engine_(engine), threshold_(threshold), head_(0), count_(0),
+          stats_{} {
+        engine_.setHandler([this](bool ok) { engineDone(ok); });
+    }
+
+    PREVENT_COPY_AND_MOVE(CopyService)
+
+    /*
+     * The callback runs in the calling context if the copy is done by the
+     * CPU, in the completion context of the engine otherwise. Returns true if
+     * the copy was queued to the engine.
+     */
+    bool copyAsync(void *dst, const void *src, size_t length,
+                   CopyCallback callback) {
+        if (length < threshold_) {
+            cpuCopy(dst, src, length, false);
+            if (callback)
+                callback(CopyStatus::Done);
+            return false;
+        }
+
+        auto address = reinterpret_cast<uintptr_t>(dst);
+        auto first = alignUp(address);
+        auto last = (address + length) & ~uintptr_t{CACHE_ALIGNMENT - 1};
+        if (last <= first || last - first > Engine::MAX_LENGTH) {
+            cpuCopy(dst, src, length, true);
+            if (callback)
+                callback(CopyStatus::Done);
+            return false;
+        }
+
+        auto head = first - address;
+        auto middle = last - first;
+        auto tail = address + length - last;
+        auto source = static_cast<const uint8_t *>(src);
+        auto middleDst = reinterpret_cast<void *>(first);
+        auto middleSrc = source + head;
+
+        /*the edges are in other cache lines, done before the completion*/
+        Platform::cpuCopy(dst, src, head);
+        Platform::cpuCopy(reinterpret_cast<void *>(last),
+                          source + (length - tail), tail);
+        Platform::prepareSource(middleSrc, middle);
+        Platform::prepareDestination(middleDst, middle);
+
+        {
+            LockGuard<Lock> lock(lock_);
+            stats_.cpuBytes += head + tail;
+            if (count_ < MaxPending) {
+                auto &request = queue_[(head_ + count_) % MaxPending];
+                request.dst = middleDst;
+                request.src = middleSrc;
+                request.length = middle;
+                request.callback = std::move(callback);
+                if (++count_ == 1)
+                    engine_.start(request.dst, request.src, request.length);
+                if (count_ > stats_.maxPending)
+                    stats_.maxPending = count_;
+                stats_.offloaded++;
+                stats_.offloadedBytes += middle;
+                return true;
+            }
+        }
+
+        cpuCopy(middleDst, middleSrc, middle, true);
+        if (callback)
+            callback(CopyStatus::Done);
+        return false;
+    }
+
+    void setThreshold(size_t threshold) { threshold_ = threshold; }
+
+    size_t threshold() const { return threshold_; }
+
+    uint32_t pending() {
+        LockGuard<Lock> lock(lock_);
+        return count_;
+    }
+
+    CopyStats stats() {
+        LockGuard<Lock> lock(lock_);
+        return stats_;
+    }
+
+private:
+    struct Request {
+        void *dst;
+        const void *src;
+        size_t length;
+        CopyCallback callback;
+    };
+
+    static uintptr_t alignUp(uintptr_t address) {
+        return (address + CACHE_ALIGNMENT - 1) &
+               ~uintptr_t{CACHE_ALIGNMENT - 1};
+    }
+
+    void cpuCopy(void *dst, const void *src, size_t length, bool fallback) {
+        Platform::cpuCopy(dst, src, length);
+        LockGuard<Lock> lock(lock_);
+        if (fallback) {
+            stats_.fallbacks++;
+        } else {
+            stats_.cpuCopies++;
+        }
+        stats_.cpuBytes += length;
+    }
+
+    void engineDone(bool ok) {
+        Request done;
+        {
+            LockGuard<Lock> lock(lock_);
+            if (count_ == 0)
+                return;
+            done = std::move(queue_[head_]);
+            queue_[head_] = Request{};
+            head_ = (head_ + 1) % MaxPending;
+            count_--;
+            if (!ok)
+                stats_.errors++;
+            if (count_ > 0) {
+                auto &next = queue_[head_];
+                engine_.start(next.dst, next.src, next.length);
+            }
+        }
+
+        Platform::completeDestination(done.dst, done.length);
+        if (done.callback)
+            done.callback(ok ? CopyStatus::Done : CopyStatus::Error);
+    }
+
+    Engine &engine_;
+    size_t threshold_;
+    Lock lock_;
+    Request queue_[MaxPending];
+    uint32_t head_;
+    uint32_t count_;
+    CopyStats stats_;
+};
+
+} // namespace CARBON
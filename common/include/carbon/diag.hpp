@@ -46,7 +46,8 @@ void carbon_diag_pull();
 #define MATRIX_DIS_DIAG "[md] "
 #define FTP "[ftp] "
 #define ETH_DIAG "[eth] "
-#define ETH_TEST_DIAG "[ethtest] "
+#define NET_BENCH_DIAG "[netbench] "
+#define BOOT_DIAG "[boot] "
 
 #ifdef CORE_CM7
 #define DIAG_CPU "[CM7] "
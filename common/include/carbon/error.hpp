@@ -122,4 +122,12 @@ constexpr Error ModbusRequestFailed(ErrorGroupType::Modbus,
                                     ErrorType::ModbusRequestFailed);
 
 constexpr Error ModbusResponseFailed(ErrorGroupType::Modbus,
-                                     ErrorType::ModbusResponseFailed);
\ No newline at end of file
+                                     ErrorType::ModbusResponseFailed);
+
+constexpr Error FileNotFound(ErrorGroupType::FileSystem,
+                             ErrorType::FileNotFound);
+
+constexpr Error DiskFull(ErrorGroupType::FileSystem, ErrorType::DiskFull);
+
+constexpr Error FileSystemError(ErrorGroupType::FileSystem,
+                                ErrorType::Internal);
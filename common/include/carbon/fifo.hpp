@@ -37,7 +37,7 @@ public:
 
     friend class FifoTest;
 
-    bool init(uint32_t startAddress, uint32_t size) {
+    bool init(uintptr_t startAddress, uint32_t size) {
         startAddress_ = startAddress;
         size_ = size;
         buffer_.init(startAddress, size);
@@ -110,41 +110,11 @@ public:
             LockGuard<Lock> lockGuard(lock_);
             if (isOverflow_)
                 return;
-            uint32_t index1 = fifo_pos_start_ / 8u;
-            uint32_t index2 = fifo_pos_end_ / 8u;
-            if (index1 == index2) {
-                uint8_t bit_pos1 =
-                    static_cast<uint8_t>(0xFF << (fifo_pos_start_ % 8u));
-                uint8_t bit_pos2 =
-                    static_cast<uint8_t>(0xFF >> (7 - (fifo_pos_end_ % 8u)));
-                bit_pos1 = bit_pos1 & bit_pos2;
-                fifo_.tail_ready_[index1] |= bit_pos1;
+            if (fifo_pos_start_ <= fifo_pos_end_) {
+                fifo_.setReady(fifo_pos_start_, fifo_pos_end_);
             } else {
-                uint8_t bit_pos1 =
-                    static_cast<uint8_t>(0xFF << (fifo_pos_start_ % 8u));
-                fifo_.tail_ready_[index1] |= bit_pos1;
-
-                uint8_t bit_pos2 =
-                    static_cast<uint8_t>(0xFF >> (7 - (fifo_pos_end_ % 8u)));
-                fifo_.tail_ready_[index2] |= bit_pos2;
-
-                if (index2 > index1) {
-                    for (uint32_t i = (index1 + 1); i < index2; i++) {
-                        fifo_.tail_ready_[i] = 0xFF;
-                    }
-                } else if (index1 > index2) {
-                    uint32_t last_index = (NElements) / 8u;
-                    for (uint32_t i = (index1 + 1); i < (last_index); i++) {
-                        fifo_.tail_ready_[i] = 0xFF;
-                    }
-
-                    fifo_.tail_ready_[last_index] =
-                        (0xFF >> (7 - (NElements % 8u)));
-
-                    for (uint32_t i = 0; i < index2; i++) {
-                        fifo_.tail_ready_[i] = 0xFF;
-                    }
-                }
+                fifo_.setReady(fifo_pos_start_, NElements);
+                fifo_.setReady(0, fifo_pos_end_);
             }
         }
 
@@ -177,8 +147,8 @@ public:
                 return false;
             }
             uint32_t i = 0;
-            while (index_ != fifo_.tail_reserved_ || i < length) {
-                if (!(fifo_.buffer_.insert(*(&object + i), index_))) {
+            while (index_ != fifo_.tail_reserved_ && i < length) {
+                if (!(fifo_.buffer_.insert(object + i, index_))) {
                     RAW_DIAG("error pushing in buffer");
                     return false;
                 }
@@ -204,7 +174,7 @@ public:
                     RAW_DIAG("error pushing in buffer length");
                     return false;
                 }
-                if (!fifo_.increment(index_, data_length1_)) {
+                if (!fifo_.increment(index_, length)) {
                     RAW_DIAG(
                         "error while incrementing, length <= data lenght 1");
                     return false;
@@ -230,6 +200,7 @@ public:
                     RAW_DIAG("error pushing in buffer length-data_length1_");
                     return false;
                 }
+                fifo_.increment(index_, length - data_length1_);
             }
 
             return true;
@@ -259,8 +230,8 @@ public:
             fifo_.getElementReady(dataLength1_, dataLength2_);
             dataLengthByte1_ = dataLength1_ * sizeof(ObjectType);
             dataLengthByte2_ = dataLength2_ * sizeof(ObjectType);
-            dataPtr1_ = fifo_.startAddress_ + currentHead_;
-            dataPtr2_ = fifo_.startAddress_;
+            dataPtr1_ = fifo_.buffer_.getBlockAddress(currentHead_);
+            dataPtr2_ = fifo_.buffer_.getBlockAddress(0);
         }
 
         ~ContextPull() {
@@ -290,7 +261,7 @@ public:
             dataLengthByte2 = dataLengthByte2_;
         }
 
-        inline void getDataPtr(uint32_t &dataPtr1, uint32_t &dataPtr2) {
+        inline void getDataPtr(uintptr_t &dataPtr1, uintptr_t &dataPtr2) {
             dataPtr1 = dataPtr1_;
             dataPtr2 = dataPtr2_;
         }
@@ -303,8 +274,8 @@ public:
         uint32_t dataLengthByte1_{0};
         uint32_t dataLength2_{0};
         uint32_t dataLengthByte2_{0};
-        uint32_t dataPtr1_{0};
-        uint32_t dataPtr2_{0};
+        uintptr_t dataPtr1_{0};
+        uintptr_t dataPtr2_{0};
     };
 
     inline bool pop(ObjectType &object, Lock &lock) {
@@ -355,7 +326,7 @@ public:
 
     inline bool isFull(uint32_t nIncrement) {
         if (nIncrement > NElements)
-            return false;
+            return true;
 
         if (tail_reserved_ < head_) {
             if (nIncrement >= (head_ - tail_reserved_))
@@ -415,6 +386,23 @@ private:
         return true;
     }
 
+    /*marks the elements from first to last, without wrap, as ready*/
+    inline void setReady(uint32_t first, uint32_t last) {
+        uint32_t index1 = first / 8u;
+        uint32_t index2 = last / 8u;
+        uint8_t mask1 = static_cast<uint8_t>(0xFF << (first % 8u));
+        uint8_t mask2 = static_cast<uint8_t>(0xFF >> (7 - (last % 8u)));
+        if (index1 == index2) {
+            tail_ready_[index1] |= mask1 & mask2;
+            return;
+        }
+        tail_ready_[index1] |= mask1;
+        for (uint32_t i = index1 + 1; i < index2; i++) {
+            tail_ready_[i] = 0xFF;
+        }
+        tail_ready_[index2] |= mask2;
+    }
+
     inline void getElementReady(uint32_t &dataLength1, uint32_t &dataLength2) {
         dataLength1 = 0;
         dataLength2 = 0;
@@ -460,7 +448,7 @@ private:
     CallbackUnderflow callbackUnderflow{nullptr};
 
     Buffer<ObjectType, aligment> buffer_;
-    uint32_t startAddress_{0};
+    uintptr_t startAddress_{0};
     uint32_t size_{0};
     uint32_t tail_reserved_{0};
     uint32_t head_{0};
@@ -69,7 +69,7 @@ struct remove_cvref // NOLINT(readability-identifier-naming)
 
 template <typename T>
 using remove_cvref_t // NOLINT(readability-identifier-naming)
-    = typename llvm::remove_cvref<T>::type;
+    = typename remove_cvref<T>::type;
 
 //===----------------------------------------------------------------------===//
 //     Features from C++23
@@ -28,7 +28,51 @@ extern "C" void hsemInit();
 
 namespace CARBON {
 
-enum class HSEM_ID : uint32_t { InitSync, Diag, Trace };
+enum class HSEM_ID : uint32_t {
+    InitSync,
+    Diag,
+    Trace,
+    DoorbellCM7, /*rung by the CM4*/
+    DoorbellCM4, /*rung by the CM7*/
+    Count
+};
+
+static constexpr uint32_t HSEM_COUNT = static_cast<uint32_t>(HSEM_ID::Count);
+
+/*contention counters, one set per core*/
+struct HSEMStats {
+    uint32_t acquired;
+    uint32_t contended; /*first attempt failed*/
+    uint32_t blocked;   /*task blocked waiting for the release interrupt*/
+    uint32_t timeouts;  /*woken by the timeout instead of the interrupt*/
+    uint32_t maxSpins;
+};
+
+extern HSEMStats hsemStats[HSEM_COUNT];
+
+/*
+ * Waiting for an HSEM release interrupt: a task registers itself before the
+ * last check, so that a release between the check and the wait is not lost.
+ * Without scheduler the wait spins on the flag set by the ISR.
+ */
+class HSEMWaitQueue {
+public:
+    PREVENT_COPY_AND_MOVE(HSEMWaitQueue)
+
+    static bool canBlock();
+
+    static void prepareWait(uint32_t semId);
+
+    static void cancelWait(uint32_t semId);
+
+    /*returns false on timeout, unregisters the waiter*/
+    static bool wait(uint32_t semId, uint32_t timeoutMs);
+
+    static void notifyFromISR(uint32_t semMask);
+
+private:
+    HSEMWaitQueue() = default;
+};
 
 template <HSEM_ID hsemID> class HSEMSpinLock {
 public:
@@ -68,8 +112,105 @@ public:
     }
 };
 
+/*
+ * Cross core mutex: spins for a short time, then blocks the calling task on
+ * the release interrupt. From ISRs, with interrupts masked or without
+ * scheduler it falls back to spinning. As for HSEMSpinLock, the interrupts
+ * up to the IRQ ceiling stay masked while the semaphore is held, the same
+ * core cannot contend.
+ */
+template <HSEM_ID hsemID, uint32_t spinCount = 64, uint32_t waitMs = 2>
+class HSEMMutex {
+public:
+    HSEMMutex() = default;
+
+    PREVENT_COPY_AND_MOVE(HSEMMutex);
+
+    static void get() {
+        uint32_t spins = 0;
+        bool contended = false;
+        while (true) {
+            IRQ::lockRecursive();
+            if (tryLock())
+                break;
+            IRQ::unLockRecursive();
+            contended = true;
+            if (++spins < spinCount || !HSEMWaitQueue::canBlock()) {
+                __NOP();
+                continue;
+            }
+            HSEMWaitQueue::prepareWait(id);
+            IRQ::lockRecursive();
+            if (tryLock()) {
+                HSEMWaitQueue::cancelWait(id);
+                break;
+            }
+            IRQ::unLockRecursive();
+            hsemStats[id].blocked++;
+            if (!HSEMWaitQueue::wait(id, waitMs))
+                hsemStats[id].timeouts++;
+        }
+        auto &stats = hsemStats[id];
+        stats.acquired++;
+        if (contended)
+            stats.contended++;
+        if (spins > stats.maxSpins)
+            stats.maxSpins = spins;
+        __DMB();
+    }
+
+    static void release() {
+        __DMB();
+        HSEM->R[id] = HSEM_CR_COREID_CURRENT;
+        IRQ::unLockRecursive();
+    }
+
+    static const HSEMStats &stats() { return hsemStats[id]; }
+
+private:
+    static constexpr uint32_t id = static_cast<uint32_t>(hsemID);
+
+    static_assert(id < HSEM_COUNT);
+
+    static bool tryLock() {
+        return HSEM->RLR[id] == (HSEM_CR_COREID_CURRENT | HSEM_RLR_LOCK);
+    }
+};
+
+/*the release of the ring semaphore interrupts the other core*/
+template <HSEM_ID ringID, HSEM_ID listenID> class HSEMDoorbell {
+public:
+    HSEMDoorbell() = default;
+
+    PREVENT_COPY_AND_MOVE(HSEMDoorbell);
+
+    static void ring() {
+        __DSB();
+        IRQ::lockRecursive();
+        while (HSEM->RLR[ringId] != (HSEM_CR_COREID_CURRENT | HSEM_RLR_LOCK)) {
+            __NOP();
+        }
+        HSEM->R[ringId] = HSEM_CR_COREID_CURRENT;
+        IRQ::unLockRecursive();
+    }
+
+    static void prepare() { HSEMWaitQueue::prepareWait(listenId); }
+
+    static void cancel() { HSEMWaitQueue::cancelWait(listenId); }
+
+    static bool wait(uint32_t timeoutMs) {
+        return HSEMWaitQueue::wait(listenId, timeoutMs);
+    }
+
+    static uint32_t nowMs() { return HAL_GetTick(); }
+
+private:
+    static constexpr uint32_t ringId = static_cast<uint32_t>(ringID);
+    static constexpr uint32_t listenId = static_cast<uint32_t>(listenID);
+};
+
 extern HSEMSpinLock<HSEM_ID::InitSync> hSemInitSync;
 
-extern HSEMSpinLock<HSEM_ID::Trace> hsemTrace;
+extern HSEMMutex<HSEM_ID::Trace> hsemTrace;
 
 } // namespace CARBON
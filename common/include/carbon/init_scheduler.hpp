@@ -0,0 +1,144 @@
+/**
+ ******************************************************************************
+ * @file           init_scheduler.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          dependency driven bring up of the subsystems
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+#include <carbon/sync.hpp>
+
+#include <cstdint>
+
+namespace CARBON {
+
+struct InitStepTiming {
+    const char *name;
+    uint64_t startUs;
+    uint64_t endUs;
+};
+
+/*
+ * Each step runs on its own worker as soon as the steps it comes after are
+ * done, the independent ones at the same time. A step can only come after
+ * steps added before it, there are no cycles.
+ *
+ * The platform provides:
+ *   using Lock;  get() and release()
+ *   using Event; signal() from the workers, wait() from run() only
+ *   static uint64_t nowUs();
+ *   static bool spawn(void (*entry)(void *), void *argument,
+ *                     const char *name, uint32_t stackWords);
+ *   static void exit(); the end of a step on a worker, may return
+ *   static void milestone(const char *name); a step is done
+ * A step which cannot be spawned runs in the caller of run(). The workers
+ * signal after releasing the lock, once run() may have returned: the
+ * scheduler outlives them, static.
+ */
+template <typename Platform, uint32_t MaxSteps = 16> class InitScheduler {
+public:
+    using Function = void (*)();
+    using StepMask = uint32_t;
+
+    static_assert(MaxSteps <= 32);
+
+    InitScheduler() : count_(0), started_(0), done_(0) {}
+
+    PREVENT_COPY_AND_MOVE(InitScheduler)
+
+    /*returns the mask of the step, for the after of the next ones*/
+    StepMask add(const char *name, Function function, StepMask after = 0,
+                 uint32_t stackWords = 0) {
+        ASSERT(count_ < MaxSteps);
+        auto mask = StepMask{1} << count_;
+        ASSERT((after & ~(mask - 1)) == 0);
+        steps_[count_] = Step{this, name, function, after, stackWords, 0, 0};
+        count_++;
+        return mask;
+    }
+
+    /*returns when all the steps are done*/
+    void run() {
+        auto all = count_ == 32 ? ~StepMask{0} : (StepMask{1} << count_) - 1;
+        lock_.get();
+        while (done_ != all) {
+            for (uint32_t i = 0; i < count_; i++) {
+                auto mask = StepMask{1} << i;
+                auto &step = steps_[i];
+                if ((started_ & mask) != 0 || (step.after & ~done_) != 0)
+                    continue;
+                started_ |= mask;
+                step.startUs = Platform::nowUs();
+                lock_.release();
+                if (!Platform::spawn(&InitScheduler::worker, &step, step.name,
+                                     step.stackWords))
+                    finish(step);
+                lock_.get();
+            }
+            if (done_ == all)
+                break;
+            lock_.release();
+            event_.wait();
+            lock_.get();
+        }
+        lock_.release();
+    }
+
+    uint32_t steps() const { return count_; }
+
+    InitStepTiming timing(uint32_t index) const {
+        auto &step = steps_[index];
+        return InitStepTiming{step.name, step.startUs, step.endUs};
+    }
+
+private:
+    struct Step {
+        InitScheduler *scheduler;
+        const char *name;
+        Function function;
+        StepMask after;
+        uint32_t stackWords;
+        uint64_t startUs;
+        uint64_t endUs;
+    };
+
+    static void worker(void *argument) {
+        auto &step = *static_cast<Step *>(argument);
+        step.scheduler->finish(step);
+        Platform::exit();
+    }
+
+    void finish(Step &step) {
+        step.function();
+        Platform::milestone(step.name);
+        {
+            LockGuard<typename Platform::Lock> lock(lock_);
+            step.endUs = Platform::nowUs();
+            done_ |= StepMask{1} << static_cast<uint32_t>(&step - steps_);
+        }
+        /*no kernel calls under the lock, run() may return before*/
+        event_.signal();
+    }
+
+    typename Platform::Lock lock_;
+    typename Platform::Event event_;
+    Step steps_[MaxSteps];
+    uint32_t count_;
+    StepMask started_;
+    StepMask done_;
+};
+
+} // namespace CARBON
@@ -0,0 +1,72 @@
+/**
+ ******************************************************************************
+ * @file           ipc.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Mailbox between CM7 and CM4, per core end point
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/hsem.hpp>
+#include <carbon/irq.hpp>
+#include <carbon/mailbox.hpp>
+#include <carbon/offload.hpp>
+
+namespace CARBON {
+
+#ifdef CORE_CM7
+using CoreDoorbell = HSEMDoorbell<HSEM_ID::DoorbellCM4, HSEM_ID::DoorbellCM7>;
+#else
+using CoreDoorbell = HSEMDoorbell<HSEM_ID::DoorbellCM7, HSEM_ID::DoorbellCM4>;
+#endif
+
+using CoreMailbox = Mailbox<CoreDoorbell, IRQLockRecursive>;
+
+CoreMailbox &coreMailbox();
+
+/*CM7: resets the shared queues, to be called before the sync flag*/
+void mailboxInit();
+
+/*round trip to the other core*/
+bool mailboxPing(uint32_t &roundTripUs, uint32_t timeoutMs);
+
+/*answers the system requests, returns false if not a system message*/
+bool mailboxHandleSystem(const MailboxMessage &message);
+
+/*time base and cache maintenance of the offload jobs*/
+struct OffloadPlatform {
+    static uint64_t nowUs();
+    static void yield();
+    /*the CM4 cannot reach the CM7 TCMs*/
+    static bool reachable(uintptr_t address, uint32_t length);
+    static void clean(uintptr_t address, uint32_t length);
+    /*
+     * Invalidates the whole cache lines: the output buffers must be cache
+     * aligned, e.g. not share a line with data written by the CM7.
+     */
+    static void invalidate(uintptr_t address, uint32_t length);
+};
+
+#ifdef CORE_CM7
+using CoreOffloadClient =
+    OffloadClient<CoreMailbox, OffloadPlatform, IRQLockRecursive>;
+
+CoreOffloadClient &offloadClient();
+#else
+using CoreOffloadWorker = OffloadWorker<CoreMailbox, OffloadPlatform>;
+
+CoreOffloadWorker &offloadWorker();
+#endif
+
+} // namespace CARBON
@@ -22,46 +22,108 @@
 
 #include <stm32h7xx.h>
 
+#include <FreeRTOS.h>
+
 namespace CARBON {
 
+/*longest window with the interrupts masked by the carbon critical sections*/
+struct IRQMaskStats {
+    uint32_t sections;
+    uint32_t maxCycles; /*DWT cycles*/
+    uintptr_t maxSite;  /*return address of the function taking the lock*/
+};
+
+/*
+ * The critical sections are a priority ceiling: BASEPRI masks only the
+ * interrupts at the ceiling or below it, the FreeRTOS syscall level by
+ * default. The interrupts above it keep running and must not use the kernel
+ * nor the carbon locks. lock() masks all of them, for the fatal paths.
+ *
+ * A kernel critical section inside a carbon one lowers BASEPRI on exit: no
+ * blocking or allocating kernel calls while the lock is held.
+ */
 class IRQ {
 public:
     PREVENT_COPY_AND_MOVE(IRQ)
 
     enum LockStatus : bool { Locked = true, Unlocked = false };
 
+    static constexpr uint32_t CEILING =
+        configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY;
+
     static inline void lock() { __disable_irq(); }
 
     static inline void unlock() { __enable_irq(); }
 
-    static inline void lockRecursive() {
-        auto startStatus = isLocked();
+    /*never lowers the mask, returns the previous one for restore()*/
+    static inline uint32_t raise(uint32_t priority = CEILING) {
+        auto previous = __get_BASEPRI();
+#ifdef CORE_CM7
+        /*Cortex-M7 erratum 837070: the write of BASEPRI under PRIMASK*/
+        auto primask = __get_PRIMASK();
         __disable_irq();
+        __set_BASEPRI_MAX(priority << (8U - __NVIC_PRIO_BITS));
+        if ((primask & 0x01) == 0)
+            __enable_irq();
+#else
+        __set_BASEPRI_MAX(priority << (8U - __NVIC_PRIO_BITS));
+#endif
+        __ISB();
+        if (previous == 0) {
+            maskStart = DWT->CYCCNT;
+            maskSite = reinterpret_cast<uintptr_t>(__builtin_return_address(0));
+        }
+        return previous;
+    }
+
+    static inline void restore(uint32_t previous) {
+        if (previous == 0) {
+            auto cycles = DWT->CYCCNT - maskStart;
+            maskStats.sections++;
+            if (cycles > maskStats.maxCycles) {
+                maskStats.maxCycles = cycles;
+                maskStats.maxSite = maskSite;
+            }
+        }
+        __set_BASEPRI(previous);
+    }
+
+    static inline void lockRecursive() {
+        auto previous = raise();
         if (++irqLockCounter == 1)
-            irqLockStartStatus = startStatus;
+            irqLockStartBasepri = previous;
     }
 
     static inline void unLockRecursive() {
         if (irqLockCounter != 0) {
-            if (--irqLockCounter == 0) {
-                if (irqLockStartStatus == LockStatus::Unlocked)
-                    __enable_irq();
-            }
+            if (--irqLockCounter == 0)
+                restore(irqLockStartBasepri);
         }
     }
 
     static inline LockStatus isLocked() {
-        return ((__get_PRIMASK() & 0x01) ? LockStatus::Locked
-                                         : LockStatus::Unlocked);
+        auto basepri = __get_BASEPRI();
+        return ((__get_PRIMASK() & 0x01) ||
+                        (basepri != 0 &&
+                         basepri <= (CEILING << (8U - __NVIC_PRIO_BITS)))
+                    ? LockStatus::Locked
+                    : LockStatus::Unlocked);
     }
 
     static inline bool isInIRQ() { return 0 != __get_IPSR(); }
 
+    static IRQMaskStats getMaskStats();
+
+    static void resetMaskStats();
+
 private:
     IRQ() = default;
 
-    static LockStatus irqLockStartStatus;
+    static uint32_t irqLockStartBasepri;
     static uint32_t irqLockCounter;
+    static uint32_t maskStart;
+    static uintptr_t maskSite;
+    static IRQMaskStats maskStats;
 };
 
 class IRQLockRecursive {
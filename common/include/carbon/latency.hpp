@@ -0,0 +1,111 @@
+/**
+ ******************************************************************************
+ * @file           latency.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          interrupt and interrupt to task latency histograms
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+
+#include <stm32h7xx.h>
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CARBON_LATENCY_SYSTIME, /*systime timer, entry latency by the probe*/
+    CARBON_LATENCY_ETH,
+    CARBON_LATENCY_SDMMC,
+    CARBON_LATENCY_SPI2, /*SPI2 and its TX DMA stream*/
+    CARBON_LATENCY_SOURCES,
+    CARBON_LATENCY_NONE = CARBON_LATENCY_SOURCES,
+} CarbonLatencySource;
+
+typedef enum {
+    CARBON_LATENCY_ENTRY,   /*hardware event to the handler*/
+    CARBON_LATENCY_HANDLER, /*handler duration*/
+    CARBON_LATENCY_WAKEUP,  /*handler entry to the woken task running*/
+    CARBON_LATENCY_KINDS,
+} CarbonLatencyKind;
+
+/*DWT stamp of the last entry in the handler of each source*/
+extern volatile uint32_t carbon_latency_entry_stamp[CARBON_LATENCY_SOURCES];
+
+/*first thing in the interrupt handler*/
+static inline uint32_t carbon_latency_enter(CarbonLatencySource source) {
+    uint32_t stamp = DWT->CYCCNT;
+    carbon_latency_entry_stamp[source] = stamp;
+    return stamp;
+}
+
+/*last thing in the interrupt handler*/
+void carbon_latency_exit(CarbonLatencySource source, uint32_t enter);
+
+/*count, p50, p99, max in DWT cycles, returns -1 for a wrong index*/
+int carbon_latency_get(uint32_t source, uint32_t kind, uint32_t values[4]);
+
+const char *carbon_latency_source_name(uint32_t source);
+
+const char *carbon_latency_kind_name(uint32_t kind);
+
+void carbon_latency_reset(void);
+
+#ifdef __cplusplus
+}
+
+#include <carbon/latency_histogram.hpp>
+
+namespace CARBON {
+
+/*
+ * One histogram per source and kind. The writers of one histogram never run
+ * concurrently: the handlers of a source share the preemption priority and
+ * the wakeups are recorded under the IRQ ceiling.
+ */
+LatencyHistogram &latencyHistogram(CarbonLatencySource source,
+                                   CarbonLatencyKind kind);
+
+/*under the IRQ ceiling, cycles from the handler entry*/
+inline void latencyWakeup(CarbonLatencySource source, uint32_t cycles) {
+    if (source < CARBON_LATENCY_SOURCES)
+        latencyHistogram(source, CARBON_LATENCY_WAKEUP).record(cycles);
+}
+
+/*
+ * The systime probe interrupt comes every period of the 1 MHz timer, an
+ * exact number of core cycles: the delay of each entry is measured against
+ * the earliest one, with cycle resolution. Started and stopped on demand by
+ * systimeProbe(), from latency.probe().
+ */
+void latencyProbeStart(uint32_t periodUs);
+
+/*from the systime interrupt, with its entry stamp*/
+void latencyProbeTick(uint32_t stamp);
+
+#ifdef FREERTOS_USE_TRACE
+/*pushes the next non empty histogram to the trace stream*/
+void latencyPublish();
+#endif
+
+} // namespace CARBON
+#endif
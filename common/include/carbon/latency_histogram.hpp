@@ -0,0 +1,161 @@
+/**
+ ******************************************************************************
+ * @file           latency_histogram.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          lock-free latency histogram with logarithmic buckets
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace CARBON {
+
+/*
+ * Values below LATENCY_LINEAR have their own bucket, above it each power of
+ * two is split in 2^LATENCY_SUB_BITS buckets: 12.5% resolution. Values from
+ * 2^(LATENCY_MAX_EXPONENT + 1) are counted in the last bucket.
+ */
+static constexpr uint32_t LATENCY_SUB_BITS = 3;
+static constexpr uint32_t LATENCY_MAX_EXPONENT = 22;
+static constexpr uint32_t LATENCY_LINEAR = 2U << LATENCY_SUB_BITS;
+static constexpr uint32_t LATENCY_BUCKETS =
+    LATENCY_LINEAR + (LATENCY_MAX_EXPONENT - LATENCY_SUB_BITS) *
+                         (1U << LATENCY_SUB_BITS);
+
+constexpr uint32_t latencyBucket(uint32_t value) {
+    if (value < LATENCY_LINEAR)
+        return value;
+    auto exponent = 31U - static_cast<uint32_t>(__builtin_clz(value));
+    if (exponent > LATENCY_MAX_EXPONENT)
+        return LATENCY_BUCKETS - 1;
+    auto sub = (value >> (exponent - LATENCY_SUB_BITS)) &
+               ((1U << LATENCY_SUB_BITS) - 1);
+    return LATENCY_LINEAR +
+           (exponent - LATENCY_SUB_BITS - 1) * (1U << LATENCY_SUB_BITS) + sub;
+}
+
+/*smallest value counted in the bucket*/
+constexpr uint32_t latencyBucketLow(uint32_t bucket) {
+    if (bucket < LATENCY_LINEAR)
+        return bucket;
+    auto index = bucket - LATENCY_LINEAR;
+    auto exponent = index / (1U << LATENCY_SUB_BITS) + LATENCY_SUB_BITS + 1;
+    auto sub = index % (1U << LATENCY_SUB_BITS);
+    return (1U << exponent) + (sub << (exponent - LATENCY_SUB_BITS));
+}
+
+/*largest value counted in the bucket, saturated for the last one*/
+constexpr uint32_t latencyBucketHigh(uint32_t bucket) {
+    if (bucket == LATENCY_BUCKETS - 1)
+        return UINT32_MAX;
+    return latencyBucketLow(bucket + 1) - 1;
+}
+
+static_assert(latencyBucket(LATENCY_LINEAR - 1) == LATENCY_LINEAR - 1);
+static_assert(latencyBucket(LATENCY_LINEAR) == LATENCY_LINEAR);
+static_assert(latencyBucketLow(latencyBucket(1000)) <= 1000);
+static_assert(latencyBucketHigh(latencyBucket(1000)) >= 1000);
+static_assert(latencyBucket((2U << LATENCY_MAX_EXPONENT) - 1) ==
+              LATENCY_BUCKETS - 1);
+
+struct LatencySummary {
+    uint32_t count;
+    uint32_t p50; /*upper bound of the bucket*/
+    uint32_t p99;
+    uint32_t max;
+};
+
+/*
+ * One writer, an interrupt or a task, any number of readers: the counters
+ * are single word stores, a reader sees each of them either before or after
+ * the update. reset() racing with the writer may leave one sample.
+ */
+class LatencyHistogram {
+public:
+    constexpr LatencyHistogram() = default;
+
+    LatencyHistogram(const LatencyHistogram &) = delete;
+    LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+    void record(uint32_t value) {
+        auto &bucket = counts_[latencyBucket(value)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_relaxed);
+        if (value > max_.load(std::memory_order_relaxed))
+            max_.store(value, std::memory_order_relaxed);
+        count_.store(count_.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_relaxed);
+    }
+
+    uint32_t count(uint32_t bucket) const {
+        return counts_[bucket].load(std::memory_order_relaxed);
+    }
+
+    uint32_t count() const { return count_.load(std::memory_order_relaxed); }
+
+    uint32_t max() const { return max_.load(std::memory_order_relaxed); }
+
+    /*upper bound of the bucket holding the percentile, 0 if empty*/
+    uint32_t percentile(uint32_t percent) const {
+        uint32_t total = 0;
+        for (uint32_t i = 0; i < LATENCY_BUCKETS; i++)
+            total += count(i);
+        if (total == 0)
+            return 0;
+        /*rank of the sample, rounded up*/
+        auto rank = (uint64_t{total} * percent + 99) / 100;
+        if (rank == 0)
+            rank = 1;
+        uint64_t seen = 0;
+        for (uint32_t i = 0; i < LATENCY_BUCKETS; i++) {
+            seen += count(i);
+            if (seen >= rank) {
+                auto high = latencyBucketHigh(i);
+                auto maximum = max();
+                return high < maximum ? high : maximum;
+            }
+        }
+        return max();
+    }
+
+    LatencySummary summary() const {
+        return LatencySummary{count(), percentile(50), percentile(99), max()};
+    }
+
+    /*adds the samples of other, the writer of this one*/
+    void merge(const LatencyHistogram &other) {
+        for (uint32_t i = 0; i < LATENCY_BUCKETS; i++)
+            counts_[i].store(count(i) + other.count(i),
+                             std::memory_order_relaxed);
+        if (other.max() > max())
+            max_.store(other.max(), std::memory_order_relaxed);
+        count_.store(count() + other.count(), std::memory_order_relaxed);
+    }
+
+    void reset() {
+        for (auto &bucket : counts_)
+            bucket.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+        count_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint32_t> counts_[LATENCY_BUCKETS]{};
+    std::atomic<uint32_t> count_{0};
+    std::atomic<uint32_t> max_{0};
+};
+
+} // namespace CARBON
@@ -0,0 +1,294 @@
+/**
+ ******************************************************************************
+ * @file           mailbox.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Message passing between the cores, fixed slot queues
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+#include <carbon/sync.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace CARBON {
+
+static constexpr uint32_t MAILBOX_PAYLOAD_SIZE = 48;
+static constexpr uint32_t MAILBOX_SLOTS = 16;
+
+enum class MailboxKind : uint16_t { Event, Request, Response };
+
+/*system message types, the host tests are free to use their own*/
+enum class MailboxType : uint16_t { Ping, Offload };
+
+struct MailboxMessage {
+    uint16_t type;
+    MailboxKind kind;
+    uint32_t correlationId; /*0 for events*/
+    uint32_t status;        /*set by the responder*/
+    uint32_t length;        /*payload bytes*/
+    uint8_t payload[MAILBOX_PAYLOAD_SIZE];
+
+    template <typename T> void setPayload(const T &value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        static_assert(sizeof(T) <= MAILBOX_PAYLOAD_SIZE);
+        std::memcpy(payload, &value, sizeof(T));
+        length = sizeof(T);
+    }
+
+    template <typename T> bool getPayload(T &value) const {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (length != sizeof(T))
+            return false;
+        std::memcpy(&value, payload, sizeof(T));
+        return true;
+    }
+};
+
+static_assert(sizeof(MailboxMessage) == 64);
+
+/*
+ * Single producer single consumer queue. The object is a POD so that it can
+ * live in a NOLOAD shared section, init() is called by one core only.
+ */
+template <uint32_t NSlots> class MailboxQueue {
+    static_assert((NSlots & (NSlots - 1)) == 0, "slots must be a power of 2");
+
+public:
+    void init() {
+        std::atomic_ref<uint32_t>(head_).store(0, std::memory_order_relaxed);
+        std::atomic_ref<uint32_t>(tail_).store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    /*producer side, returns the number of messages queued*/
+    uint32_t post(const MailboxMessage *messages, uint32_t n) {
+        std::atomic_ref<uint32_t> head(head_);
+        std::atomic_ref<uint32_t> tail(tail_);
+        auto h = head.load(std::memory_order_relaxed);
+        auto free = NSlots - (h - tail.load(std::memory_order_acquire));
+        if (n > free)
+            n = free;
+        for (uint32_t i = 0; i < n; i++) {
+            slots_[(h + i) & (NSlots - 1)] = messages[i];
+        }
+        head.store(h + n, std::memory_order_release);
+        return n;
+    }
+
+    /*consumer side, returns the number of messages copied*/
+    uint32_t receive(MailboxMessage *messages, uint32_t n) {
+        std::atomic_ref<uint32_t> head(head_);
+        std::atomic_ref<uint32_t> tail(tail_);
+        auto t = tail.load(std::memory_order_relaxed);
+        auto used = head.load(std::memory_order_acquire) - t;
+        if (n > used)
+            n = used;
+        for (uint32_t i = 0; i < n; i++) {
+            messages[i] = slots_[(t + i) & (NSlots - 1)];
+        }
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    uint32_t size() const {
+        std::atomic_ref<uint32_t> head(head_);
+        std::atomic_ref<uint32_t> tail(tail_);
+        return head.load(std::memory_order_acquire) -
+               tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+private:
+    alignas(CACHE_ALIGNMENT) mutable uint32_t head_;
+    alignas(CACHE_ALIGNMENT) mutable uint32_t tail_;
+    alignas(CACHE_ALIGNMENT) MailboxMessage slots_[NSlots];
+};
+
+using MailboxQueueType = MailboxQueue<MAILBOX_SLOTS>;
+
+/*both directions, placed in shared memory*/
+struct MailboxShared {
+    MailboxQueueType toCM4;
+    MailboxQueueType toCM7;
+
+    void init() {
+        toCM4.init();
+        toCM7.init();
+    }
+};
+
+struct MailboxStats {
+    uint32_t posted;
+    uint32_t received;
+    uint32_t full; /*messages not posted, queue full*/
+    uint32_t doorbells;
+    uint32_t timeouts;
+};
+
+/*
+ * One end of the channel. The doorbell wakes the other end after a post:
+ * ring(), prepare() before the last check of the queue, cancel() if the
+ * check succeeded, otherwise wait(timeoutMs) which also cancels, nowMs().
+ * The queue has a single producer: TxLock serializes the local posters.
+ */
+template <typename Doorbell, typename TxLock> class Mailbox {
+public:
+    Mailbox(MailboxQueueType &tx, MailboxQueueType &rx, Doorbell &doorbell)
+        : tx_(tx), rx_(rx), doorbell_(doorbell), nextCorrelationId_(1),
+          stats_{} {}
+
+    PREVENT_COPY_AND_MOVE(Mailbox)
+
+    /*a single doorbell for the whole batch*/
+    uint32_t postBatch(const MailboxMessage *messages, uint32_t n) {
+        uint32_t posted;
+        {
+            LockGuard<TxLock> lock(txLock_);
+            posted = tx_.post(messages, n);
+            stats_.posted += posted;
+            stats_.full += n - posted;
+            if (posted > 0)
+                stats_.doorbells++;
+        }
+        if (posted > 0)
+            doorbell_.ring();
+        return posted;
+    }
+
+    bool post(const MailboxMessage &message) {
+        return postBatch(&message, 1) == 1;
+    }
+
+    bool postEvent(uint16_t type, const void *payload, uint32_t length) {
+        MailboxMessage message;
+        if (!fill(message, type, MailboxKind::Event, 0, payload, length))
+            return false;
+        return post(message);
+    }
+
+    /*returns the correlation id of the request, 0 if not posted*/
+    uint32_t request(uint16_t type, const void *payload, uint32_t length) {
+        MailboxMessage message;
+        auto id = newCorrelationId();
+        if (!fill(message, type, MailboxKind::Request, id, payload, length))
+            return 0;
+        return post(message) ? id : 0;
+    }
+
+    bool respond(const MailboxMessage &request, uint32_t status,
+                 const void *payload, uint32_t length) {
+        MailboxMessage message;
+        if (!fill(message, request.type, MailboxKind::Response,
+                  request.correlationId, payload, length))
+            return false;
+        message.status = status;
+        return post(message);
+    }
+
+    bool tryReceive(MailboxMessage &message) {
+        if (rx_.receive(&message, 1) == 0)
+            return false;
+        stats_.received++;
+        return true;
+    }
+
+    uint32_t receiveBatch(MailboxMessage *messages, uint32_t n) {
+        auto received = rx_.receive(messages, n);
+        stats_.received += received;
+        return received;
+    }
+
+    /*waits for the doorbell if the queue is empty*/
+    bool receive(MailboxMessage &message, uint32_t timeoutMs) {
+        auto start = doorbell_.nowMs();
+        while (!tryReceive(message)) {
+            auto elapsed = doorbell_.nowMs() - start;
+            if (elapsed >= timeoutMs) {
+                stats_.timeouts++;
+                return false;
+            }
+            doorbell_.prepare();
+            if (!rx_.empty()) {
+                doorbell_.cancel();
+                continue;
+            }
+            doorbell_.wait(timeoutMs - elapsed);
+        }
+        return true;
+    }
+
+    /*
+     * Request and wait for the matching response. Other messages received
+     * meanwhile are passed to the handler, they are not lost.
+     */
+    template <typename Handler>
+    bool call(uint16_t type, const void *payload, uint32_t length,
+              MailboxMessage &response, uint32_t timeoutMs,
+              Handler &&handler) {
+        auto id = request(type, payload, length);
+        if (id == 0)
+            return false;
+        auto start = doorbell_.nowMs();
+        while (true) {
+            auto elapsed = doorbell_.nowMs() - start;
+            if (elapsed >= timeoutMs ||
+                !receive(response, timeoutMs - elapsed))
+                return false;
+            if (response.kind == MailboxKind::Response &&
+                response.correlationId == id)
+                return true;
+            handler(response);
+        }
+    }
+
+    const MailboxStats &stats() const { return stats_; }
+
+private:
+    uint32_t newCorrelationId() {
+        LockGuard<TxLock> lock(txLock_);
+        auto id = nextCorrelationId_++;
+        if (nextCorrelationId_ == 0)
+            nextCorrelationId_ = 1;
+        return id;
+    }
+
+    static bool fill(MailboxMessage &message, uint16_t type, MailboxKind kind,
+                     uint32_t correlationId, const void *payload,
+                     uint32_t length) {
+        if (length > MAILBOX_PAYLOAD_SIZE)
+            return false;
+        message.type = type;
+        message.kind = kind;
+        message.correlationId = correlationId;
+        message.status = 0;
+        message.length = length;
+        if (length > 0)
+            std::memcpy(message.payload, payload, length);
+        return true;
+    }
+
+    MailboxQueueType &tx_;
+    MailboxQueueType &rx_;
+    Doorbell &doorbell_;
+    TxLock txLock_;
+    uint32_t nextCorrelationId_;
+    MailboxStats stats_;
+};
+
+} // namespace CARBON
@@ -0,0 +1,110 @@
+/**
+ ******************************************************************************
+ * @file           modbus_frame.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Modbus TCP frames, encoding and checks
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CARBON {
+
+/*
+ * A Modbus TCP frame is the MBAP header followed by the PDU, every field
+ * big endian:
+ *   transaction id  2 bytes, echoed by the slave
+ *   protocol id     2 bytes, 0
+ *   length          2 bytes, the unit id and the PDU
+ *   unit id         1 byte, the slave id
+ *   function        1 byte, with MODBUS_EXCEPTION set in an error reply
+ *   data            up to 252 bytes
+ */
+static constexpr size_t MODBUS_MBAP_SIZE = 7;
+static constexpr size_t MODBUS_MAX_FRAME_SIZE = MODBUS_MBAP_SIZE + 253;
+/*function, address and quantity or value*/
+static constexpr size_t MODBUS_REQUEST_SIZE = MODBUS_MBAP_SIZE + 5;
+static constexpr uint8_t MODBUS_EXCEPTION = 0x80;
+
+inline void modbusPut16(uint8_t *bytes, uint16_t value) {
+    bytes[0] = static_cast<uint8_t>(value >> 8);
+    bytes[1] = static_cast<uint8_t>(value);
+}
+
+inline uint16_t modbusGet16(const uint8_t *bytes) {
+    return static_cast<uint16_t>((bytes[0] << 8) | bytes[1]);
+}
+
+/*
+ * The read requests carry the quantity of registers, the write single
+ * register one the value. Returns MODBUS_REQUEST_SIZE.
+ */
+inline size_t modbusEncodeRequest(uint8_t *frame, uint16_t transaction,
+                                  uint8_t unit, uint8_t function,
+                                  uint16_t address, uint16_t argument) {
+    modbusPut16(frame, transaction);
+    modbusPut16(frame + 2, 0);
+    modbusPut16(frame + 4, MODBUS_REQUEST_SIZE - 6);
+    frame[6] = unit;
+    frame[7] = function;
+    modbusPut16(frame + 8, address);
+    modbusPut16(frame + 10, argument);
+    return MODBUS_REQUEST_SIZE;
+}
+
+/*the size told by the MBAP header, 0 until the length is received*/
+inline size_t modbusFrameSize(const uint8_t *frame, size_t len) {
+    if (len < 6)
+        return 0;
+    return 6 + modbusGet16(frame + 4);
+}
+
+/*the reply of the request: whole, same transaction, unit and function*/
+inline bool modbusCheckReply(const uint8_t *reply, size_t len,
+                             const uint8_t *request) {
+    return len >= MODBUS_MBAP_SIZE + 2 &&
+           modbusGet16(reply) == modbusGet16(request) &&
+           modbusGet16(reply + 2) == 0 && modbusFrameSize(reply, len) == len &&
+           reply[6] == request[6] && reply[7] == request[7];
+}
+
+/*count registers of a read holding or input registers reply*/
+inline bool modbusDecodeRead(const uint8_t *reply, size_t len,
+                             const uint8_t *request, uint16_t *values,
+                             uint16_t count) {
+    if (!modbusCheckReply(reply, len, request) ||
+        modbusGet16(request + 10) != count ||
+        reply[MODBUS_MBAP_SIZE + 1] != count * 2 ||
+        len != MODBUS_MBAP_SIZE + 2 + count * 2U)
+        return false;
+    for (uint16_t i = 0; i < count; i++)
+        values[i] = modbusGet16(reply + MODBUS_MBAP_SIZE + 2 + 2 * i);
+    return true;
+}
+
+/*the slave echoes a write single register request*/
+inline bool modbusDecodeWrite(const uint8_t *reply, size_t len,
+                              const uint8_t *request) {
+    if (len != MODBUS_REQUEST_SIZE)
+        return false;
+    for (size_t i = 0; i < MODBUS_REQUEST_SIZE; i++) {
+        if (reply[i] != request[i])
+            return false;
+    }
+    return true;
+}
+
+} // namespace CARBON
@@ -0,0 +1,119 @@
+/**
+ ******************************************************************************
+ * @file           net_bench_format.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          wire format of the network benchmark, board and host client
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/*
+ * One test per control connection, iperf style:
+ *   client -> board  NetBenchRequest on the control port
+ *   board -> client  NetBenchReport, the status only: the test can start
+ *   TCP modes        the client connects to the data port
+ *   UDP modes        datagrams to the data port of the board, or from it to
+ *                    the udpPort of the client
+ *   board -> client  NetBenchReport with the counters, then close
+ * Modes and byte counters are seen from the board. Little endian.
+ */
+
+namespace CARBON {
+
+static constexpr uint16_t NET_BENCH_CONTROL_PORT = 5201;
+static constexpr uint16_t NET_BENCH_DATA_PORT = 5202;
+static constexpr uint32_t NET_BENCH_MAGIC = 0x424E4243; /*"CBNB"*/
+static constexpr uint32_t NET_BENCH_VERSION = 1;
+static constexpr uint32_t NET_BENCH_MAX_BUFFER = 16384;
+static constexpr uint32_t NET_BENCH_MAX_DURATION = 600000; /*ms*/
+static constexpr uint32_t NET_BENCH_CPU_UNKNOWN = 0xFFFFFFFF;
+
+enum class NetBenchMode : uint8_t {
+    TcpRx = 0, /*the client sends*/
+    TcpTx,     /*the board sends*/
+    TcpBidir,  /*both, the client connects its sending stream first*/
+    UdpRx,
+    UdpTx,
+    Count
+};
+
+enum class NetBenchSink : uint8_t {
+    Null = 0, /*discarded*/
+    Sdram,    /*copied in a ring in the Bulk heap*/
+    Sd,       /*written to a file of the SD card*/
+    Count
+};
+
+enum class NetBenchStatus : uint8_t {
+    Ok = 0,
+    BadRequest,
+    NoMemory,
+    NoSdCard,
+    NoConnection, /*the data connection did not come*/
+    NetworkError,
+    SinkError
+};
+
+#pragma pack(push, 1)
+
+struct NetBenchRequest {
+    uint32_t magic{NET_BENCH_MAGIC};
+    uint32_t version{NET_BENCH_VERSION};
+    NetBenchMode mode{NetBenchMode::TcpRx};
+    NetBenchSink sink{NetBenchSink::Null};
+    uint16_t udpPort{0};     /*of the client, UdpTx*/
+    uint32_t bufferSize{0};  /*write size, UDP datagram size*/
+    uint32_t durationMs{0};  /*of the sender*/
+    uint32_t udpRateKbps{0}; /*UdpTx, 0 as fast as possible*/
+};
+
+static_assert(sizeof(NetBenchRequest) == 24);
+
+struct NetBenchReport {
+    uint32_t magic{NET_BENCH_MAGIC};
+    NetBenchStatus status{NetBenchStatus::Ok};
+    NetBenchMode mode{NetBenchMode::TcpRx};
+    NetBenchSink sink{NetBenchSink::Null};
+    uint8_t reserved{0};
+    uint64_t rxBytes{0};
+    uint64_t txBytes{0};
+    uint32_t elapsedUs{0};
+    uint32_t cpuLoadPermille{NET_BENCH_CPU_UNKNOWN};
+    uint32_t retransmits{0}; /*TCP segments, all connections*/
+    uint32_t tcpDrops{0};
+    uint32_t udpDrops{0};
+    uint32_t linkDrops{0};
+    uint32_t datagrams{0};    /*UDP received or sent*/
+    uint32_t lost{0};         /*UdpRx gaps in the sequence, UdpTx not sent*/
+    uint32_t outOfOrder{0};   /*UdpRx*/
+    uint32_t jitterUs{0};     /*UdpRx, RFC 3550 estimate*/
+    uint32_t sinkErrors{0};   /*writes the sink failed*/
+    uint32_t sinkMaxWriteUs{0};
+};
+
+static_assert(sizeof(NetBenchReport) == 72);
+
+/*head of every UDP datagram*/
+struct NetBenchDatagram {
+    uint32_t sequence{0};
+    uint32_t sentUs{0}; /*clock of the sender*/
+};
+
+static_assert(sizeof(NetBenchDatagram) == 8);
+
+#pragma pack(pop)
+
+} // namespace CARBON
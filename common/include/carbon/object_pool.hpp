@@ -0,0 +1,230 @@
+/**
+ ******************************************************************************
+ * @file           object_pool.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          fixed block lock free object pool
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*double free checks, by default in the debug builds*/
+#ifndef CARBON_POOL_CHECKED
+#ifdef NDEBUG
+#define CARBON_POOL_CHECKED false
+#else
+#define CARBON_POOL_CHECKED true
+#endif
+#endif
+
+namespace CARBON {
+
+struct PoolStats {
+    uint32_t capacity;
+    uint32_t used;
+    uint32_t highWater;
+    uint32_t failures; /*allocations found the pool empty*/
+    uint32_t badFrees; /*foreign blocks, double frees in checked pools*/
+};
+
+/*
+ * The blocks are inside the pool object: the placement of the object is the
+ * placement of the blocks, e.g. CARBON_FAST_BSS for DTCM.
+ */
+struct InlineRegion {
+    template <size_t Bytes, size_t Align> class Storage {
+    public:
+        uint8_t *get() { return bytes_; }
+
+    private:
+        alignas(Align) uint8_t bytes_[Bytes];
+    };
+};
+
+/*
+ * Treiber stack of block indices: the head carries a 16 bit tag counting
+ * the pops, a block freed and allocated again between the load and the
+ * compare exchange of another context does not match the head anymore.
+ * Usable from the interrupts: on the Cortex-M an exception clears the
+ * exclusive monitor and the interrupted compare exchange is retried.
+ * init() from one task before any other use.
+ */
+template <typename T, uint32_t N, typename Region = InlineRegion,
+          bool Checked = CARBON_POOL_CHECKED>
+class ObjectPool {
+public:
+    static_assert(N > 0 && N < 0xFFFF, "16 bit block indices");
+
+    static constexpr size_t BLOCK_SIZE =
+        (sizeof(T) + alignof(T) - 1) & ~(alignof(T) - 1);
+
+    ObjectPool() = default;
+
+    PREVENT_COPY_AND_MOVE(ObjectPool)
+
+    /*false if the region has no memory*/
+    bool init() {
+        blocks_ = storage_.get();
+        if (blocks_ == nullptr)
+            return false;
+        for (uint32_t i = 0; i < N; i++) {
+            next_[i].store(static_cast<uint16_t>(i + 1),
+                           std::memory_order_relaxed);
+            if constexpr (Checked)
+                allocated_[i].store(false, std::memory_order_relaxed);
+        }
+        used_.store(0, std::memory_order_relaxed);
+        highWater_.store(0, std::memory_order_relaxed);
+        failures_.store(0, std::memory_order_relaxed);
+        badFrees_.store(0, std::memory_order_relaxed);
+        head_.store(0, std::memory_order_release);
+        return true;
+    }
+
+    /*nullptr when empty*/
+    void *allocate() {
+        auto head = head_.load(std::memory_order_acquire);
+        uint32_t index;
+        do {
+            index = head & INDEX_MASK;
+            if (index == EMPTY) {
+                failures_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            auto next = next_[index].load(std::memory_order_relaxed);
+            auto tagged = ((head + TAG_ONE) & TAG_MASK) | next;
+            if (head_.compare_exchange_weak(head, tagged,
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire))
+                break;
+        } while (true);
+
+        if constexpr (Checked)
+            allocated_[index].store(true, std::memory_order_relaxed);
+        auto used = used_.fetch_add(1, std::memory_order_relaxed) + 1;
+        auto highWater = highWater_.load(std::memory_order_relaxed);
+        while (used > highWater &&
+               !highWater_.compare_exchange_weak(highWater, used,
+                                                 std::memory_order_relaxed))
+            ;
+        return blocks_ + index * BLOCK_SIZE;
+    }
+
+    /*false for nullptr or a block of another pool, or already free, checked*/
+    bool free(void *pointer) {
+        auto index = indexOf(pointer);
+        if (index == EMPTY) {
+            badFrees_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if constexpr (Checked) {
+            bool expected = true;
+            if (!allocated_[index].compare_exchange_strong(
+                    expected, false, std::memory_order_relaxed)) {
+                badFrees_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        used_.fetch_sub(1, std::memory_order_relaxed);
+
+        auto head = head_.load(std::memory_order_relaxed);
+        do {
+            next_[index].store(static_cast<uint16_t>(head & INDEX_MASK),
+                               std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(
+            head, (head & TAG_MASK) | index, std::memory_order_release,
+            std::memory_order_relaxed));
+        return true;
+    }
+
+    template <typename... Args> T *create(Args &&...args) {
+        auto block = allocate();
+        if (block == nullptr)
+            return nullptr;
+        return new (block) T(std::forward<Args>(args)...);
+    }
+
+    bool destroy(T *object) {
+        if (object == nullptr)
+            return false;
+        bool valid;
+        if constexpr (Checked)
+            valid = isAllocated(object);
+        else
+            valid = indexOf(object) != EMPTY;
+        if (!valid) {
+            badFrees_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        object->~T();
+        return free(object);
+    }
+
+    /*the pointer is the start of one of the blocks*/
+    bool owns(const void *pointer) const {
+        return blocks_ != nullptr && indexOf(pointer) != EMPTY;
+    }
+
+    PoolStats stats() const {
+        return PoolStats{N, used_.load(std::memory_order_relaxed),
+                         highWater_.load(std::memory_order_relaxed),
+                         failures_.load(std::memory_order_relaxed),
+                         badFrees_.load(std::memory_order_relaxed)};
+    }
+
+private:
+    static constexpr uint32_t EMPTY = N;
+    static constexpr uint32_t INDEX_MASK = 0xFFFF;
+    static constexpr uint32_t TAG_MASK = 0xFFFF0000;
+    static constexpr uint32_t TAG_ONE = 0x10000;
+
+    uint32_t indexOf(const void *pointer) const {
+        auto address = reinterpret_cast<uintptr_t>(pointer);
+        auto base = reinterpret_cast<uintptr_t>(blocks_);
+        if (address < base || address >= base + N * BLOCK_SIZE ||
+            (address - base) % BLOCK_SIZE != 0)
+            return EMPTY;
+        return static_cast<uint32_t>((address - base) / BLOCK_SIZE);
+    }
+
+    bool isAllocated(const void *pointer) const {
+        auto index = indexOf(pointer);
+        return index != EMPTY &&
+               allocated_[index].load(std::memory_order_relaxed);
+    }
+
+    struct NoFlags {};
+    using Flags =
+        std::conditional_t<Checked, std::atomic<bool>[N], NoFlags>;
+
+    typename Region::template Storage<N * BLOCK_SIZE, alignof(T)> storage_;
+    uint8_t *blocks_{nullptr};
+    std::atomic<uint32_t> head_{EMPTY};
+    std::atomic<uint16_t> next_[N];
+    [[no_unique_address]] Flags allocated_;
+    std::atomic<uint32_t> used_{0};
+    std::atomic<uint32_t> highWater_{0};
+    std::atomic<uint32_t> failures_{0};
+    std::atomic<uint32_t> badFrees_{0};
+};
+
+} // namespace CARBON
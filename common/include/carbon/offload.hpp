@@ -0,0 +1,267 @@
+/**
+ ******************************************************************************
+ * @file           offload.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Jobs posted by the CM7 and executed by the CM4
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+#include <carbon/inplace_function.hpp>
+#include <carbon/mailbox.hpp>
+#include <carbon/sync.hpp>
+
+#include <cstdint>
+#include <utility>
+
+namespace CARBON {
+
+enum class OffloadFunction : uint16_t { Crc32, Fnv1a32, Count };
+
+enum class OffloadStatus : uint32_t {
+    Done,
+    UnknownFunction,
+    BadJob,
+};
+
+/*the buffers must be reachable by the CM4: AXI SRAM, D2 SRAM or SDRAM*/
+struct OffloadJob {
+    OffloadFunction function;
+    uint16_t reserved;
+    uint32_t arg; /*initial value for the checksums*/
+    uintptr_t input;
+    uint32_t inputLength;
+    uintptr_t output;
+    uint32_t outputLength;
+};
+
+struct OffloadResult {
+    OffloadStatus status;
+    uint32_t value;
+    uint32_t outputLength;
+    uint64_t startUs; /*CM7 time base*/
+    uint64_t endUs;
+};
+
+static_assert(sizeof(OffloadJob) <= MAILBOX_PAYLOAD_SIZE);
+static_assert(sizeof(OffloadResult) <= MAILBOX_PAYLOAD_SIZE);
+
+/*executes the job on the calling core*/
+OffloadStatus offloadExecute(const OffloadJob &job, OffloadResult &result);
+
+struct OffloadLatency {
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t sumUs;
+
+    void add(uint64_t us) {
+        auto value = us > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(us);
+        if (count == 0 || value < minUs)
+            minUs = value;
+        if (value > maxUs)
+            maxUs = value;
+        sumUs += value;
+        count++;
+    }
+
+    uint32_t avgUs() const {
+        return count == 0 ? 0 : static_cast<uint32_t>(sumUs / count);
+    }
+};
+
+struct OffloadStats {
+    uint32_t submitted;
+    uint32_t completed;
+    uint32_t rejected; /*no free slot, queue full or unreachable buffer*/
+    uint32_t failed;   /*completed with an error status*/
+    OffloadLatency queue;      /*post to start of execution*/
+    OffloadLatency execution;  /*start to end of execution*/
+    OffloadLatency completion; /*end of execution to completion handling*/
+    OffloadLatency total;
+};
+
+/*
+ * The platform policy provides nowUs() in a time base common to both the
+ * cores, yield(), and the cache maintenance of the job buffers: clean(),
+ * invalidate() and reachable().
+ */
+template <typename Mailbox, typename Platform> class OffloadWorker {
+public:
+    explicit OffloadWorker(Mailbox &mailbox) : mailbox_(mailbox), jobs_(0) {}
+
+    PREVENT_COPY_AND_MOVE(OffloadWorker)
+
+    /*returns false if the message is not a job*/
+    bool process(const MailboxMessage &message) {
+        if (message.type != static_cast<uint16_t>(MailboxType::Offload) ||
+            message.kind != MailboxKind::Request)
+            return false;
+
+        OffloadJob job;
+        OffloadResult result{};
+        result.startUs = Platform::nowUs();
+        if (message.getPayload(job)) {
+            result.status = offloadExecute(job, result);
+        } else {
+            result.status = OffloadStatus::BadJob;
+        }
+        result.endUs = Platform::nowUs();
+
+        while (!mailbox_.respond(message, static_cast<uint32_t>(result.status),
+                                 &result, sizeof(result))) {
+            Platform::yield();
+        }
+        jobs_++;
+        return true;
+    }
+
+    uint32_t jobs() const { return jobs_; }
+
+private:
+    Mailbox &mailbox_;
+    uint32_t jobs_;
+};
+
+using OffloadCallback =
+    inplace_function<void(const OffloadJob &, const OffloadResult &), 16>;
+
+/*
+ * CM7 side: submit() posts the job, complete() is called by the task that
+ * receives from the mailbox and runs the callback of the matching job.
+ */
+template <typename Mailbox, typename Platform, typename Lock,
+          uint32_t MaxPending = 8>
+class OffloadClient {
+public:
+    explicit OffloadClient(Mailbox &mailbox)
+        : mailbox_(mailbox), pending_{}, stats_{} {}
+
+    PREVENT_COPY_AND_MOVE(OffloadClient)
+
+    /*returns the ticket of the job, 0 if not submitted*/
+    uint32_t submit(const OffloadJob &job, OffloadCallback callback) {
+        if (!Platform::reachable(job.input, job.inputLength) ||
+            !Platform::reachable(job.output, job.outputLength)) {
+            LockGuard<Lock> lock(lock_);
+            stats_.rejected++;
+            return 0;
+        }
+
+        Platform::clean(job.input, job.inputLength);
+        Platform::clean(job.output, job.outputLength);
+
+        /*the lock covers the post, the completion cannot come first*/
+        LockGuard<Lock> lock(lock_);
+        auto slot = findSlot(0);
+        if (slot == nullptr) {
+            stats_.rejected++;
+            return 0;
+        }
+        slot->postUs = Platform::nowUs();
+        auto ticket = mailbox_.request(
+            static_cast<uint16_t>(MailboxType::Offload), &job, sizeof(job));
+        if (ticket == 0) {
+            stats_.rejected++;
+            return 0;
+        }
+        slot->ticket = ticket;
+        slot->job = job;
+        slot->callback = std::move(callback);
+        stats_.submitted++;
+        return ticket;
+    }
+
+    /*returns false if the message is not a completion*/
+    bool complete(const MailboxMessage &message) {
+        if (message.type != static_cast<uint16_t>(MailboxType::Offload) ||
+            message.kind != MailboxKind::Response)
+            return false;
+
+        Pending done;
+        {
+            LockGuard<Lock> lock(lock_);
+            auto slot = findSlot(message.correlationId);
+            if (slot == nullptr)
+                return true; /*not ours anymore*/
+            done = std::move(*slot);
+            *slot = Pending{};
+        }
+
+        OffloadResult result{};
+        if (!message.getPayload(result))
+            result.status = OffloadStatus::BadJob;
+        Platform::invalidate(done.job.output, done.job.outputLength);
+
+        auto now = Platform::nowUs();
+        {
+            LockGuard<Lock> lock(lock_);
+            stats_.completed++;
+            if (result.status != OffloadStatus::Done)
+                stats_.failed++;
+            stats_.queue.add(elapsed(done.postUs, result.startUs));
+            stats_.execution.add(elapsed(result.startUs, result.endUs));
+            stats_.completion.add(elapsed(result.endUs, now));
+            stats_.total.add(elapsed(done.postUs, now));
+        }
+
+        if (done.callback)
+            done.callback(done.job, result);
+        return true;
+    }
+
+    uint32_t pending() {
+        LockGuard<Lock> lock(lock_);
+        uint32_t n = 0;
+        for (auto &slot : pending_) {
+            if (slot.ticket != 0)
+                n++;
+        }
+        return n;
+    }
+
+    OffloadStats stats() {
+        LockGuard<Lock> lock(lock_);
+        return stats_;
+    }
+
+private:
+    struct Pending {
+        uint32_t ticket;
+        uint64_t postUs;
+        OffloadJob job;
+        OffloadCallback callback;
+    };
+
+    Pending *findSlot(uint32_t ticket) {
+        for (auto &slot : pending_) {
+            if (slot.ticket == ticket)
+                return &slot;
+        }
+        return nullptr;
+    }
+
+    /*the clocks of the cores are corrected, small negative values happen*/
+    static uint64_t elapsed(uint64_t from, uint64_t to) {
+        return to > from ? to - from : 0;
+    }
+
+    Mailbox &mailbox_;
+    Lock lock_;
+    Pending pending_[MaxPending];
+    OffloadStats stats_;
+};
+
+} // namespace CARBON
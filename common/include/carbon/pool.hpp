@@ -29,7 +29,7 @@ namespace CARBON {
 
 class MemoryRegion {
 public:
-    MemoryRegion(uint32_t startAddress, uint32_t size) : size_(size) {
+    MemoryRegion(uintptr_t startAddress, uint32_t size) : size_(size) {
         data_ = new (reinterpret_cast<void *>(startAddress)) uint8_t[size_];
     }
 
@@ -57,7 +57,7 @@ public:
 
     PREVENT_COPY_AND_MOVE(MemoryAllocatorRaw)
 
-    void init(uint32_t startAddress, uint32_t size) {
+    void init(uintptr_t startAddress, uint32_t size) {
         sizeTotalBytes_ = size;
         startAddress_ = reinterpret_cast<uint8_t *>(startAddress);
         alignedBlockSize_ = alignBlockSize(blockSize, alignment);
@@ -68,11 +68,12 @@ public:
     }
 
     bool inline interateBlock(uint8_t **block) {
-        if (alignedAddress_ >= startAddress_ + sizeTotalBytes_) {
+        if (alignedAddress_ + alignedBlockSize_ >
+            startAddress_ + sizeTotalBytes_) {
             *block = nullptr;
             return false;
         }
-        *block = alignAddress(alignedAddress_, alignment);
+        *block = alignedAddress_;
         alignedAddress_ = *block + alignedBlockSize_;
         return true;
     }
@@ -102,12 +103,12 @@ public:
 
     uint32_t getAlignedBlockSize() const { return alignedBlockSize_; }
 
-    uint32_t getStartAddress() const {
-        return reinterpret_cast<uint32_t>(startAddress_);
+    uintptr_t getStartAddress() const {
+        return reinterpret_cast<uintptr_t>(startAddress_);
     }
 
-    uint32_t getAlignedStartAddress() const {
-        return reinterpret_cast<uint32_t>(firstAlignedAddress_);
+    uintptr_t getAlignedStartAddress() const {
+        return reinterpret_cast<uintptr_t>(firstAlignedAddress_);
     }
 
     uint32_t getNumberOfAlignedElements() const { return nAlignedElements_; }
@@ -141,8 +142,7 @@ private:
         uint8_t *endAddr = (address + bufferSize) > startAddr
                                ? (address + bufferSize)
                                : startAddr;
-        uint32_t actualSize = reinterpret_cast<uint32_t>(endAddr) -
-                              reinterpret_cast<uint32_t>(startAddr);
+        uint32_t actualSize = static_cast<uint32_t>(endAddr - startAddr);
 #ifdef TEST_FIFO
         RAW_DIAG(
             "startAddr %lu, objectSizeAligned %lu, endAddr %lu, actualSize %lu",
@@ -160,131 +160,11 @@ private:
     static constexpr uint8_t *alignAddress(const uint8_t *address,
                                            uint32_t memAlignment) {
         return (reinterpret_cast<uint8_t *>(
-            reinterpret_cast<uint32_t>(address + (memAlignment - 1)) &
-            (~(memAlignment - 1))));
+            reinterpret_cast<uintptr_t>(address + (memAlignment - 1)) &
+            ~static_cast<uintptr_t>(memAlignment - 1)));
     }
 };
 
-class StackBase {
-public:
-    ~StackBase() = default;
-
-    PREVENT_COPY_AND_MOVE(StackBase);
-
-    bool isEmpty() { return (this->top_ == 0); }
-
-    bool isFull() { return (this->top_ == size_); }
-
-protected:
-    StackBase(uint32_t size) : size_(size), top_(0) {}
-
-    void overFlow() {}
-    void underFlow() {}
-
-    uint32_t size_;
-    uint32_t top_;
-};
-
-template <typename ObjectType, uint32_t NElements>
-class Stack : public StackBase {
-public:
-    Stack() : StackBase(NElements) {}
-
-    ~Stack() = default;
-
-    PREVENT_COPY_AND_MOVE(Stack);
-
-    inline bool push(const ObjectType *object) {
-        if (!isFull()) {
-            data[this->top_] = object;
-            this->top_++;
-            return true;
-        } else {
-            overFlow();
-            return false;
-        }
-    }
-
-    inline bool pop(ObjectType **object) {
-        if (!isFull()) {
-            *object = data[this->top_];
-            this->top_--;
-            return true;
-        } else {
-            overFlow();
-            return false;
-        }
-    }
-
-private:
-    ObjectType *data[NElements + 1];
-};
-
-template <typename MemoryAllocatorRaw, typename LockType, uint32_t NElements>
-class MemoryPoolRaw {
-public:
-    MemoryPoolRaw(MemoryAllocatorRaw &memoryAllocator)
-        : memoryAllocator_(memoryAllocator) {
-        memoryAllocator_.init();
-        if (memoryAllocator_.getNumberOfAlignedElements() < NElements + 1) {
-            RAW_DIAG("memomy buffer too small");
-        }
-    }
-
-    ~MemoryPoolRaw() { memoryAllocator_.reset(); }
-
-    PREVENT_COPY_AND_MOVE(MemoryPoolRaw)
-
-    bool init() {
-        LockGuard<LockType> lockGuard(lock_);
-        if (isInitislized_)
-            RAW_DIAG("already initialized");
-        return true;
-        uint8_t *block{nullptr};
-        while (memoryAllocator_.interateBlock(&block)) {
-            if (!block)
-                RAW_DIAG("allocate null pointer");
-            return false;
-            pool_.push(block);
-            size_++;
-        }
-        isInitislized_ = true;
-        return true;
-    }
-
-    inline bool allocate(uint8_t **block) {
-        LockGuard<LockType> lockGuard(lock_);
-        bool res = pool_.pop(block);
-        if (!res) {
-            RAW_DIAG("bad allocation");
-            return false;
-        }
-        return true;
-    }
-    /*TODO avoid freeing twice the same block*/
-    inline bool free(uint8_t *block) {
-        LockGuard<LockType> lockGuard(lock_);
-        bool res = memoryAllocator_.blockBelongs(block);
-        if (!res) {
-            RAW_DIAG("block does not belong to pool");
-            return false;
-        }
-        res = pool_.push(block);
-        if (!res) {
-            RAW_DIAG("error while freeing block");
-            return false;
-        }
-        return true;
-    }
-
-protected:
-    LockType lock_;
-    volatile bool isInitislized_{false};
-    uint32_t size_{0};
-    MemoryAllocatorRaw &memoryAllocator_;
-    Stack<uint8_t, NElements> pool_;
-};
-
 template <class ObjectType, uint32_t aligment> class Buffer {
 public:
     Buffer() {}
@@ -293,7 +173,7 @@ public:
 
     PREVENT_COPY_AND_MOVE(Buffer)
 
-    void init(uint32_t startAddress, uint32_t size) {
+    void init(uintptr_t startAddress, uint32_t size) {
         memoryAllocatorRaw_.init(startAddress, size);
     }
 
@@ -327,12 +207,11 @@ public:
             return false;
         }
 
-        if ((reinterpret_cast<uint32_t>(data) + (sizeof(ObjectT) * length)) >
+        if ((reinterpret_cast<uintptr_t>(data) + (sizeof(ObjectT) * length)) >
             (memoryAllocatorRaw_.getStartAddress() +
              memoryAllocatorRaw_.getTotalSize())) {
-            RAW_DIAG("not enough space to in the buffer, address %lu, size %lu",
-                     reinterpret_cast<uint32_t>(data),
-                     sizeof(ObjectT) * length);
+            RAW_DIAG("not enough space to in the buffer, address %p, size %lu",
+                     static_cast<void *>(data), sizeof(ObjectT) * length);
             return false;
         }
 
@@ -347,7 +226,7 @@ public:
                                    (((sizeof(ObjectT) + aligment - 1)) &
                                     (~(aligment - 1))),
                                bool> = true>
-    inline bool remove(ObjectT object, const uint32_t index) {
+    inline bool remove(ObjectT *object, const uint32_t index) {
         uint8_t *data;
         if (!(memoryAllocatorRaw_.getBlock(&data, index))) {
             RAW_DIAG("no block to remove at index %lu", index);
@@ -372,12 +251,12 @@ public:
             return false;
         }
 
-        if ((reinterpret_cast<uint32_t>(data) + (sizeof(ObjectT) * length)) >
+        if ((reinterpret_cast<uintptr_t>(data) + (sizeof(ObjectT) * length)) >
             (memoryAllocatorRaw_.getStartAddress() +
              memoryAllocatorRaw_.getTotalSize())) {
             RAW_DIAG(
-                "not enough space to read in the buffer, address %lu, size %lu",
-                reinterpret_cast<uint32_t>(data), sizeof(ObjectT) * length);
+                "not enough space to read in the buffer, address %p, size %lu",
+                static_cast<void *>(data), sizeof(ObjectT) * length);
             return false;
         }
 
@@ -392,6 +271,12 @@ public:
         return memoryAllocatorRaw_.getNumberOfAlignedElements();
     }
 
+    uintptr_t getBlockAddress(const uint32_t index) {
+        uint8_t *data;
+        memoryAllocatorRaw_.getBlock(&data, index);
+        return reinterpret_cast<uintptr_t>(data);
+    }
+
 private:
     MemoryAllocatorRaw<sizeof(ObjectType), aligment> memoryAllocatorRaw_;
 };
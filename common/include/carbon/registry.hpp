@@ -0,0 +1,62 @@
+/**
+ ******************************************************************************
+ * @file           registry.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Latest value registry shared between the cores
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+#include <carbon/irq.hpp>
+#include <carbon/registry_table.hpp>
+#include <carbon/timebase.hpp>
+
+namespace CARBON {
+
+RegistryShared &registryShared();
+
+/*CM7: clears the entries, to be called before the sync flag*/
+void registryInit();
+
+/*
+ * Writers never wait for the readers. The writers of the same core are
+ * serialized masking the interrupts for the copy.
+ */
+template <RegistryId Id> void registryPublish(const RegistryType<Id> &value) {
+    auto timestampUs = timebaseNowUs();
+    IRQ::lockRecursive();
+    registryWrite<Id>(registryShared(), value, timestampUs);
+    IRQ::unLockRecursive();
+}
+
+template <RegistryId Id>
+bool registryGet(RegistryType<Id> &value, uint64_t *timestampUs = nullptr) {
+    return registryRead<Id>(registryShared(), value, timestampUs);
+}
+
+} // namespace CARBON
+
+extern "C" {
+#else
+#include <stdint.h>
+#endif
+
+/*network order addresses*/
+void carbon_registry_net_link(uint32_t up, uint32_t ip, uint32_t netmask,
+                              uint32_t gateway);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,200 @@
+/**
+ ******************************************************************************
+ * @file           registry_table.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Latest value registry, entry types and shared layout
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/seqlock.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace CARBON {
+
+/*network order addresses*/
+struct RegistryNetLink {
+    uint32_t up;
+    uint32_t ip;
+    uint32_t netmask;
+    uint32_t gateway;
+};
+
+struct RegistrySdCard {
+    uint32_t present;
+    uint32_t readBlocks;
+    uint32_t writtenBlocks;
+    uint32_t errors;
+};
+
+/*last register read*/
+struct RegistryModbus {
+    uint32_t slaveIp;
+    uint8_t slaveId;
+    uint8_t functionCode;
+    uint16_t address;
+    uint16_t value;
+    uint16_t error; /*ErrorType, 0 if the value is valid*/
+    uint32_t reads;
+    uint32_t errors;
+};
+
+struct RegistryCM4 {
+    uint32_t uptimeMs;
+    uint32_t offloadJobs;
+    uint32_t freeHeap;
+};
+
+enum class RegistryId : uint16_t { NetLink, SdCard, Modbus, CM4, Count };
+
+/*every entry has a single writing core*/
+enum class RegistryWriter : uint8_t { CM7, CM4 };
+
+template <RegistryId Id> struct RegistryTraits;
+
+template <> struct RegistryTraits<RegistryId::NetLink> {
+    using Type = RegistryNetLink;
+    static constexpr const char *name = "net_link";
+    static constexpr auto writer = RegistryWriter::CM7;
+};
+
+template <> struct RegistryTraits<RegistryId::SdCard> {
+    using Type = RegistrySdCard;
+    static constexpr const char *name = "sd_card";
+    static constexpr auto writer = RegistryWriter::CM7;
+};
+
+template <> struct RegistryTraits<RegistryId::Modbus> {
+    using Type = RegistryModbus;
+    static constexpr const char *name = "modbus";
+    static constexpr auto writer = RegistryWriter::CM7;
+};
+
+template <> struct RegistryTraits<RegistryId::CM4> {
+    using Type = RegistryCM4;
+    static constexpr const char *name = "cm4";
+    static constexpr auto writer = RegistryWriter::CM4;
+};
+
+template <RegistryId Id> using RegistryType = typename RegistryTraits<Id>::Type;
+
+/*timestamp in the CM7 time base, 0 if never written*/
+template <typename T> struct RegistryRecord {
+    uint64_t timestampUs;
+    T value;
+};
+
+template <RegistryId Id>
+using RegistryEntry = SeqLock<RegistryRecord<RegistryType<Id>>>;
+
+/*fixed layout, POD so that it can be placed in a NOLOAD section*/
+struct RegistryShared {
+    RegistryEntry<RegistryId::NetLink> netLink;
+    RegistryEntry<RegistryId::SdCard> sdCard;
+    RegistryEntry<RegistryId::Modbus> modbus;
+    RegistryEntry<RegistryId::CM4> cm4;
+
+    template <RegistryId Id> RegistryEntry<Id> &entry() {
+        if constexpr (Id == RegistryId::NetLink)
+            return netLink;
+        else if constexpr (Id == RegistryId::SdCard)
+            return sdCard;
+        else if constexpr (Id == RegistryId::Modbus)
+            return modbus;
+        else
+            return cm4;
+    }
+
+    void init() {
+        netLink.init();
+        sdCard.init();
+        modbus.init();
+        cm4.init();
+    }
+};
+
+static constexpr uint32_t REGISTRY_READ_RETRIES = 16;
+
+template <RegistryId Id>
+void registryWrite(RegistryShared &registry, const RegistryType<Id> &value,
+                   uint64_t timestampUs) {
+    registry.entry<Id>().write({timestampUs, value});
+}
+
+/*false if never written or if the writer kept the entry busy*/
+template <RegistryId Id>
+bool registryRead(RegistryShared &registry, RegistryType<Id> &value,
+                  uint64_t *timestampUs = nullptr) {
+    RegistryRecord<RegistryType<Id>> record;
+    if (!registry.entry<Id>().read(record, REGISTRY_READ_RETRIES) ||
+        record.timestampUs == 0)
+        return false;
+    value = record.value;
+    if (timestampUs != nullptr)
+        *timestampUs = record.timestampUs;
+    return true;
+}
+
+struct RegistryDescriptor {
+    RegistryId id;
+    const char *name;
+    uint16_t size;
+    RegistryWriter writer;
+};
+
+template <size_t... I>
+constexpr auto registryMakeTable(std::index_sequence<I...>) {
+    return std::array<RegistryDescriptor, sizeof...(I)>{RegistryDescriptor{
+        static_cast<RegistryId>(I),
+        RegistryTraits<static_cast<RegistryId>(I)>::name,
+        sizeof(RegistryType<static_cast<RegistryId>(I)>),
+        RegistryTraits<static_cast<RegistryId>(I)>::writer}...};
+}
+
+static constexpr auto registryTable = registryMakeTable(
+    std::make_index_sequence<static_cast<size_t>(RegistryId::Count)>{});
+
+/*untyped read for the consumers that walk the table*/
+template <size_t... I>
+bool registryReadRaw(RegistryShared &registry, RegistryId id, void *value,
+                     uint32_t size, uint64_t *timestampUs,
+                     std::index_sequence<I...>) {
+    bool found = false;
+    auto readOne = [&]<size_t N>() {
+        constexpr auto Id = static_cast<RegistryId>(N);
+        if (id != Id || size != sizeof(RegistryType<Id>))
+            return;
+        RegistryType<Id> typed;
+        found = registryRead<Id>(registry, typed, timestampUs);
+        if (found)
+            std::memcpy(value, &typed, sizeof(typed));
+    };
+    (readOne.template operator()<I>(), ...);
+    return found;
+}
+
+inline bool registryReadRaw(RegistryShared &registry, RegistryId id,
+                            void *value, uint32_t size,
+                            uint64_t *timestampUs = nullptr) {
+    return registryReadRaw(
+        registry, id, value, size, timestampUs,
+        std::make_index_sequence<static_cast<size_t>(RegistryId::Count)>{});
+}
+
+} // namespace CARBON
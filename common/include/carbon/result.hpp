@@ -33,8 +33,8 @@ public:
     Result(const Error &errorInfo)
         : success_(false), value_(), errorInfo_(errorInfo) {}
 
-    // Check if the result is an error
-    bool hasValue() const { return !success_; }
+    // Check if the result holds a value
+    bool hasValue() const { return success_; }
 
     // Retrieve the value (only call if not an error)
     const T &value() const { return value_; }
@@ -37,14 +37,21 @@ public:
     PREVENT_COPY_AND_MOVE(Semaphore)
 
     virtual void init() {
+        if (isInit_)
+            return;
+        /*the kernel cannot be called under the IRQ lock, the loser deletes*/
+        osSemaphoreDef_t sem_def{};
+        auto semaphore = osSemaphoreCreate(&sem_def, count_);
+        ASSERT(semaphore != NULL);
         CARBON::IRQ::lockRecursive();
-        if (!isInit_) {
-            osSemaphoreDef_t sem_def{0, NULL};
-            semaphore_ = osSemaphoreCreate(&sem_def, count_);
-            ASSERT(semaphore_ != NULL);
+        bool created = !isInit_;
+        if (created) {
+            semaphore_ = semaphore;
             isInit_ = true;
         }
         CARBON::IRQ::unLockRecursive();
+        if (!created)
+            osSemaphoreDelete(semaphore);
     };
 
     bool acquire(uint32_t timeout = osWaitForever) {
@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * @file           seqlock.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Single writer sequence lock, usable across the cores
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace CARBON {
+
+/*
+ * The object is a POD on purpose: it can be placed in a NOLOAD shared section
+ * and initialized by one core only, calling init(). One writer, any number
+ * of readers, readers never block the writer.
+ */
+template <typename ValueType> class SeqLock {
+    static_assert(std::is_trivially_copyable_v<ValueType>,
+                  "seqlock value must be trivially copyable");
+
+public:
+    void init() {
+        std::atomic_ref<uint32_t>(sequence_).store(0,
+                                                   std::memory_order_relaxed);
+        std::memset(&value_, 0, sizeof(ValueType));
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    void write(const ValueType &value) {
+        std::atomic_ref<uint32_t> seq(sequence_);
+        auto start = seq.load(std::memory_order_relaxed);
+        seq.store(start + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&value_, &value, sizeof(ValueType));
+        seq.store(start + 2, std::memory_order_release);
+    }
+
+    /*returns false if a write was ongoing, value is then not valid*/
+    bool tryRead(ValueType &value) const {
+        std::atomic_ref<uint32_t> seq(sequence_);
+        auto start = seq.load(std::memory_order_acquire);
+        if (start & 0x1)
+            return false;
+        std::memcpy(&value, &value_, sizeof(ValueType));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return start == seq.load(std::memory_order_relaxed);
+    }
+
+    bool read(ValueType &value, uint32_t retries) const {
+        do {
+            if (tryRead(value))
+                return true;
+        } while (retries-- > 0);
+        return false;
+    }
+
+    /*even number, incremented by 2 on every write*/
+    uint32_t sequence() const {
+        return std::atomic_ref<uint32_t>(sequence_).load(
+            std::memory_order_acquire);
+    }
+
+private:
+    mutable uint32_t sequence_ __attribute__((aligned(4)));
+    ValueType value_;
+};
+
+} // namespace CARBON
@@ -20,6 +20,10 @@
 
 #include <carbon/fifo.hpp>
 #include <carbon/hsem.hpp>
+#include <carbon/mailbox.hpp>
+#include <carbon/registry_table.hpp>
+#include <carbon/seqlock.hpp>
+#include <carbon/timebase.hpp>
 #include <carbon/trace_format.hpp>
 
 #define FIFO_DECLARATION(NAME, TYPE, ALIGMENT, NELEMENTS, HSEM_INDEX)          \
@@ -30,13 +34,13 @@
     static constexpr auto NAME##_BUFFER_SIZE = NAME##_FIFO_NELEMENTS + 1;      \
     static constexpr auto NAME##_BUFFER_SIZE_BYTES =                           \
         (NAME##_FIFO_NELEMENTS + 1) * NAME##_ELEMENT_SIZE;                     \
-    using NAME##_HSEM = HSEMSpinLock<HSEM_ID::HSEM_INDEX>;                     \
+    using NAME##_HSEM = HSEMMutex<HSEM_ID::HSEM_INDEX>;                        \
     using NAME##FifoClass =                                                    \
         Fifo<NAME##_ELEMENT_TYPE, NAME##_ELEMENT_ALIGNMENT, NAME##_HSEM,       \
              NAME##_FIFO_NELEMENTS>;                                           \
     extern NAME##_ELEMENT_TYPE NAME##Buffer[NAME##_BUFFER_SIZE]                \
         __attribute__((aligned(4), section("." #NAME "_buffer")));             \
-    extern uint32_t NAME##BufferPtr;                                           \
+    extern uintptr_t NAME##BufferPtr;                                          \
     extern NAME##FifoClass NAME##Fifo                                          \
         __attribute__((aligned(4), section("." #NAME "_fifo")));
 
@@ -45,7 +49,7 @@
 
 #define FIFO_DEFINITION(NAME)                                                  \
     NAME##_ELEMENT_TYPE NAME##Buffer[NAME##_BUFFER_SIZE];                      \
-    uint32_t NAME##BufferPtr = reinterpret_cast<uint32_t>(&NAME##Buffer[0]);   \
+    uintptr_t NAME##BufferPtr = reinterpret_cast<uintptr_t>(&NAME##Buffer[0]); \
     NAME##FifoClass NAME##Fifo;
 
 #define FIFO_INIT(NAME)                                                        \
@@ -74,4 +78,19 @@ FIFO_DECLARATION_8BIT_ALIG(trace, uint8_t, 2048, Trace)
 volatile extern uint32_t syncFlag
     __attribute__((aligned(4), section(".sync_flag")));
 
+/*Registry*/
+
+extern RegistryShared registrySharedData
+    __attribute__((aligned(8), section(".registry")));
+
+/*Time Base*/
+
+extern SeqLock<TimebaseState> timebaseShared
+    __attribute__((aligned(8), section(".timebase")));
+
+/*Mailbox*/
+
+extern MailboxShared mailboxShared
+    __attribute__((aligned(CACHE_ALIGNMENT), section(".mailbox")));
+
 } // namespace CARBON
@@ -38,6 +38,12 @@ uint64_t systimeUs();
 
 void delayUs(uint32_t us);
 
+/*latency probe interrupt every period, 0 stops it*/
+void systimeProbe(uint32_t periodUs);
+
+/*callback from the timer interrupt every period, 0 stops it*/
+void systimeSampler(uint32_t periodUs, void (*callback)(void));
+
 #ifdef __cplusplus
 }
 #endif
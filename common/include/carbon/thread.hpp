@@ -41,14 +41,16 @@ public:
 
     // Function to start the thread
     void start() {
-        osThreadDef_t thread_def;
+        osThreadDef_t thread_def{}; /*dynamic allocation without buffers*/
         thread_def.pthread = &Thread::threadEntry;
         thread_def.tpriority = priority_;
         thread_def.instances = 0; // Single instance of the thread
         thread_def.stacksize = stackSize_;
         thread_def.name = const_cast<char *>(name_); // Cast away constness
-        thread_def.buffer = NULL;
-        thread_def.controlblock = NULL;
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        thread_def.buffer = stackBuffer_;
+        thread_def.controlblock = controlBlock_;
+#endif
         id_ = osThreadCreate(&thread_def, this);
         ASSERT(id_ != nullptr);
     }
@@ -56,10 +58,20 @@ public:
     // Function to get the thread id
     osThreadId getId() const { return id_; }
 
+    const char *getName() const { return name_; }
+
 protected:
     // Pure virtual method to be implemented by derived classes
     virtual void run() = 0;
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    // Static stack and control block, used by the next start()
+    void setStaticMemory(uint32_t *stack, osStaticThreadDef_t *controlBlock) {
+        stackBuffer_ = stack;
+        controlBlock_ = controlBlock;
+    }
+#endif
+
 private:
     static void threadEntry(void const *argument) {
         Thread *thread = static_cast<Thread *>(const_cast<void *>(argument));
@@ -70,4 +82,103 @@ private:
     osPriority priority_; // Thread priority
     uint32_t stackSize_;  // Stack size for the thread
     osThreadId id_;       // Thread ID
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    uint32_t *stackBuffer_{nullptr};
+    osStaticThreadDef_t *controlBlock_{nullptr};
+#endif
 };
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+
+enum class ThreadRegion {
+    Sram, /*AXI SRAM, the default .bss*/
+    Dtcm, /*no DMA buffers on the stack*/
+};
+
+struct ThreadStackUsage {
+    const char *name;
+    uint32_t sizeBytes;
+    uint32_t usedBytes; /*high water mark*/
+};
+
+/*
+ * Links the static threads for the stack report, they are never destroyed.
+ */
+class StaticThreadBase : public Thread {
+public:
+    StaticThreadBase(const char *name, osPriority priority, uint32_t stackWords)
+        : Thread(name, priority, stackWords), next_(first_) {
+        first_ = this;
+    }
+
+    virtual ThreadStackUsage stackUsage() const = 0;
+
+    template <typename Function> static void forEach(Function &&function) {
+        for (auto thread = first_; thread != nullptr; thread = thread->next_)
+            function(*thread);
+    }
+
+    static void report() {
+        forEach([](const StaticThreadBase &thread) {
+            auto usage = thread.stackUsage();
+            DIAG(SYSTEM_DIAG "stack %s: %lu of %lu bytes", usage.name,
+                 usage.usedBytes, usage.sizeBytes);
+        });
+    }
+
+private:
+    StaticThreadBase *next_;
+    static inline StaticThreadBase *first_{nullptr};
+};
+
+/*
+ * Thread with the stack and the control block reserved at compile time, no
+ * heap needed. They are members: define the object with static storage, in
+ * .bss for Sram or with CARBON_FAST_BSS for Dtcm, start() checks it. The
+ * stack is painted so that its high water mark can be measured.
+ */
+template <uint32_t StackWords, ThreadRegion Region = ThreadRegion::Sram>
+class StaticThread : public StaticThreadBase {
+public:
+    static constexpr uint32_t STACK_PAINT = 0xA5A5A5A5;
+
+    StaticThread(const char *name, osPriority priority = osPriorityNormal)
+        : StaticThreadBase(name, priority, StackWords) {}
+
+    void start() {
+        ASSERT(inRegion());
+        for (auto &word : stack_)
+            word = STACK_PAINT;
+        setStaticMemory(stack_, &tcb_);
+        Thread::start();
+    }
+
+    /*the stack grows down, the painted words at the bottom were never used*/
+    ThreadStackUsage stackUsage() const override {
+        uint32_t unused = 0;
+        while (unused < StackWords && stack_[unused] == STACK_PAINT)
+            unused++;
+        return {getName(),
+                static_cast<uint32_t>(StackWords * sizeof(uint32_t)),
+                static_cast<uint32_t>((StackWords - unused) *
+                                      sizeof(uint32_t))};
+    }
+
+private:
+    bool inRegion() const {
+#ifdef CARBON_HOST
+        /*one address space, the regions are sections of the process*/
+        return true;
+#endif
+        auto address = reinterpret_cast<uintptr_t>(stack_);
+        if constexpr (Region == ThreadRegion::Dtcm)
+            return address >= 0x20000000 && address < 0x20020000;
+        else
+            return address >= 0x24000000 && address < 0x24080000;
+    }
+
+    alignas(8) uint32_t stack_[StackWords];
+    osStaticThreadDef_t tcb_;
+};
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ ******************************************************************************
+ * @file           timebase.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Cross core time base, CM7 time is the reference
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+
+#include <cstdint>
+
+namespace CARBON {
+
+struct TimebaseStats {
+    uint32_t samples;
+    uint32_t rejected;       /*sampling window too large*/
+    int32_t driftPpb;        /*CM4 clock rate error, positive if faster*/
+    int32_t lastResidualUs;  /*measured offset - predicted offset*/
+    uint32_t maxResidualUs;  /*max absolute residual*/
+    uint32_t minWindowUs;
+    uint32_t maxWindowUs;
+};
+
+/*published by the CM7 in shared memory*/
+struct TimebaseState {
+    uint64_t epochUs;    /*CM7 time at the time base initialization*/
+    uint64_t refLocalUs; /*CM4 time of the reference sample*/
+    int64_t refOffsetUs; /*CM7 time - CM4 time at the reference sample*/
+    int32_t driftPpb;
+    uint32_t valid;
+    TimebaseStats stats;
+};
+
+/*offset correction of a CM4 time stamp, drift extrapolated from reference*/
+inline int64_t timebaseOffsetAt(const TimebaseState &state, uint64_t localUs) {
+    auto elapsed = static_cast<int64_t>(localUs - state.refLocalUs);
+    return state.refOffsetUs - (elapsed * state.driftPpb) / 1000000000LL;
+}
+
+/*
+ * Offset/drift estimator, pure arithmetic so that it can be simulated on the
+ * host. Each sample is a CM7 time (mid of the sampling window) and the CM4
+ * time read inside the window. The offset follows the last accepted sample,
+ * the drift is a low pass filtered slope over at least DriftBaselineUs.
+ */
+class TimebaseEstimator {
+public:
+    static constexpr uint32_t MaxWindowUs = 4;
+    static constexpr uint64_t DriftBaselineUs = 16000000;
+    static constexpr uint32_t DriftFilterShift = 2;
+
+    TimebaseEstimator() { reset(0); }
+
+    void reset(uint64_t epochUs);
+
+    /*returns false if the sample has been rejected*/
+    bool update(uint64_t masterUs, uint64_t localUs, uint32_t windowUs);
+
+    uint64_t toMaster(uint64_t localUs) const {
+        return localUs +
+               static_cast<uint64_t>(timebaseOffsetAt(state_, localUs));
+    }
+
+    const TimebaseState &state() const { return state_; }
+
+private:
+    TimebaseState state_;
+    uint64_t anchorLocalUs_;
+    int64_t anchorOffsetUs_;
+    bool driftValid_;
+};
+
+/*CM7: initializes the shared time base, to be called before the sync flag*/
+void timebaseInit();
+
+/*CM7: samples the CM4 timer and publishes the new estimation*/
+void timebasePublish();
+
+/*time in the CM7 time base, lock free, can be called from both the cores*/
+uint64_t timebaseNowUs();
+
+/*converts a local time stamp into the CM7 time base*/
+uint64_t timebaseToMasterUs(uint64_t localUs);
+
+bool timebaseStats(TimebaseStats &stats);
+
+} // namespace CARBON
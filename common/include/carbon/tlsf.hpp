@@ -0,0 +1,127 @@
+/**
+ ******************************************************************************
+ * @file           tlsf.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Two level segregated fit allocator, constant time
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/common.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CARBON {
+
+struct TlsfStats {
+    size_t totalBytes; /*managed, block headers included*/
+    size_t usedBytes;
+    size_t highWaterBytes;
+    size_t freeBytes;
+    size_t largestFreeBytes;
+    uint32_t freeBlocks;
+    uint32_t usedBlocks;
+    uint32_t allocations;
+    uint32_t failures;
+    uint32_t fragmentation; /*percent of the free memory not in the largest block*/
+};
+
+/*
+ * Single pool, not thread safe. Every allocation starts and ends on a
+ * granularity boundary and owns its granules: with the cache line as
+ * granularity the buffers can be cleaned and invalidated without touching
+ * the neighbours.
+ */
+class Tlsf {
+public:
+    Tlsf() = default;
+
+    PREVENT_COPY_AND_MOVE(Tlsf)
+
+    /*granularity is a power of 2, returns false if the pool is too small*/
+    bool init(void *memory, size_t size, size_t granularity);
+
+    void *allocate(size_t size);
+
+    void free(void *pointer);
+
+    bool contains(const void *pointer) const {
+        auto address = reinterpret_cast<uintptr_t>(pointer);
+        return address >= begin_ && address < end_;
+    }
+
+    size_t usableSize(const void *pointer) const;
+
+    /*walks the whole pool*/
+    TlsfStats stats() const;
+
+    /*walks the whole pool, checks links, flags and free lists*/
+    bool check() const;
+
+private:
+    static constexpr uint32_t SL_LOG2 = 4;
+    static constexpr uint32_t SL_COUNT = 1 << SL_LOG2;
+    static constexpr uint32_t FL_COUNT = 26;
+
+    struct Block {
+        size_t sizeAndFlags; /*bit 0 free, bit 1 previous free*/
+        Block *prevPhys;
+        /*valid only if free*/
+        Block *nextFree;
+        Block *prevFree;
+    };
+
+    static constexpr size_t HEADER = offsetof(Block, nextFree);
+    static constexpr size_t FREE_BIT = 1;
+    static constexpr size_t PREV_FREE_BIT = 2;
+
+    static size_t sizeOf(const Block *block) {
+        return block->sizeAndFlags & ~(FREE_BIT | PREV_FREE_BIT);
+    }
+    static bool isFree(const Block *block) {
+        return block->sizeAndFlags & FREE_BIT;
+    }
+    static bool isPrevFree(const Block *block) {
+        return block->sizeAndFlags & PREV_FREE_BIT;
+    }
+    Block *nextPhys(const Block *block) const;
+    Block *blockOf(const void *pointer) const;
+    void *payloadOf(Block *block) const;
+
+    void mapping(size_t size, uint32_t &fl, uint32_t &sl) const;
+    void insert(Block *block);
+    void remove(Block *block);
+    Block *findFree(size_t size);
+    void setSize(Block *block, size_t size);
+    void markFree(Block *block, bool free);
+
+    uintptr_t begin_{0};
+    uintptr_t end_{0};
+    size_t granularity_{0};
+    uint32_t granularityLog2_{0};
+    size_t minBlock_{0};
+    Block *sentinel_{nullptr};
+
+    uint32_t flBitmap_{0};
+    uint32_t slBitmap_[FL_COUNT]{};
+    Block *lists_[FL_COUNT][SL_COUNT]{};
+
+    size_t used_{0};
+    size_t highWater_{0};
+    uint32_t allocations_{0};
+    uint32_t failures_{0};
+};
+
+} // namespace CARBON
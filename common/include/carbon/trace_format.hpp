@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <carbon/latency_histogram.hpp>
+
 #include <cstdint>
 #include <limits>
 #include <variant>
@@ -89,6 +91,8 @@ enum class TraceEventID : TraceEventHeader::IdType {
     TaskSwitchedIn = 3,
     TaskSwitchedOut = 4,
     PerfCnt = 20,
+    Latency = 21,
+    User = 22,
 };
 
 struct TraceTasksEvent {
@@ -183,9 +187,54 @@ static_assert(sizeof(TracePerfCntEvent) == 28);
 static_assert(sizeof(TracePerfCntEvent) <=
               TraceEventHeader::MAX_EVENT_SIZE_BYTES);
 
+/*bucket bounds by latencyBucketLow() and latencyBucketHigh()*/
+struct TraceLatencyEvent {
+    static constexpr TraceEventID ID = TraceEventID::Latency;
+
+    TraceEventHeader header{
+        static_cast<TraceEventHeader::SizeType>(sizeof(TraceLatencyEvent) << 3),
+        static_cast<TraceEventHeader::IdType>(ID),
+        static_cast<TraceEventHeader::TimestampType>(0)};
+
+    uint8_t source{0};
+    uint8_t kind{0};
+    uint16_t buckets{LATENCY_BUCKETS};
+    uint32_t cyclesPerUs{0};
+    uint32_t count{0};
+    uint32_t p50Cycles{0};
+    uint32_t p99Cycles{0};
+    uint32_t maxCycles{0};
+    uint32_t counts[LATENCY_BUCKETS]{};
+};
+
+static_assert(sizeof(TraceLatencyEvent) == 36 + 4 * LATENCY_BUCKETS);
+static_assert(sizeof(TraceLatencyEvent) <=
+              TraceEventHeader::MAX_EVENT_SIZE_BYTES);
+
+static constexpr uint16_t TRACE_USER_DATA_SIZE = 64;
+
+/*from the scripts, only length data bytes are sent, eventSizeBits tells*/
+struct TraceUserEvent {
+    static constexpr TraceEventID ID = TraceEventID::User;
+
+    TraceEventHeader header{
+        static_cast<TraceEventHeader::SizeType>(sizeof(TraceUserEvent) << 3),
+        static_cast<TraceEventHeader::IdType>(ID),
+        static_cast<TraceEventHeader::TimestampType>(0)};
+
+    uint16_t channel{0};
+    uint16_t length{0};
+    uint8_t data[TRACE_USER_DATA_SIZE];
+};
+
+static_assert(sizeof(TraceUserEvent) == 16 + TRACE_USER_DATA_SIZE);
+static_assert(sizeof(TraceUserEvent) <=
+              TraceEventHeader::MAX_EVENT_SIZE_BYTES);
+
 #pragma pack(pop)
 
-using TraceEvent = std::variant<TraceTasksEvent, TraceMallocEvent,
-                                TraceFreeEvent, TraceTaskSwitchedInEvent,
-                                TraceTaskSwitchedOutEvent, TracePerfCntEvent>;
+using TraceEvent =
+    std::variant<TraceTasksEvent, TraceMallocEvent, TraceFreeEvent,
+                 TraceTaskSwitchedInEvent, TraceTaskSwitchedOutEvent,
+                 TracePerfCntEvent, TraceLatencyEvent, TraceUserEvent>;
 } // namespace CARBON
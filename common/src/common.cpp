@@ -23,10 +23,10 @@ extern "C" {
 void carbon_assert(unsigned long line, const char *filename,
                    const char *message) {
 
-    CARBON::IRQ::lockRecursive();
+    CARBON::IRQ::lock();
     RAW_DIAG("Assertion \"%s\" failed at line %lu in %s\n", message, line,
              filename);
-    __asm volatile("BKPT #0\n");
+    __BKPT(0);
     while (true) {
     }
 }
@@ -0,0 +1,190 @@
+/**
+ ******************************************************************************
+ * @file           completion.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          interrupt to task completion on the task notifications
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/completion.hpp>
+#include <carbon/diag.hpp>
+#include <carbon/thread.hpp>
+
+#include <semphr.h>
+
+using namespace CARBON;
+
+struct CarbonCompletion : public Completion {
+    CarbonCompletion(const char *name, CarbonLatencySource source)
+        : Completion(name, source) {}
+};
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+namespace {
+
+enum class BenchmarkMode : uint32_t { Semaphore, Completion };
+
+constexpr uint32_t BENCHMARK_REPEAT = 64;
+constexpr uint32_t BENCHMARK_TIMEOUT = 100; /*ms*/
+
+Completion benchmarkCompletion("benchmark");
+StaticSemaphore_t benchmarkSemaphoreBuffer;
+SemaphoreHandle_t benchmarkSemaphore;
+volatile BenchmarkMode benchmarkMode;
+volatile uint32_t benchmarkStamp;
+IRQn_Type benchmarkIrq;
+
+/*lower priority than the caller: it runs only while the caller waits*/
+class BenchmarkTrigger : public StaticThread<configMINIMAL_STACK_SIZE * 2> {
+public:
+    BenchmarkTrigger()
+        : StaticThread("latency", osPriorityNormal), start_("latency"),
+          done_("latency done") {}
+
+    void trigger() {
+        if (!started_) {
+            start();
+            started_ = true;
+        }
+        auto priority = uxTaskPriorityGet(nullptr);
+        vTaskPrioritySet(static_cast<TaskHandle_t>(getId()),
+                         priority > tskIDLE_PRIORITY + 1 ? priority - 1
+                                                         : priority);
+        start_.complete();
+    }
+
+    void wait() { done_.wait(); }
+
+protected:
+    void run() override {
+        while (1) {
+            start_.wait();
+            for (uint32_t i = 0; i < BENCHMARK_REPEAT; i++) {
+                osDelay(2);
+                NVIC_SetPendingIRQ(benchmarkIrq);
+            }
+            done_.complete();
+        }
+    }
+
+private:
+    Completion start_;
+    Completion done_;
+    bool started_{false};
+};
+
+BenchmarkTrigger benchmarkTrigger;
+
+CompletionBenchmarkResult benchmarkRun(BenchmarkMode mode) {
+    benchmarkMode = mode;
+    benchmarkTrigger.trigger();
+
+    uint32_t maxCycles = 0;
+    uint32_t totalCycles = 0;
+    uint32_t missed = 0;
+    for (uint32_t i = 0; i < BENCHMARK_REPEAT; i++) {
+        bool woken =
+            mode == BenchmarkMode::Semaphore
+                ? xSemaphoreTake(benchmarkSemaphore,
+                                 BENCHMARK_TIMEOUT / portTICK_PERIOD_MS) ==
+                      pdTRUE
+                : benchmarkCompletion.wait(BENCHMARK_TIMEOUT);
+        auto cycles = DWT->CYCCNT - benchmarkStamp;
+        if (!woken) {
+            missed++;
+            continue;
+        }
+        totalCycles += cycles;
+        if (cycles > maxCycles)
+            maxCycles = cycles;
+    }
+    benchmarkTrigger.wait();
+
+    auto received = BENCHMARK_REPEAT - missed;
+    return {maxCycles, received > 0 ? totalCycles / received : 0, missed};
+}
+
+} // namespace
+#endif
+
+namespace CARBON {
+
+void Completion::report() {
+    forEach([](Completion &completion) {
+        auto stats = completion.stats();
+        auto average = stats.wakeups > 0
+                           ? static_cast<uint32_t>(stats.totalLatency /
+                                                   stats.wakeups)
+                           : 0;
+        DIAG(SYSTEM_DIAG "completion %s: %lu done, %lu timeouts, wake up max "
+                         "%lu avg %lu cycles",
+             completion.name(), stats.completions, stats.timeouts,
+             stats.maxLatency, average);
+    });
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+void completionBenchmark(IRQn_Type irq, CompletionBenchmarkResult &semaphore,
+                         CompletionBenchmarkResult &completion) {
+    ASSERT(!IRQ::isInIRQ());
+    benchmarkSemaphore = xSemaphoreCreateBinaryStatic(&benchmarkSemaphoreBuffer);
+    benchmarkIrq = irq;
+    NVIC_SetPriority(irq, IRQ::CEILING);
+    NVIC_ClearPendingIRQ(irq);
+    NVIC_EnableIRQ(irq);
+
+    semaphore = benchmarkRun(BenchmarkMode::Semaphore);
+    completion = benchmarkRun(BenchmarkMode::Completion);
+
+    NVIC_DisableIRQ(irq);
+    vSemaphoreDelete(benchmarkSemaphore);
+    benchmarkSemaphore = nullptr;
+}
+#endif
+
+} // namespace CARBON
+
+extern "C" {
+
+CarbonCompletion *carbon_completion_create(const char *name,
+                                           CarbonLatencySource source) {
+    auto completion = new CarbonCompletion(name, source);
+    ASSERT(completion != nullptr);
+    return completion;
+}
+
+bool carbon_completion_wait(CarbonCompletion *completion, uint32_t timeout) {
+    return completion->wait(timeout);
+}
+
+void carbon_completion_complete(CarbonCompletion *completion) {
+    completion->complete();
+}
+
+void carbon_completion_reset(CarbonCompletion *completion) {
+    completion->reset();
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+void carbon_completion_benchmark_isr(void) {
+    benchmarkStamp = DWT->CYCCNT;
+    if (benchmarkMode == BenchmarkMode::Semaphore) {
+        BaseType_t woken = pdFALSE;
+        xSemaphoreGiveFromISR(benchmarkSemaphore, &woken);
+        portYIELD_FROM_ISR(woken);
+    } else {
+        benchmarkCompletion.complete();
+    }
+}
+#endif
+}
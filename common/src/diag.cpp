@@ -31,7 +31,7 @@ extern "C" {
 using namespace CARBON;
 
 extern UART_HandleTypeDef huart1;
-static HSEMSpinLock<HSEM_ID::Diag> hsemDiag;
+static HSEMMutex<HSEM_ID::Diag> hsemDiag;
 
 void putchar_(char ch) {
     HAL_UART_Transmit(&huart1, (uint8_t *)&ch, 1, 0xFFFF);
@@ -44,7 +44,7 @@ static void fifo_output(char character, void *arg) {
 }
 
 void carbon_raw_diag_print(const char *format, ...) {
-    LockGuard<HSEMSpinLock<HSEM_ID::Diag>> Lock(hsemDiag);
+    LockGuard<HSEMMutex<HSEM_ID::Diag>> Lock(hsemDiag);
     va_list vl;
     va_start(vl, format);
     vprintf_(format, vl);
@@ -54,12 +54,15 @@ void carbon_raw_diag_print(const char *format, ...) {
 
 void carbon_diag_push(const char *format, ...) {
     va_list vl;
+    va_list copy;
     va_start(vl, format);
-    /*getting stream length*/
-    int len = vsnprintf_(nullptr, 0, format, vl);
-    va_end(vl);
+    /*getting stream length, the list is consumed once per pass*/
+    va_copy(copy, vl);
+    int len = vsnprintf_(nullptr, 0, format, copy);
+    va_end(copy);
     diagFifoClass::ContextPush context(diagFifo, len, hsemDiag);
     if (context.isOverflow()) {
+        va_end(vl);
         RAW_DIAG("???????????");
         return;
     }
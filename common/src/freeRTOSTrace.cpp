@@ -17,6 +17,7 @@
  */
 #ifdef FREERTOS_USE_TRACE
 
+#include <carbon/common.hpp>
 #include <carbon/diag.hpp>
 #include <carbon/hsem.hpp>
 #include <carbon/shared_memory.hpp>
@@ -32,7 +33,7 @@ extern "C" {
 
 void carbon_freertos_trace_malloc(void *address, size_t size) {}
 void carbon_freertos_trace_free(void *address, size_t size) {}
-void carbon_freertos_trace_switched_in(uint32_t number) {
+CARBON_FAST_CODE void carbon_freertos_trace_switched_in(uint32_t number) {
     TraceTaskSwitchedInEvent trc; // NOLINT
     trc.header.timestamp = systimeUs();
     trc.number = number;
@@ -42,7 +43,7 @@ void carbon_freertos_trace_switched_in(uint32_t number) {
     context.push_array(reinterpret_cast<uint8_t *>(&trc), len);
     return;
 }
-void carbon_freertos_trace_switched_out(uint32_t number) {
+CARBON_FAST_CODE void carbon_freertos_trace_switched_out(uint32_t number) {
     TraceTaskSwitchedOutEvent trc; // NOLINT
     trc.header.timestamp = systimeUs();
     trc.number = number;
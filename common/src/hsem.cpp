@@ -18,12 +18,85 @@
 
 #include <carbon/diag.hpp>
 #include <carbon/hsem.hpp>
+#include <carbon/semaphore.hpp>
+
+#include <FreeRTOS.h>
+#include <task.h>
 
 namespace CARBON {
 
 HSEMSpinLock<HSEM_ID::InitSync> hSemInitSync;
 
-HSEMSpinLock<HSEM_ID::Trace> hsemTrace;
+HSEMMutex<HSEM_ID::Trace> hsemTrace;
+
+HSEMStats hsemStats[HSEM_COUNT];
+
+/*released from the HSEM ISR, only once created with a running scheduler*/
+static BinarySemaphore hsemReleased[HSEM_COUNT];
+
+static volatile uint32_t hsemReleasedInit;
+
+static volatile uint32_t hsemWaiters[HSEM_COUNT];
+
+/*set from the ISR, polled by the waiters without scheduler*/
+static volatile uint32_t hsemPending;
+
+bool HSEMWaitQueue::canBlock() {
+    return !IRQ::isInIRQ() && IRQ::isLocked() == IRQ::LockStatus::Unlocked &&
+           __get_BASEPRI() == 0 &&
+           xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
+}
+
+void HSEMWaitQueue::prepareWait(uint32_t semId) {
+    if (canBlock() && (hsemReleasedInit & (1U << semId)) == 0) {
+        hsemReleased[semId].init();
+        IRQ::lockRecursive();
+        hsemReleasedInit |= 1U << semId;
+        IRQ::unLockRecursive();
+    }
+    IRQ::lockRecursive();
+    hsemPending &= ~(1U << semId);
+    if (hsemWaiters[semId]++ == 0) {
+        HSEM_COMMON->ICR = 1U << semId;
+        HSEM_COMMON->IER |= 1U << semId;
+    }
+    IRQ::unLockRecursive();
+}
+
+void HSEMWaitQueue::cancelWait(uint32_t semId) {
+    IRQ::lockRecursive();
+    if (--hsemWaiters[semId] == 0) {
+        HSEM_COMMON->IER &= ~(1U << semId);
+    }
+    IRQ::unLockRecursive();
+}
+
+bool HSEMWaitQueue::wait(uint32_t semId, uint32_t timeoutMs) {
+    bool notified;
+    if (canBlock() && (hsemReleasedInit & (1U << semId)) != 0) {
+        notified = hsemReleased[semId].acquire(timeoutMs);
+    } else {
+        auto start = HAL_GetTick();
+        while ((hsemPending & (1U << semId)) == 0 &&
+               HAL_GetTick() - start < timeoutMs) {
+            __NOP();
+        }
+        notified = (hsemPending & (1U << semId)) != 0;
+    }
+    cancelWait(semId);
+    return notified;
+}
+
+void HSEMWaitQueue::notifyFromISR(uint32_t semMask) {
+    for (uint32_t semId = 0; semId < HSEM_COUNT; semId++) {
+        auto bit = 1U << semId;
+        if ((semMask & bit) != 0 && hsemWaiters[semId] != 0) {
+            hsemPending |= bit;
+            if ((hsemReleasedInit & bit) != 0)
+                hsemReleased[semId].release();
+        }
+    }
+}
 
 } // namespace CARBON
 
@@ -36,6 +109,7 @@ __weak void hsem_notify_isr(uint32_t /*mask*/) {}
 void hsem_isr(void) {
     auto semMask = uint32_t{HSEM_COMMON->MISR};
     HSEM_COMMON->ICR = semMask;
+    HSEMWaitQueue::notifyFromISR(semMask);
     hsem_notify_isr(semMask);
 }
 
@@ -0,0 +1,124 @@
+/**
+ ******************************************************************************
+ * @file           ipc.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Mailbox between CM7 and CM4, per core end point
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/diag.hpp>
+#include <carbon/ipc.hpp>
+#include <carbon/shared_memory.hpp>
+#include <carbon/systime.hpp>
+#include <carbon/timebase.hpp>
+
+#include <cmsis_os.h>
+#include <stm32h7xx_hal.h>
+
+namespace CARBON {
+
+static CoreDoorbell doorbell;
+
+#ifdef CORE_CM7
+static CoreMailbox mailbox(mailboxShared.toCM4, mailboxShared.toCM7,
+                           doorbell);
+
+void mailboxInit() { mailboxShared.init(); }
+#else
+static CoreMailbox mailbox(mailboxShared.toCM7, mailboxShared.toCM4,
+                           doorbell);
+#endif
+
+CoreMailbox &coreMailbox() { return mailbox; }
+
+#ifdef CORE_CM7
+static CoreOffloadClient offload(mailbox);
+
+CoreOffloadClient &offloadClient() { return offload; }
+#else
+static CoreOffloadWorker offload(mailbox);
+
+CoreOffloadWorker &offloadWorker() { return offload; }
+#endif
+
+bool mailboxPing(uint32_t &roundTripUs, uint32_t timeoutMs) {
+    MailboxMessage response;
+    auto start = systimeUs();
+    auto pong = mailbox.call(
+        static_cast<uint16_t>(MailboxType::Ping), &start, sizeof(start),
+        response, timeoutMs,
+        [](const MailboxMessage &message) { mailboxHandleSystem(message); });
+    roundTripUs = static_cast<uint32_t>(systimeUs() - start);
+    return pong;
+}
+
+bool mailboxHandleSystem(const MailboxMessage &message) {
+    switch (static_cast<MailboxType>(message.type)) {
+    case MailboxType::Ping:
+        if (message.kind == MailboxKind::Request) {
+            mailbox.respond(message, 0, message.payload, message.length);
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint64_t OffloadPlatform::nowUs() { return timebaseNowUs(); }
+
+void OffloadPlatform::yield() { osDelay(1); }
+
+bool OffloadPlatform::reachable(uintptr_t address, uint32_t length) {
+    if (length == 0)
+        return true;
+    if (address + length < address)
+        return false;
+    /*ITCM and DTCM*/
+    return address >= 0x20020000 ||
+           (address >= 0x00100000 && address + length <= 0x20000000);
+}
+
+#ifdef CORE_CM7
+/*by cache lines*/
+static void cacheRange(uintptr_t address, uint32_t length, uint32_t *&start,
+                       int32_t &size) {
+    auto first = address & ~uintptr_t{CACHE_ALIGNMENT - 1};
+    start = reinterpret_cast<uint32_t *>(first);
+    size = static_cast<int32_t>(address + length - first);
+}
+
+void OffloadPlatform::clean(uintptr_t address, uint32_t length) {
+    if (length == 0)
+        return;
+    uint32_t *start;
+    int32_t size;
+    cacheRange(address, length, start, size);
+    SCB_CleanDCache_by_Addr(start, size);
+}
+
+void OffloadPlatform::invalidate(uintptr_t address, uint32_t length) {
+    if (length == 0)
+        return;
+    uint32_t *start;
+    int32_t size;
+    cacheRange(address, length, start, size);
+    SCB_InvalidateDCache_by_Addr(start, size);
+}
+#else
+/*the CM4 has no data cache*/
+void OffloadPlatform::clean(uintptr_t, uint32_t) {}
+
+void OffloadPlatform::invalidate(uintptr_t, uint32_t) {}
+#endif
+
+} // namespace CARBON
@@ -20,7 +20,23 @@
 
 namespace CARBON {
 
-IRQ::LockStatus IRQ::irqLockStartStatus = IRQ::LockStatus::Unlocked;
+uint32_t IRQ::irqLockStartBasepri = uint32_t{0};
 uint32_t IRQ::irqLockCounter = uint32_t{0};
+uint32_t IRQ::maskStart = uint32_t{0};
+uintptr_t IRQ::maskSite = uintptr_t{0};
+IRQMaskStats IRQ::maskStats{};
+
+IRQMaskStats IRQ::getMaskStats() {
+    lockRecursive();
+    auto stats = maskStats;
+    unLockRecursive();
+    return stats;
+}
+
+void IRQ::resetMaskStats() {
+    lockRecursive();
+    maskStats = IRQMaskStats{};
+    unLockRecursive();
+}
 
 } // namespace CARBON
@@ -0,0 +1,153 @@
+/**
+ ******************************************************************************
+ * @file           latency.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          interrupt and interrupt to task latency histograms
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/latency.hpp>
+
+#ifdef FREERTOS_USE_TRACE
+#include <carbon/hsem.hpp>
+#include <carbon/shared_memory.hpp>
+#include <carbon/systime.hpp>
+#include <carbon/trace_format.hpp>
+#endif
+
+using namespace CARBON;
+
+static LatencyHistogram histograms[CARBON_LATENCY_SOURCES]
+                                  [CARBON_LATENCY_KINDS];
+
+static const char *const sourceNames[CARBON_LATENCY_SOURCES] = {
+    "systime", "eth", "sdmmc", "spi2"};
+
+static const char *const kindNames[CARBON_LATENCY_KINDS] = {
+    "entry", "handler", "wakeup"};
+
+/*state of the systime probe, restarted by the tasks*/
+CARBON_FAST_BSS static volatile uint32_t probePeriodCycles;
+CARBON_FAST_BSS static volatile uint32_t probeBase;
+CARBON_FAST_BSS static volatile uint32_t probeTicks;
+CARBON_FAST_BSS static volatile bool probeRestart;
+
+#ifdef FREERTOS_USE_TRACE
+static uint32_t publishNext;
+#endif
+
+namespace CARBON {
+
+LatencyHistogram &latencyHistogram(CarbonLatencySource source,
+                                   CarbonLatencyKind kind) {
+    return histograms[source][kind];
+}
+
+void latencyProbeStart(uint32_t periodUs) {
+    probePeriodCycles = periodUs * (SystemCoreClock / 1000000);
+    probeRestart = true;
+}
+
+CARBON_FAST_CODE void latencyProbeTick(uint32_t stamp) {
+    if (probeRestart) {
+        probeRestart = false;
+        probeBase = stamp;
+        probeTicks = 0;
+        return;
+    }
+    /*modulo 2^32, the DWT counter wraps in seconds*/
+    auto expected = probeBase + ++probeTicks * probePeriodCycles;
+    auto delay = static_cast<int32_t>(stamp - expected);
+    if (delay < 0) {
+        /*the reference entry was late, this one is the new earliest*/
+        probeBase = stamp;
+        probeTicks = 0;
+        delay = 0;
+    }
+    histograms[CARBON_LATENCY_SYSTIME][CARBON_LATENCY_ENTRY].record(
+        static_cast<uint32_t>(delay));
+}
+
+#ifdef FREERTOS_USE_TRACE
+void latencyPublish() {
+    static TraceLatencyEvent trc; // NOLINT
+    constexpr auto total = uint32_t{CARBON_LATENCY_SOURCES} *
+                           uint32_t{CARBON_LATENCY_KINDS};
+    for (uint32_t i = 0; i < total; i++) {
+        auto index = publishNext;
+        publishNext = (publishNext + 1) % total;
+        auto &histogram =
+            histograms[index / CARBON_LATENCY_KINDS][index %
+                                                     CARBON_LATENCY_KINDS];
+        if (histogram.count() == 0)
+            continue;
+
+        trc.header.timestamp = systimeUs();
+        trc.source = static_cast<uint8_t>(index / CARBON_LATENCY_KINDS);
+        trc.kind = static_cast<uint8_t>(index % CARBON_LATENCY_KINDS);
+        trc.cyclesPerUs = SystemCoreClock / 1000000;
+        auto summary = histogram.summary();
+        trc.count = summary.count;
+        trc.p50Cycles = summary.p50;
+        trc.p99Cycles = summary.p99;
+        trc.maxCycles = summary.max;
+        for (uint32_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+            trc.counts[bucket] = histogram.count(bucket);
+
+        traceFifoClass::ContextPush context(
+            traceFifo, sizeof(TraceLatencyEvent), hsemTrace);
+        uint32_t len = sizeof(TraceLatencyEvent);
+        context.push_array(reinterpret_cast<uint8_t *>(&trc), len);
+        return;
+    }
+}
+#endif
+
+} // namespace CARBON
+
+extern "C" {
+
+volatile uint32_t carbon_latency_entry_stamp[CARBON_LATENCY_SOURCES];
+
+CARBON_FAST_CODE void carbon_latency_exit(CarbonLatencySource source,
+                                          uint32_t enter) {
+    histograms[source][CARBON_LATENCY_HANDLER].record(DWT->CYCCNT - enter);
+}
+
+int carbon_latency_get(uint32_t source, uint32_t kind, uint32_t values[4]) {
+    if (source >= CARBON_LATENCY_SOURCES || kind >= CARBON_LATENCY_KINDS)
+        return -1;
+    auto summary = histograms[source][kind].summary();
+    values[0] = summary.count;
+    values[1] = summary.p50;
+    values[2] = summary.p99;
+    values[3] = summary.max;
+    return 0;
+}
+
+const char *carbon_latency_source_name(uint32_t source) {
+    return source < CARBON_LATENCY_SOURCES ? sourceNames[source] : "";
+}
+
+const char *carbon_latency_kind_name(uint32_t kind) {
+    return kind < CARBON_LATENCY_KINDS ? kindNames[kind] : "";
+}
+
+void carbon_latency_reset(void) {
+    for (auto &source : histograms) {
+        for (auto &histogram : source)
+            histogram.reset();
+    }
+    probeRestart = true;
+}
+}
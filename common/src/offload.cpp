@@ -0,0 +1,70 @@
+/**
+ ******************************************************************************
+ * @file           offload.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Jobs posted by the CM7 and executed by the CM4
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/offload.hpp>
+
+namespace CARBON {
+
+/*CRC-32 (IEEE 802.3, as zlib), 4 bit table to stay small*/
+static OffloadStatus crc32(const OffloadJob &job, OffloadResult &result) {
+    static constexpr uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+        0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+        0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+    auto data = reinterpret_cast<const uint8_t *>(job.input);
+    uint32_t crc = ~job.arg;
+    for (uint32_t i = 0; i < job.inputLength; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+    }
+    result.value = ~crc;
+    return OffloadStatus::Done;
+}
+
+/*FNV-1a 32 bit, arg 0 selects the standard offset basis*/
+static OffloadStatus fnv1a32(const OffloadJob &job, OffloadResult &result) {
+    auto data = reinterpret_cast<const uint8_t *>(job.input);
+    uint32_t hash = job.arg == 0 ? 0x811C9DC5 : job.arg;
+    for (uint32_t i = 0; i < job.inputLength; i++) {
+        hash ^= data[i];
+        hash *= 0x01000193;
+    }
+    result.value = hash;
+    return OffloadStatus::Done;
+}
+
+using OffloadHandler = OffloadStatus (*)(const OffloadJob &, OffloadResult &);
+
+static constexpr OffloadHandler
+    handlers[static_cast<uint32_t>(OffloadFunction::Count)] = {
+        crc32,
+        fnv1a32,
+};
+
+OffloadStatus offloadExecute(const OffloadJob &job, OffloadResult &result) {
+    auto function = static_cast<uint32_t>(job.function);
+    if (function >= static_cast<uint32_t>(OffloadFunction::Count))
+        return OffloadStatus::UnknownFunction;
+    if (job.inputLength > 0 && job.input == 0)
+        return OffloadStatus::BadJob;
+    return handlers[function](job, result);
+}
+
+} // namespace CARBON
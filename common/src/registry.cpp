@@ -0,0 +1,40 @@
+/**
+ ******************************************************************************
+ * @file           registry.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Latest value registry shared between the cores
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/registry.hpp>
+#include <carbon/shared_memory.hpp>
+
+namespace CARBON {
+
+RegistryShared &registryShared() { return registrySharedData; }
+
+#ifdef CORE_CM7
+void registryInit() { registrySharedData.init(); }
+#endif
+
+} // namespace CARBON
+
+using namespace CARBON;
+
+extern "C" {
+
+void carbon_registry_net_link(uint32_t up, uint32_t ip, uint32_t netmask,
+                              uint32_t gateway) {
+    registryPublish<RegistryId::NetLink>({up, ip, netmask, gateway});
+}
+}
@@ -45,6 +45,12 @@ void resetSyncFlag() {
 
 volatile uint32_t syncFlag;
 
+RegistryShared registrySharedData;
+
+SeqLock<TimebaseState> timebaseShared;
+
+MailboxShared mailboxShared;
+
 /*DIAG FIFO*/
 
 FIFO_DEFINITION(diag)
@@ -16,9 +16,11 @@
  ******************************************************************************
  */
 
+#include <carbon/common.hpp>
 #include <carbon/diag.hpp>
 #include <carbon/error.hpp>
 #include <carbon/irq.hpp>
+#include <carbon/latency.hpp>
 #include <carbon/sync.hpp>
 #include <carbon/systime.hpp>
 
@@ -42,18 +44,20 @@ using namespace CARBON;
 #define SYSTIME_TIM_CLK_EN() __HAL_RCC_TIM5_CLK_ENABLE()
 #endif
 
+static constexpr uint32_t SYSTIME_TIM_PRIORITY =
+    TICK_INT_PRIORITY < IRQ::CEILING ? IRQ::CEILING : TICK_INT_PRIORITY;
+
 static bool timRunning;
 
 static IRQLockRecursive irqLockRecursive;
 
 void low_level_system_time() {
-#ifdef CORE_CM7
     /*
-     *Setting DWT counter
+     *Setting DWT counter, also used to time the critical sections
      */
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
     DWT_Type *dwt = DWT;
     SET_BIT(dwt->CTRL, DWT_CTRL_CYCCNTENA_Msk);
-#endif
     RCC_ClkInitTypeDef clkConfig{};
 
     uint32_t latency;
@@ -109,23 +113,24 @@ void low_level_system_time() {
     SYSTIME_TIM->DIER |= TIM_DIER_CC1IE;
     SYSTIME_TIM->CR1 |= TIM_CR1_CEN;
 
-    HAL_NVIC_SetPriority(SYSTIME_TIM_IRQ, TICK_INT_PRIORITY, 0);
+    /*it shares the counter with systimeUs(), under the IRQ ceiling*/
+    HAL_NVIC_SetPriority(SYSTIME_TIM_IRQ, SYSTIME_TIM_PRIORITY, 0);
 
     HAL_NVIC_EnableIRQ(SYSTIME_TIM_IRQ);
 }
 
-static volatile uint64_t usCounterBase = 0;
-static volatile uint32_t usTimLastCount = 0;
+CARBON_FAST_BSS static volatile uint64_t usCounterBase;
+CARBON_FAST_BSS static volatile uint32_t usTimLastCount;
 
-static uint64_t usCounterAdjust(uint32_t usTimCnt) {
+CARBON_FAST_CODE static uint64_t usCounterAdjust(uint32_t usTimCnt) {
     if (usTimCnt < usTimLastCount) {
-        usCounterBase += SYSTIME_TIM_PERIOD;
+        usCounterBase += uint64_t{SYSTIME_TIM_PERIOD} + 1;
     }
     usTimLastCount = usTimCnt;
     return usCounterBase + usTimCnt;
 }
 
-uint64_t systimeUs() {
+CARBON_FAST_CODE uint64_t systimeUs() {
     LockGuard<IRQLockRecursive> lock(irqLockRecursive);
     uint64_t count = usCounterAdjust(SYSTIME_TIM->CNT);
     return count;
@@ -147,9 +152,38 @@ void delayUs(uint32_t us) {
     }
 }
 
+CARBON_FAST_BSS static volatile uint32_t probePeriod;
+
+void systimeProbe(uint32_t periodUs) {
+    LockGuard<IRQLockRecursive> lock(irqLockRecursive);
+    SYSTIME_TIM->DIER &= ~TIM_DIER_CC2IE;
+    probePeriod = periodUs;
+    if (periodUs == 0)
+        return;
+    latencyProbeStart(periodUs);
+    SYSTIME_TIM->CCR2 = SYSTIME_TIM->CNT + periodUs;
+    SYSTIME_TIM->SR = ~TIM_SR_CC2IF;
+    SYSTIME_TIM->DIER |= TIM_DIER_CC2IE;
+}
+
+CARBON_FAST_BSS static volatile uint32_t samplerPeriod;
+CARBON_FAST_BSS static void (*volatile samplerCallback)(void);
+
+void systimeSampler(uint32_t periodUs, void (*callback)(void)) {
+    LockGuard<IRQLockRecursive> lock(irqLockRecursive);
+    SYSTIME_TIM->DIER &= ~TIM_DIER_CC3IE;
+    samplerPeriod = periodUs;
+    samplerCallback = callback;
+    if (periodUs == 0 || callback == nullptr)
+        return;
+    SYSTIME_TIM->CCR3 = SYSTIME_TIM->CNT + periodUs;
+    SYSTIME_TIM->SR = ~TIM_SR_CC3IF;
+    SYSTIME_TIM->DIER |= TIM_DIER_CC3IE;
+}
+
 extern "C" {
 
-void carbon_hw_us_systime_tim_isr() {
+CARBON_FAST_CODE void carbon_hw_us_systime_tim_isr() {
     uint32_t sr = SYSTIME_TIM->SR;
     if (0 != (sr & TIM_SR_UIF)) {
         SYSTIME_TIM->SR = ~TIM_DIER_UIE;
@@ -163,6 +197,17 @@ void carbon_hw_us_systime_tim_isr() {
             cnt -= SYSTIME_TIM_PERIOD;
         SYSTIME_TIM->CCR1 = cnt;
     }
+    if (0 != (sr & TIM_SR_CC2IF)) {
+        /*the full span counter wraps as the compare register*/
+        SYSTIME_TIM->SR = ~TIM_SR_CC2IF;
+        SYSTIME_TIM->CCR2 += probePeriod;
+        latencyProbeTick(carbon_latency_entry_stamp[CARBON_LATENCY_SYSTIME]);
+    }
+    if (0 != (sr & TIM_SR_CC3IF)) {
+        SYSTIME_TIM->SR = ~TIM_SR_CC3IF;
+        SYSTIME_TIM->CCR3 += samplerPeriod;
+        samplerCallback();
+    }
 }
 
 /***** HAL Tick withSysTick *****/
@@ -198,12 +243,9 @@ void HAL_ResumeTick() {}
 void carbon_conf_timer_runtime_stats() {}
 
 uint32_t carbon_time_counter_value() {
-    uint64_t us = systimeUs();
-    // Freertos run time stats counter must not wrap - good for first ~71
-    // minutes
-    if (us > 0xFFFFFFFFUL)
-        return 0xFFFFFFFFUL;
-    return static_cast<uint32_t>(us);
+    // Wraps every ~71 minutes, as the FreeRTOS run time counters do: the
+    // differences of two samples less than 71 minutes apart stay exact
+    return static_cast<uint32_t>(systimeUs());
 }
 
 /**********/
@@ -0,0 +1,107 @@
+/**
+ ******************************************************************************
+ * @file           timebase.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Cross core time base, CM7 time is the reference
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/irq.hpp>
+#include <carbon/shared_memory.hpp>
+#include <carbon/systime.hpp>
+#include <carbon/timebase.hpp>
+
+#include <stm32h7xx_hal.h>
+
+namespace CARBON {
+
+static constexpr uint32_t READ_RETRIES = 16;
+
+#ifdef CORE_CM7
+
+/*
+ * The CM4 system time runs on TIM5, clocked on APB1 as TIM2. The CM7 reads
+ * the TIM5 counter between two local time stamps, the difference of the two
+ * local stamps bounds the error of the sample.
+ */
+#define TIMEBASE_REMOTE_TIM TIM5
+
+static TimebaseEstimator estimator;
+
+static uint64_t remoteCounterBase;
+static uint32_t remoteLastCount;
+
+static uint64_t remoteCounterAdjust(uint32_t cnt) {
+    if (cnt < remoteLastCount) {
+        remoteCounterBase += 1ULL << 32;
+    }
+    remoteLastCount = cnt;
+    return remoteCounterBase + cnt;
+}
+
+void timebaseInit() {
+    remoteCounterBase = 0;
+    remoteLastCount = 0;
+    estimator.reset(systimeUs());
+    timebaseShared.init();
+    timebaseShared.write(estimator.state());
+}
+
+void timebasePublish() {
+    if ((TIMEBASE_REMOTE_TIM->CR1 & TIM_CR1_CEN) == 0)
+        return; /*CM4 time not running yet*/
+
+    IRQ::lockRecursive();
+    auto start = systimeUs();
+    auto remote = TIMEBASE_REMOTE_TIM->CNT;
+    auto end = systimeUs();
+    IRQ::unLockRecursive();
+
+    auto window = static_cast<uint32_t>(end - start);
+    if (estimator.update(start + window / 2, remoteCounterAdjust(remote),
+                         window)) {
+        timebaseShared.write(estimator.state());
+    }
+}
+
+uint64_t timebaseNowUs() { return systimeUs(); }
+
+uint64_t timebaseToMasterUs(uint64_t localUs) { return localUs; }
+
+bool timebaseStats(TimebaseStats &stats) {
+    stats = estimator.state().stats;
+    return estimator.state().valid != 0;
+}
+
+#else
+
+uint64_t timebaseToMasterUs(uint64_t localUs) {
+    TimebaseState state;
+    if (!timebaseShared.read(state, READ_RETRIES) || state.valid == 0)
+        return localUs;
+    return localUs + static_cast<uint64_t>(timebaseOffsetAt(state, localUs));
+}
+
+uint64_t timebaseNowUs() { return timebaseToMasterUs(systimeUs()); }
+
+bool timebaseStats(TimebaseStats &stats) {
+    TimebaseState state;
+    if (!timebaseShared.read(state, READ_RETRIES))
+        return false;
+    stats = state.stats;
+    return state.valid != 0;
+}
+
+#endif
+
+} // namespace CARBON
@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * @file           timebase_estimator.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Cross core time base, offset and drift estimator
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/timebase.hpp>
+
+#include <cstring>
+
+namespace CARBON {
+
+void TimebaseEstimator::reset(uint64_t epochUs) {
+    std::memset(&state_, 0, sizeof(state_));
+    state_.epochUs = epochUs;
+    state_.stats.minWindowUs = UINT32_MAX;
+    anchorLocalUs_ = 0;
+    anchorOffsetUs_ = 0;
+    driftValid_ = false;
+}
+
+bool TimebaseEstimator::update(uint64_t masterUs, uint64_t localUs,
+                               uint32_t windowUs) {
+    auto &stats = state_.stats;
+
+    if (windowUs > MaxWindowUs) {
+        stats.rejected++;
+        return false;
+    }
+
+    if (windowUs < stats.minWindowUs)
+        stats.minWindowUs = windowUs;
+    if (windowUs > stats.maxWindowUs)
+        stats.maxWindowUs = windowUs;
+
+    auto offset = static_cast<int64_t>(masterUs - localUs);
+
+    if (state_.valid == 0) {
+        state_.valid = 1;
+        anchorLocalUs_ = localUs;
+        anchorOffsetUs_ = offset;
+    } else {
+        auto residual = offset - timebaseOffsetAt(state_, localUs);
+        stats.lastResidualUs = static_cast<int32_t>(residual);
+        auto absResidual =
+            static_cast<uint32_t>(residual < 0 ? -residual : residual);
+        if (absResidual > stats.maxResidualUs)
+            stats.maxResidualUs = absResidual;
+    }
+
+    auto baseline = localUs - anchorLocalUs_;
+    if (baseline >= DriftBaselineUs) {
+        auto slope = ((anchorOffsetUs_ - offset) * 1000000000LL) /
+                     static_cast<int64_t>(baseline);
+        if (driftValid_) {
+            state_.driftPpb += static_cast<int32_t>(
+                (slope - state_.driftPpb) / (1 << DriftFilterShift));
+        } else {
+            state_.driftPpb = static_cast<int32_t>(slope);
+            driftValid_ = true;
+        }
+        anchorLocalUs_ = localUs;
+        anchorOffsetUs_ = offset;
+    }
+
+    state_.refLocalUs = localUs;
+    state_.refOffsetUs = offset;
+    stats.driftPpb = state_.driftPpb;
+    stats.samples++;
+    return true;
+}
+
+} // namespace CARBON
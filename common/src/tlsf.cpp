@@ -0,0 +1,330 @@
+/**
+ ******************************************************************************
+ * @file           tlsf.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Two level segregated fit allocator, constant time
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/tlsf.hpp>
+
+namespace CARBON {
+
+/*
+ * A block of size S starts on a granule G, its header fills the end of the
+ * first granule and the payload starts on the second one:
+ *
+ *   | .... header | payload ............................ | .... next header
+ *   ^ start       ^ start + G                            ^ start + S
+ */
+
+static inline uint32_t msb(size_t value) {
+    return static_cast<uint32_t>(sizeof(unsigned long long) * 8 - 1 -
+                                 __builtin_clzll(value));
+}
+
+static inline uint32_t lsb(uint32_t value) {
+    return static_cast<uint32_t>(__builtin_ctz(value));
+}
+
+static inline size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+bool Tlsf::init(void *memory, size_t size, size_t granularity) {
+    if (granularity == 0 || (granularity & (granularity - 1)) != 0)
+        return false;
+
+    /*the header has to fit in the first granule*/
+    granularity_ = granularity;
+    while (granularity_ < HEADER)
+        granularity_ <<= 1;
+    granularityLog2_ = msb(granularity_);
+    minBlock_ = alignUp(sizeof(Block), granularity_);
+    if (minBlock_ < 2 * granularity_)
+        minBlock_ = 2 * granularity_;
+
+    auto address = reinterpret_cast<uintptr_t>(memory);
+    auto start = alignUp(address, granularity_);
+    if (address + size < start + granularity_)
+        return false;
+    auto sentinelStart = (address + size - granularity_) & ~(granularity_ - 1);
+    if (sentinelStart < start + minBlock_)
+        return false;
+
+    flBitmap_ = 0;
+    for (uint32_t fl = 0; fl < FL_COUNT; fl++) {
+        slBitmap_[fl] = 0;
+        for (uint32_t sl = 0; sl < SL_COUNT; sl++)
+            lists_[fl][sl] = nullptr;
+    }
+    used_ = 0;
+    highWater_ = 0;
+    allocations_ = 0;
+    failures_ = 0;
+
+    auto first =
+        reinterpret_cast<Block *>(start + granularity_ - HEADER);
+    sentinel_ =
+        reinterpret_cast<Block *>(sentinelStart + granularity_ - HEADER);
+    begin_ = start;
+    end_ = sentinelStart;
+
+    first->sizeAndFlags = sentinelStart - start;
+    first->prevPhys = nullptr;
+    sentinel_->sizeAndFlags = 0;
+    sentinel_->prevPhys = first;
+    markFree(first, true);
+    insert(first);
+    return true;
+}
+
+Tlsf::Block *Tlsf::nextPhys(const Block *block) const {
+    return reinterpret_cast<Block *>(reinterpret_cast<uintptr_t>(block) +
+                                     sizeOf(block));
+}
+
+Tlsf::Block *Tlsf::blockOf(const void *pointer) const {
+    return reinterpret_cast<Block *>(reinterpret_cast<uintptr_t>(pointer) -
+                                     HEADER);
+}
+
+void *Tlsf::payloadOf(Block *block) const {
+    return reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(block) +
+                                    HEADER);
+}
+
+void Tlsf::setSize(Block *block, size_t size) {
+    block->sizeAndFlags =
+        size | (block->sizeAndFlags & (FREE_BIT | PREV_FREE_BIT));
+}
+
+void Tlsf::markFree(Block *block, bool free) {
+    auto next = nextPhys(block);
+    if (free) {
+        block->sizeAndFlags |= FREE_BIT;
+        next->sizeAndFlags |= PREV_FREE_BIT;
+    } else {
+        block->sizeAndFlags &= ~FREE_BIT;
+        next->sizeAndFlags &= ~PREV_FREE_BIT;
+    }
+}
+
+void Tlsf::mapping(size_t size, uint32_t &fl, uint32_t &sl) const {
+    auto units = size >> granularityLog2_;
+    if (units < SL_COUNT) {
+        fl = 0;
+        sl = static_cast<uint32_t>(units);
+    } else {
+        auto top = msb(units);
+        fl = top - SL_LOG2 + 1;
+        sl = static_cast<uint32_t>(units >> (top - SL_LOG2)) - SL_COUNT;
+    }
+}
+
+void Tlsf::insert(Block *block) {
+    uint32_t fl, sl;
+    mapping(sizeOf(block), fl, sl);
+    auto &head = lists_[fl][sl];
+    block->prevFree = nullptr;
+    block->nextFree = head;
+    if (head != nullptr)
+        head->prevFree = block;
+    head = block;
+    flBitmap_ |= 1U << fl;
+    slBitmap_[fl] |= 1U << sl;
+}
+
+void Tlsf::remove(Block *block) {
+    uint32_t fl, sl;
+    mapping(sizeOf(block), fl, sl);
+    if (block->prevFree != nullptr)
+        block->prevFree->nextFree = block->nextFree;
+    else
+        lists_[fl][sl] = block->nextFree;
+    if (block->nextFree != nullptr)
+        block->nextFree->prevFree = block->prevFree;
+    if (lists_[fl][sl] == nullptr) {
+        slBitmap_[fl] &= ~(1U << sl);
+        if (slBitmap_[fl] == 0)
+            flBitmap_ &= ~(1U << fl);
+    }
+}
+
+Tlsf::Block *Tlsf::findFree(size_t size) {
+    /*round up to the next list, every block there is large enough*/
+    auto units = size >> granularityLog2_;
+    if (units >= SL_COUNT)
+        size += ((size_t{1} << (msb(units) - SL_LOG2)) - 1) << granularityLog2_;
+
+    uint32_t fl, sl;
+    mapping(size, fl, sl);
+    if (fl >= FL_COUNT)
+        return nullptr;
+
+    auto slMap = slBitmap_[fl] & (~0U << sl);
+    if (slMap == 0) {
+        auto flMap = fl + 1 < FL_COUNT ? flBitmap_ & (~0U << (fl + 1)) : 0;
+        if (flMap == 0)
+            return nullptr;
+        fl = lsb(flMap);
+        slMap = slBitmap_[fl];
+    }
+    return lists_[fl][lsb(slMap)];
+}
+
+void *Tlsf::allocate(size_t size) {
+    if (size == 0 || size > (size_t{1} << 30)) {
+        failures_++;
+        return nullptr;
+    }
+    auto blockSize = alignUp(size + granularity_, granularity_);
+    if (blockSize < minBlock_)
+        blockSize = minBlock_;
+
+    auto block = findFree(blockSize);
+    if (block == nullptr) {
+        failures_++;
+        return nullptr;
+    }
+    remove(block);
+
+    auto remaining = sizeOf(block) - blockSize;
+    if (remaining >= minBlock_) {
+        setSize(block, blockSize);
+        auto rest = nextPhys(block);
+        rest->sizeAndFlags = remaining;
+        rest->prevPhys = block;
+        nextPhys(rest)->prevPhys = rest;
+        markFree(rest, true);
+        insert(rest);
+    }
+    markFree(block, false);
+
+    used_ += sizeOf(block);
+    if (used_ > highWater_)
+        highWater_ = used_;
+    allocations_++;
+    return payloadOf(block);
+}
+
+void Tlsf::free(void *pointer) {
+    if (pointer == nullptr)
+        return;
+    auto block = blockOf(pointer);
+    used_ -= sizeOf(block);
+    markFree(block, true);
+
+    if (isPrevFree(block)) {
+        auto prev = block->prevPhys;
+        remove(prev);
+        setSize(prev, sizeOf(prev) + sizeOf(block));
+        nextPhys(prev)->prevPhys = prev;
+        block = prev;
+    }
+    auto next = nextPhys(block);
+    if (isFree(next)) {
+        remove(next);
+        setSize(block, sizeOf(block) + sizeOf(next));
+        nextPhys(block)->prevPhys = block;
+    }
+    markFree(block, true);
+    insert(block);
+}
+
+size_t Tlsf::usableSize(const void *pointer) const {
+    return sizeOf(blockOf(pointer)) - granularity_;
+}
+
+TlsfStats Tlsf::stats() const {
+    TlsfStats stats{};
+    stats.totalBytes = end_ - begin_;
+    stats.usedBytes = used_;
+    stats.highWaterBytes = highWater_;
+    stats.allocations = allocations_;
+    stats.failures = failures_;
+    if (sentinel_ == nullptr)
+        return stats;
+
+    auto block = reinterpret_cast<const Block *>(begin_ + granularity_ - HEADER);
+    for (; block != sentinel_; block = nextPhys(block)) {
+        auto size = sizeOf(block);
+        if (isFree(block)) {
+            stats.freeBlocks++;
+            stats.freeBytes += size;
+            if (size > stats.largestFreeBytes)
+                stats.largestFreeBytes = size;
+        } else {
+            stats.usedBlocks++;
+        }
+    }
+    if (stats.freeBytes > 0) {
+        stats.fragmentation = static_cast<uint32_t>(
+            100 - (static_cast<uint64_t>(stats.largestFreeBytes) * 100) /
+                      stats.freeBytes);
+    }
+    return stats;
+}
+
+bool Tlsf::check() const {
+    if (sentinel_ == nullptr)
+        return false;
+
+    size_t used = 0;
+    uint32_t freeBlocks = 0;
+    const Block *prev = nullptr;
+    bool prevFree = false;
+    auto block = reinterpret_cast<const Block *>(begin_ + granularity_ - HEADER);
+    while (block != sentinel_) {
+        auto size = sizeOf(block);
+        auto address = reinterpret_cast<uintptr_t>(block);
+        if (size < minBlock_ || (size & (granularity_ - 1)) != 0 ||
+            address + size > end_ + granularity_ - HEADER)
+            return false;
+        if (block->prevPhys != prev || isPrevFree(block) != prevFree)
+            return false;
+        /*two free neighbours must have been merged*/
+        if (prevFree && isFree(block))
+            return false;
+        if (isFree(block))
+            freeBlocks++;
+        else
+            used += size;
+        prevFree = isFree(block);
+        prev = block;
+        block = nextPhys(block);
+    }
+    if (sentinel_->prevPhys != prev || isPrevFree(sentinel_) != prevFree ||
+        used != used_)
+        return false;
+
+    uint32_t listed = 0;
+    for (uint32_t fl = 0; fl < FL_COUNT; fl++) {
+        for (uint32_t sl = 0; sl < SL_COUNT; sl++) {
+            bool mapped = (flBitmap_ & (1U << fl)) && (slBitmap_[fl] & (1U << sl));
+            if (mapped != (lists_[fl][sl] != nullptr))
+                return false;
+            for (auto free = lists_[fl][sl]; free != nullptr;
+                 free = free->nextFree) {
+                uint32_t f, s;
+                mapping(sizeOf(free), f, s);
+                if (!isFree(free) || f != fl || s != sl)
+                    return false;
+                listed++;
+            }
+        }
+    }
+    return listed == freeBlocks;
+}
+
+} // namespace CARBON
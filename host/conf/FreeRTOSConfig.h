@@ -0,0 +1,133 @@
+/**
+ ******************************************************************************
+ * @file           FreeRTOSConfig.h
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          FreeRTOS configuration of the host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+// clang-format off
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*
+ * The one of CM7/conf with the POSIX port: same priorities, tick, heap and
+ * hooks, so the application runs unchanged. The idle task sleeps in the port
+ * instead of the low power modes and an assert aborts, for the debugger.
+ */
+
+#include <stdint.h>
+extern uint32_t SystemCoreClock;
+
+#define configUSE_PREEMPTION 1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION	1
+#define configUSE_IDLE_HOOK 0
+#define configUSE_TICK_HOOK 0
+#define configMAX_PRIORITIES (7)
+
+#define configSUPPORT_STATIC_ALLOCATION 1
+#define configSUPPORT_DYNAMIC_ALLOCATION 1
+
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 1
+
+#define configCPU_CLOCK_HZ (SystemCoreClock)
+#ifdef __cplusplus
+#define configTICK_RATE_HZ (static_cast<TickType_t>(1000))
+
+#define configMINIMAL_STACK_SIZE (static_cast<uint16_t>(128))
+#define configTOTAL_HEAP_SIZE (static_cast<size_t>(128 * 1024))
+#else
+#define configTICK_RATE_HZ ((TickType_t)1000)
+
+#define configMINIMAL_STACK_SIZE ((uint16_t)128)
+#define configTOTAL_HEAP_SIZE ((size_t)(128 * 1024))
+#endif
+
+#define configMAX_TASK_NAME_LEN (16)
+
+#define configUSE_16_BIT_TICKS        0
+#define configIDLE_SHOULD_YIELD       1
+#define configUSE_MUTEXES             1
+#define configUSE_RECURSIVE_MUTEXES   1
+#define configUSE_COUNTING_SEMAPHORES 1
+#define configQUEUE_REGISTRY_SIZE     8
+/*portSUPPRESS_TICKS_AND_SLEEP() of the POSIX port*/
+#define configUSE_TICKLESS_IDLE       1
+#define configUSE_POSIX_ERRNO         1
+
+#define configCHECK_FOR_STACK_OVERFLOW 2
+#define configUSE_MALLOC_FAILED_HOOK   1
+#define configUSE_APPLICATION_TASK_TAG 0
+
+#define configUSE_STATS_FORMATTING_FUNCTIONS 1
+#define configUSE_TRACE_FACILITY             1
+#define portREMOVE_STATIC_QUALIFIER          1
+#define configGENERATE_RUN_TIME_STATS        1
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES 0
+#define configMAX_CO_ROUTINE_PRIORITIES (2)
+
+/* Software timer definitions. */
+#define configUSE_TIMERS 0
+#define configTIMER_TASK_PRIORITY 2
+#define configTIMER_QUEUE_LENGTH 10
+#define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE * 2)
+
+#define INCLUDE_vTaskPrioritySet 1
+#define INCLUDE_uxTaskPriorityGet 1
+#define INCLUDE_vTaskDelete 1
+#define INCLUDE_vTaskCleanUpResources 0
+#define INCLUDE_vTaskSuspend 1
+#define INCLUDE_vTaskDelayUntil 1
+#define INCLUDE_vTaskDelay 1
+#define INCLUDE_xTaskGetSchedulerState 1
+#define INCLUDE_xTaskGetIdleTaskHandle 1
+
+#define USE_FreeRTOS_HEAP_5
+
+/*the values of the target, BASEPRI is a flag of the simulated core*/
+#define configPRIO_BITS 4
+#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY 15
+#define configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY 5
+#define configKERNEL_INTERRUPT_PRIORITY                                        \
+    (configLIBRARY_LOWEST_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+#define configMAX_SYSCALL_INTERRUPT_PRIORITY                                   \
+    (configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void carbon_raw_diag_print(const char *format, ...);
+#ifdef __cplusplus
+}
+#endif
+
+#define configASSERT(x)                                                        \
+    if ((x) == 0) {																  \
+		carbon_raw_diag_print("%s, %s, %d, %s",__FILE__, __func__, __LINE__, #x); \
+        __builtin_abort();                                                     \
+    }
+
+uint32_t carbon_time_counter_value();
+void carbon_conf_timer_runtime_stats();
+
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS carbon_conf_timer_runtime_stats
+#define portGET_RUN_TIME_COUNTER_VALUE carbon_time_counter_value
+
+#ifdef FREERTOS_USE_TRACE
+#include <FreeRTOSTrace.h>
+#endif
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,158 @@
+/**
+ ******************************************************************************
+ * @file           cmsis_gcc.h
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          CMSIS compiler intrinsics for the host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef __CMSIS_GCC_H
+#define __CMSIS_GCC_H
+
+#include <stdint.h>
+
+/*
+ * The interrupt mask registers are the ones of the simulated core of the
+ * FreeRTOS POSIX port, the barriers are compiler and hardware fences.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t ulPortRaiseBASEPRI(void);
+uint32_t ulPortGetBASEPRI(void);
+void vPortSetBASEPRI(uint32_t ulNewMaskValue);
+uint32_t ulPortGetPRIMASK(void);
+void vPortSetPRIMASK(uint32_t ulNewMaskValue);
+long xPortIsInsideInterrupt(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifndef __ASM
+#define __ASM __asm
+#endif
+#ifndef __INLINE
+#define __INLINE inline
+#endif
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE static inline
+#endif
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE __attribute__((always_inline)) static inline
+#endif
+#ifndef __NO_RETURN
+#define __NO_RETURN __attribute__((__noreturn__))
+#endif
+#ifndef __USED
+#define __USED __attribute__((used))
+#endif
+#ifndef __WEAK
+#define __WEAK __attribute__((weak))
+#endif
+#ifndef __PACKED
+#define __PACKED __attribute__((packed, aligned(1)))
+#endif
+#ifndef __PACKED_STRUCT
+#define __PACKED_STRUCT struct __attribute__((packed, aligned(1)))
+#endif
+#ifndef __ALIGNED
+#define __ALIGNED(x) __attribute__((aligned(x)))
+#endif
+#ifndef __RESTRICT
+#define __RESTRICT __restrict
+#endif
+
+__STATIC_FORCEINLINE void __enable_irq(void) { vPortSetPRIMASK(0); }
+
+__STATIC_FORCEINLINE void __disable_irq(void) { vPortSetPRIMASK(1); }
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void) {
+    return ulPortGetPRIMASK();
+}
+
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t priMask) {
+    vPortSetPRIMASK(priMask);
+}
+
+__STATIC_FORCEINLINE uint32_t __get_BASEPRI(void) {
+    return ulPortGetBASEPRI();
+}
+
+__STATIC_FORCEINLINE void __set_BASEPRI(uint32_t basePri) {
+    vPortSetBASEPRI(basePri);
+}
+
+/*raises only, as the hardware BASEPRI_MAX*/
+__STATIC_FORCEINLINE void __set_BASEPRI_MAX(uint32_t basePri) {
+    uint32_t current = ulPortGetBASEPRI();
+    if (basePri != 0 && (current == 0 || basePri < current))
+        vPortSetBASEPRI(basePri);
+}
+
+/*an exception number only tells the thread mode from the handler mode*/
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void) {
+    return xPortIsInsideInterrupt() ? 16U : 0U;
+}
+
+__STATIC_FORCEINLINE void __ISB(void) {
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_FORCEINLINE void __DSB(void) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_FORCEINLINE void __DMB(void) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#define __NOP() __ASM volatile("nop")
+#define __WFI() __ASM volatile("pause")
+#define __WFE() __ASM volatile("pause")
+#define __SEV() __ASM volatile("")
+#define __BKPT(value) __builtin_trap()
+
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value) {
+    return __builtin_bswap32(value);
+}
+
+__STATIC_FORCEINLINE uint32_t __REV16(uint32_t value) {
+    return ((value & 0xFF00FF00U) >> 8) | ((value & 0x00FF00FFU) << 8);
+}
+
+__STATIC_FORCEINLINE int16_t __REVSH(int16_t value) {
+    return (int16_t)__builtin_bswap16((uint16_t)value);
+}
+
+__STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value) {
+    uint32_t result = 0;
+    for (uint32_t i = 0; i < 32; i++) {
+        result = (result << 1) | (value & 1U);
+        value >>= 1;
+    }
+    return result;
+}
+
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value) {
+    return value == 0 ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2) {
+    op2 %= 32U;
+    return op2 == 0U ? op1 : (op1 >> op2) | (op1 << (32U - op2));
+}
+
+#endif /* __CMSIS_GCC_H */
@@ -0,0 +1,169 @@
+/**
+ ******************************************************************************
+ * @file           core_cm7.h
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          CMSIS Cortex-M7 core peripherals for the host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef __CORE_CM7_H_GENERIC
+#define __CORE_CM7_H_GENERIC
+
+#include <stdint.h>
+
+#include "cmsis_gcc.h"
+
+/*
+ * Included by the device header in place of the CMSIS one: the types and the
+ * constants the firmware uses, the NVIC on the simulated interrupt lines of
+ * the port, no caches, the DWT cycle counter from the monotonic clock at
+ * SystemCoreClock.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __CM7_CMSIS_VERSION_MAIN (5U)
+#define __CM7_CMSIS_VERSION_SUB (1U)
+#define __CORTEX_M (7U)
+#define __FPU_USED 1U
+
+#ifdef __cplusplus
+#define __I volatile
+#else
+#define __I volatile const
+#endif
+#define __O volatile
+#define __IO volatile
+#define __IM volatile const
+#define __OM volatile
+#define __IOM volatile
+
+typedef struct {
+    __IOM uint32_t CTRL;
+    __IOM uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    __IOM uint32_t DHCSR;
+    __OM uint32_t DCRSR;
+    __IOM uint32_t DCRDR;
+    __IOM uint32_t DEMCR;
+} CoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Pos 0U
+#define DWT_CTRL_CYCCNTENA_Msk (1UL << DWT_CTRL_CYCCNTENA_Pos)
+#define CoreDebug_DEMCR_TRCENA_Pos 24U
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << CoreDebug_DEMCR_TRCENA_Pos)
+
+/*host/src/cortex.c, the counter is updated at each access of DWT*/
+DWT_Type *carbon_host_dwt(void);
+extern CoreDebug_Type carbon_host_core_debug;
+
+#define DWT (carbon_host_dwt())
+#define CoreDebug (&carbon_host_core_debug)
+
+/*the simulated interrupt lines, numbered as IRQn, FreeRTOS POSIX port*/
+void vPortHostEnableIrq(uint32_t ulIrq, long xEnable);
+void vPortHostPendIrq(uint32_t ulIrq);
+void vPortHostClearIrq(uint32_t ulIrq);
+long xPortHostIrqPending(uint32_t ulIrq);
+
+/*priorities are not simulated, all the lines are under the kernel*/
+void carbon_host_nvic_set_priority(IRQn_Type IRQn, uint32_t priority);
+uint32_t carbon_host_nvic_get_priority(IRQn_Type IRQn);
+
+__STATIC_INLINE void NVIC_EnableIRQ(IRQn_Type IRQn) {
+    if ((int32_t)IRQn >= 0)
+        vPortHostEnableIrq((uint32_t)IRQn, 1);
+}
+
+__STATIC_INLINE void NVIC_DisableIRQ(IRQn_Type IRQn) {
+    if ((int32_t)IRQn >= 0)
+        vPortHostEnableIrq((uint32_t)IRQn, 0);
+}
+
+__STATIC_INLINE void NVIC_SetPendingIRQ(IRQn_Type IRQn) {
+    if ((int32_t)IRQn >= 0)
+        vPortHostPendIrq((uint32_t)IRQn);
+}
+
+__STATIC_INLINE void NVIC_ClearPendingIRQ(IRQn_Type IRQn) {
+    if ((int32_t)IRQn >= 0)
+        vPortHostClearIrq((uint32_t)IRQn);
+}
+
+__STATIC_INLINE uint32_t NVIC_GetPendingIRQ(IRQn_Type IRQn) {
+    return (int32_t)IRQn >= 0 && xPortHostIrqPending((uint32_t)IRQn) ? 1U
+                                                                      : 0U;
+}
+
+__STATIC_INLINE void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority) {
+    carbon_host_nvic_set_priority(IRQn, priority);
+}
+
+__STATIC_INLINE uint32_t NVIC_GetPriority(IRQn_Type IRQn) {
+    return carbon_host_nvic_get_priority(IRQn);
+}
+
+__STATIC_INLINE void NVIC_SetPriorityGrouping(uint32_t PriorityGroup) {
+    (void)PriorityGroup;
+}
+
+__STATIC_INLINE uint32_t NVIC_GetPriorityGrouping(void) { return 0U; }
+
+__STATIC_INLINE uint32_t NVIC_EncodePriority(uint32_t PriorityGroup,
+                                             uint32_t PreemptPriority,
+                                             uint32_t SubPriority) {
+    (void)PriorityGroup;
+    (void)SubPriority;
+    return PreemptPriority;
+}
+
+__STATIC_INLINE void NVIC_SystemReset(void) { __builtin_trap(); }
+
+/*coherent host memory, the maintenance is a barrier*/
+__STATIC_INLINE void SCB_EnableICache(void) {}
+__STATIC_INLINE void SCB_DisableICache(void) {}
+__STATIC_INLINE void SCB_InvalidateICache(void) {}
+__STATIC_INLINE void SCB_EnableDCache(void) {}
+__STATIC_INLINE void SCB_DisableDCache(void) {}
+__STATIC_INLINE void SCB_InvalidateDCache(void) {}
+__STATIC_INLINE void SCB_CleanDCache(void) {}
+__STATIC_INLINE void SCB_CleanInvalidateDCache(void) {}
+
+__STATIC_INLINE void SCB_InvalidateDCache_by_Addr(void *addr, int32_t dsize) {
+    (void)addr;
+    (void)dsize;
+    __DSB();
+}
+
+__STATIC_INLINE void SCB_CleanDCache_by_Addr(uint32_t *addr, int32_t dsize) {
+    (void)addr;
+    (void)dsize;
+    __DSB();
+}
+
+__STATIC_INLINE void SCB_CleanInvalidateDCache_by_Addr(uint32_t *addr,
+                                                       int32_t dsize) {
+    (void)addr;
+    (void)dsize;
+    __DSB();
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CORE_CM7_H_GENERIC */
@@ -0,0 +1,89 @@
+/**
+ ******************************************************************************
+ * @file           cortex.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          core peripherals, RCC and HSEM of the host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <stm32h7xx_hal.h>
+
+#include <FreeRTOS.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+/*the CM7 clock of SystemClock_Config, the DWT counts at it*/
+uint32_t SystemCoreClock = 400000000;
+uint32_t SystemD2Clock = 200000000;
+
+CoreDebug_Type carbon_host_core_debug;
+
+static DWT_Type dwt;
+
+static uint8_t nvicPriority[portHOST_IRQ_LINES];
+
+DWT_Type *carbon_host_dwt(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    uint64_t ns = (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+    /*wraps as the 32 bit counter of the core*/
+    dwt.CYCCNT = (uint32_t)(ns * (SystemCoreClock / 1000000) / 1000);
+    return &dwt;
+}
+
+void carbon_host_nvic_set_priority(IRQn_Type IRQn, uint32_t priority) {
+    if ((int32_t)IRQn >= 0 && (uint32_t)IRQn < portHOST_IRQ_LINES)
+        nvicPriority[IRQn] = (uint8_t)priority;
+}
+
+uint32_t carbon_host_nvic_get_priority(IRQn_Type IRQn) {
+    if ((int32_t)IRQn >= 0 && (uint32_t)IRQn < portHOST_IRQ_LINES)
+        return nvicPriority[IRQn];
+    return 0;
+}
+
+static void mapWindow(uintptr_t start, uintptr_t end) {
+    uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t base = start & ~(page - 1);
+    end = (end + page - 1) & ~(page - 1);
+    void *window = mmap((void *)base, end - base, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1,
+                        0);
+    if (window != (void *)base) {
+        fprintf(stderr, "peripheral window at %p not mapped\n", (void *)base);
+        abort();
+    }
+}
+
+/*
+ * The registers the shared code touches at their address, as plain memory.
+ * TIM5 of the CM4 reads as stopped. The RCC enables the HSEM clock and the
+ * shared code takes the semaphores: without the CM4 a semaphore is always
+ * free, so each read lock register returns the CM7 as owner and a take in
+ * hsem.hpp succeeds at once; no release notification is ever raised.
+ */
+void carbon_host_peripherals_init(void) {
+    mapWindow(TIM5_BASE, TIM5_BASE + 0x400);
+    mapWindow(RCC_BASE, HSEM_BASE + 0x400);
+    for (uint32_t i = 0; i < sizeof(HSEM->RLR) / sizeof(HSEM->RLR[0]); i++)
+        HSEM->RLR[i] = HSEM_CR_COREID_CURRENT | HSEM_RLR_LOCK;
+}
+
+/*core/src/mp_port/cortex_m7_get_sp.s, the stack top of the MicroPython task*/
+uintptr_t cortex_m7_get_sp(void) {
+    return (uintptr_t)__builtin_frame_address(0);
+}
@@ -0,0 +1,222 @@
+/**
+ ******************************************************************************
+ * @file           ethernetif.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          lwIP interface of the host simulation on a tap device
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/common.hpp>
+#include <carbon/completion.hpp>
+#include <carbon/diag.hpp>
+#include <carbon/ethernetif.h>
+
+#include <cmsis_os.h>
+
+#include <lwip/ethip6.h>
+#include <lwip/opt.h>
+#include <lwip/tcpip.h>
+#include <lwip/timeouts.h>
+#include <netif/etharp.h>
+#include <netif/ethernet.h>
+
+#include <fcntl.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+/*
+ * CM7/core/src/ethernetif.c on a Linux tap device: the frames are read by a
+ * helper thread, the DMA of the MAC, into a ring and announced by the ETH
+ * interrupt, the input task is the one of the target. Without a tap device
+ * the link stays down, as with the cable unplugged.
+ */
+
+#define INTERFACE_THREAD_STACK_SIZE (350)
+#define IFNAME0 's'
+#define IFNAME1 't'
+#define RX_FRAMES 16
+#define FRAME_SIZE 1536
+
+static CarbonCompletion *rxPktDone = NULL; /* incoming packets */
+
+/* the interface thread, started once and never deleted */
+static StackType_t interfaceThreadStack[INTERFACE_THREAD_STACK_SIZE];
+static StaticTask_t interfaceThreadTcb;
+
+static int tapFd = -1;
+
+/*the receive descriptors, under rxMutex*/
+static uint8_t rxFrames[RX_FRAMES][FRAME_SIZE];
+static uint32_t rxLengths[RX_FRAMES];
+static uint32_t rxHead;
+static uint32_t rxTail;
+static uint32_t rxLost;
+static pthread_mutex_t rxMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint8_t txFrame[FRAME_SIZE];
+
+/*the DMA of the MAC, out of the kernel*/
+static void carbon_host_eth_rx_thread(void *argument) {
+    (void)argument;
+    static uint8_t frame[FRAME_SIZE];
+    while (1) {
+        ssize_t length = read(tapFd, frame, sizeof(frame));
+        if (length <= 0)
+            continue;
+        pthread_mutex_lock(&rxMutex);
+        if (rxHead - rxTail < RX_FRAMES) {
+            memcpy(rxFrames[rxHead % RX_FRAMES], frame, (size_t)length);
+            rxLengths[rxHead % RX_FRAMES] = (uint32_t)length;
+            rxHead++;
+        } else {
+            rxLost++;
+        }
+        pthread_mutex_unlock(&rxMutex);
+        NVIC_SetPendingIRQ(ETH_IRQn);
+    }
+}
+
+/*from main before the scheduler*/
+void carbon_host_eth_open(const char *name) {
+    if (name == NULL)
+        return;
+    tapFd = open("/dev/net/tun", O_RDWR);
+    if (tapFd < 0) {
+        RAW_DIAG(ETH_DIAG "no /dev/net/tun, link down");
+        return;
+    }
+    struct ifreq request;
+    memset(&request, 0, sizeof(request));
+    request.ifr_flags = IFF_TAP | IFF_NO_PI;
+    strncpy(request.ifr_name, name, IFNAMSIZ - 1);
+    if (ioctl(tapFd, TUNSETIFF, &request) < 0) {
+        RAW_DIAG(ETH_DIAG "tap %s not attached, link down", name);
+        close(tapFd);
+        tapFd = -1;
+        return;
+    }
+    xPortHostThreadCreate(carbon_host_eth_rx_thread, NULL);
+}
+
+CARBON_FAST_CODE void carbon_hw_ethernet_isr() {
+    carbon_completion_complete(rxPktDone);
+}
+
+static err_t carbon_lwip_output(struct netif *netif, struct pbuf *p) {
+    (void)netif;
+    if (tapFd < 0 || p->tot_len > sizeof(txFrame))
+        return ERR_IF;
+    /*under the lwIP core lock, one frame at the time*/
+    uint16_t length = pbuf_copy_partial(p, txFrame, p->tot_len, 0);
+    vPortHostEnterSyscall();
+    ssize_t written = write(tapFd, txFrame, length);
+    vPortHostExitSyscall();
+    return written == length ? ERR_OK : ERR_IF;
+}
+
+static struct pbuf *carbon_lwip_low_level_input(void) {
+    struct pbuf *p = NULL;
+    vPortHostEnterSyscall();
+    pthread_mutex_lock(&rxMutex);
+    if (rxHead != rxTail) {
+        uint32_t slot = rxTail % RX_FRAMES;
+        p = pbuf_alloc(PBUF_RAW, (u16_t)rxLengths[slot], PBUF_POOL);
+        if (p != NULL)
+            pbuf_take(p, rxFrames[slot], (u16_t)rxLengths[slot]);
+        else
+            rxLost++;
+        rxTail++;
+    }
+    pthread_mutex_unlock(&rxMutex);
+    vPortHostExitSyscall();
+    return p;
+}
+
+void carbon_lwip_input(const void *argument) {
+    struct pbuf *p;
+    struct netif *netif = (struct netif *)argument;
+
+    for (;;) {
+        if (!carbon_completion_wait(rxPktDone, osWaitForever))
+            continue;
+        while ((p = carbon_lwip_low_level_input()) != NULL) {
+            err_t err = netif->input(p, netif);
+            if (err == ERR_OK)
+                continue;
+            DIAG(ETH_DIAG "error %d pushing pbuf %p", err, p);
+            pbuf_free(p);
+        }
+    }
+}
+
+err_t carbon_lwip_init(struct netif *netif) {
+    LWIP_ASSERT("netif != NULL", (netif != NULL));
+
+#if LWIP_NETIF_HOSTNAME
+    netif->hostname = "lwip";
+#endif /* LWIP_NETIF_HOSTNAME */
+
+    netif->name[0] = IFNAME0;
+    netif->name[1] = IFNAME1;
+    netif->output = etharp_output;
+#if LWIP_IPV6
+    netif->output_ip6 = ethip6_output;
+#endif /* LWIP_IPV6 */
+    netif->linkoutput = carbon_lwip_output;
+
+    /*the MAC address of the board*/
+    netif->hwaddr_len = ETH_HWADDR_LEN;
+    netif->hwaddr[0] = 0x00;
+    netif->hwaddr[1] = 0x80;
+    netif->hwaddr[2] = 0xE1;
+    netif->hwaddr[3] = 0x00;
+    netif->hwaddr[4] = 0x00;
+    netif->hwaddr[5] = 0x00;
+    netif->mtu = ETH_MAX_PAYLOAD;
+    netif->flags |= NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP;
+
+    rxPktDone = carbon_completion_create("eth rx", CARBON_LATENCY_ETH);
+
+    osThreadStaticDef(EthIf, carbon_lwip_input, osPriorityRealtime, 0,
+                      INTERFACE_THREAD_STACK_SIZE, interfaceThreadStack,
+                      &interfaceThreadTcb);
+    osThreadCreate(osThread(EthIf), netif);
+
+    netif_set_link_down(netif);
+    netif_set_down(netif);
+    if (tapFd >= 0)
+        NVIC_EnableIRQ(ETH_IRQn);
+
+    return ERR_OK;
+}
+
+/*the tap is always connected, full duplex*/
+void carbon_lwip_link_thread(void const *argument) {
+    struct netif *netif = (struct netif *)argument;
+
+    if (tapFd >= 0) {
+        DIAG(ETH_DIAG "tap link up");
+        netif_set_up(netif);
+        netif_set_link_up(netif);
+    }
+    for (;;)
+        osDelay(1000);
+}
+
+u32_t sys_jiffies(void) { return HAL_GetTick(); }
+
+u32_t sys_now(void) { return HAL_GetTick(); }
@@ -0,0 +1,109 @@
+/**
+ ******************************************************************************
+ * @file           hal.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          HAL and BSP functions of the host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/diag.hpp>
+#include <carbon/pin.hpp>
+#include <carbon/rand.hpp>
+
+#include <stm32h7xx_hal.h>
+
+#include <FreeRTOS.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/random.h>
+#include <unistd.h>
+
+/*
+ * The few HAL functions the application calls out of the drivers: the UART
+ * of the diag is the standard output, the LEDs are state printed at change,
+ * the RNG is the one of the kernel.
+ */
+
+UART_HandleTypeDef huart1;
+
+static uint32_t ledState[LEDn];
+static const char *const ledNames[LEDn] = {"green", "orange", "red", "blue"};
+
+uint32_t HAL_GetHalVersion(void) {
+    return (1UL << 24) | (11UL << 16) | (0UL << 8);
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart,
+                                    const uint8_t *pData, uint16_t Size,
+                                    uint32_t Timeout) {
+    (void)huart;
+    (void)Timeout;
+    vPortHostEnterSyscall();
+    ssize_t written = write(STDOUT_FILENO, pData, Size);
+    vPortHostExitSyscall();
+    return written == Size ? HAL_OK : HAL_ERROR;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority,
+                          uint32_t SubPriority) {
+    (void)SubPriority;
+    NVIC_SetPriority(IRQn, PreemptPriority);
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn) { NVIC_EnableIRQ(IRQn); }
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn) { NVIC_DisableIRQ(IRQn); }
+
+int32_t BSP_LED_Init(Led_TypeDef Led) {
+    if (Led >= LEDn)
+        return -1;
+    ledState[Led] = 0;
+    return 0;
+}
+
+int32_t BSP_LED_DeInit(Led_TypeDef Led) { return BSP_LED_Init(Led); }
+
+static int32_t ledSet(Led_TypeDef Led, uint32_t state) {
+    if (Led >= LEDn)
+        return -1;
+    ledState[Led] = state;
+    if (getenv("CARBON_HOST_LEDS") != NULL)
+        DIAG(SYSTEM_DIAG "LED %s %s", ledNames[Led], state ? "on" : "off");
+    return 0;
+}
+
+int32_t BSP_LED_On(Led_TypeDef Led) { return ledSet(Led, 1); }
+
+int32_t BSP_LED_Off(Led_TypeDef Led) { return ledSet(Led, 0); }
+
+int32_t BSP_LED_Toggle(Led_TypeDef Led) {
+    if (Led >= LEDn)
+        return -1;
+    return ledSet(Led, ledState[Led] ^ 1U);
+}
+
+int32_t BSP_LED_GetState(Led_TypeDef Led) {
+    return Led < LEDn ? (int32_t)ledState[Led] : -1;
+}
+
+void carbon_rand_init(void) {}
+
+uint32_t carbon_rand(void) {
+    uint32_t value = 0;
+    vPortHostEnterSyscall();
+    if (getrandom(&value, sizeof(value), 0) != sizeof(value))
+        RAW_DIAG("error for random generator");
+    vPortHostExitSyscall();
+    return value;
+}
@@ -0,0 +1,68 @@
+/**
+ ******************************************************************************
+ * @file           interrupts.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          interrupt handlers of the host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/common.hpp>
+#include <carbon/completion.hpp>
+#include <carbon/diag.hpp>
+#include <carbon/latency.hpp>
+#include <carbon/sd_card.hpp>
+
+#include <stm32h7xx_hal.h>
+
+#include <cmsis_os.h>
+
+/*
+ * The handlers of CM7/core/src/interrupts.c for the peripherals the host
+ * simulates, installed on the interrupt lines of the FreeRTOS POSIX port in
+ * place of the vector table. The faults are signals of the process.
+ */
+
+void carbon_hw_us_systime_tim_isr(void);
+void carbon_hw_ethernet_isr(void);
+void hsem_isr(void);
+
+CARBON_FAST_CODE void TIM2_IRQHandler(void) {
+    uint32_t stamp = carbon_latency_enter(CARBON_LATENCY_SYSTIME);
+    carbon_hw_us_systime_tim_isr();
+    carbon_latency_exit(CARBON_LATENCY_SYSTIME, stamp);
+}
+
+void HSEM1_IRQHandler(void) { hsem_isr(); }
+
+CARBON_FAST_CODE void ETH_IRQHandler(void) {
+    uint32_t stamp = carbon_latency_enter(CARBON_LATENCY_ETH);
+    carbon_hw_ethernet_isr();
+    carbon_latency_exit(CARBON_LATENCY_ETH, stamp);
+}
+
+CARBON_FAST_CODE void SDMMC1_IRQHandler(void) {
+    uint32_t stamp = carbon_latency_enter(CARBON_LATENCY_SDMMC);
+    BSP_SD_IRQHandler(0);
+    carbon_latency_exit(CARBON_LATENCY_SDMMC, stamp);
+}
+
+/*unused on the board as on the host: software triggered*/
+void CRS_IRQHandler(void) { carbon_completion_benchmark_isr(); }
+
+void carbon_host_irq_init(void) {
+    vPortHostSetIrqHandler(TIM2_IRQn, TIM2_IRQHandler);
+    vPortHostSetIrqHandler(HSEM1_IRQn, HSEM1_IRQHandler);
+    vPortHostSetIrqHandler(ETH_IRQn, ETH_IRQHandler);
+    vPortHostSetIrqHandler(SDMMC1_IRQn, SDMMC1_IRQHandler);
+    vPortHostSetIrqHandler(CRS_IRQn, CRS_IRQHandler);
+}
@@ -0,0 +1,150 @@
+/**
+ ******************************************************************************
+ * @file           main.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          entry point of the host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/boot.hpp>
+#include <carbon/diag.hpp>
+#include <carbon/heap.hpp>
+#include <carbon/hsem.hpp>
+#include <carbon/main_thread.hpp>
+#include <carbon/pin.hpp>
+#include <carbon/rand.hpp>
+#include <carbon/registry.hpp>
+#include <carbon/shared_memory.hpp>
+#include <carbon/systime.hpp>
+#include <carbon/timebase.hpp>
+
+#include <stm32h7xx_hal.h>
+
+#include <printf.h>
+
+#include <cstdio>
+#include <cstring>
+#include <sys/mman.h>
+
+/*
+ * low_level_init() and main() of the CM7 without the clocks, the SDRAM, the
+ * CM4 and the MDMA: the peripherals the application finds at boot are the
+ * simulated ones of host/src, the SD card an image file and the Ethernet a
+ * tap device, both optional.
+ *   CARBON_HOST [--sd image] [--tap name]
+ */
+
+using namespace CARBON;
+
+static MainThread mainThread;
+
+extern "C" {
+
+extern uint8_t _smp_exec;
+extern uint8_t _emp_exec;
+
+void carbon_host_peripherals_init(void);
+void carbon_host_irq_init(void);
+void carbon_host_sd_open(const char *path);
+void carbon_host_eth_open(const char *name);
+}
+
+static void usage(const char *name) {
+    std::fprintf(stderr, "usage: %s [--sd image] [--tap name]\n", name);
+}
+
+static void low_level_init(const char *sdImage, const char *tapName) {
+    carbon_host_peripherals_init();
+
+    bootStart();
+
+    /*the area of the MicroPython native emitters, executable as on target*/
+    if (mprotect(&_smp_exec, static_cast<size_t>(&_emp_exec - &_smp_exec),
+                 PROT_READ | PROT_WRITE | PROT_EXEC) != 0) {
+        std::fprintf(stderr, "MicroPython exec area not executable\n");
+    }
+
+    hsemInit();
+
+    low_level_system_time();
+
+    bootClockStarted();
+
+    printf_("\r\n\nBooting\r\n");
+
+    heapInit();
+
+    bootMark("heap");
+
+    carbon_rand_init();
+
+    BSP_LED_Init(LED_GREEN);
+    BSP_LED_Init(LED_ORANGE);
+    BSP_LED_Init(LED_BLUE);
+    BSP_LED_Init(LED_RED);
+
+    FIFO_INIT(diag)
+
+    bootMark("diag FIFO");
+
+#ifdef FREERTOS_USE_TRACE
+    FIFO_INIT(trace)
+
+    bootMark("trace FIFO");
+#endif
+
+    timebaseInit();
+
+    bootMark("time base");
+
+    registryInit();
+
+    bootMark("registry");
+
+    carbon_host_irq_init();
+    carbon_host_sd_open(sdImage);
+    carbon_host_eth_open(tapName);
+
+    bootMark("periphery sync");
+
+    setSyncFlag(SyncFlagBit::PeripherySync);
+}
+
+int main(int argc, char *argv[]) {
+    const char *sdImage = nullptr;
+    const char *tapName = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--sd") == 0 && i + 1 < argc) {
+            sdImage = argv[++i];
+        } else if (std::strcmp(argv[i], "--tap") == 0 && i + 1 < argc) {
+            tapName = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    low_level_init(sdImage, tapName);
+
+    RAW_DIAG(SYSTEM_DIAG "CM7 ready");
+
+    mainThread.start();
+
+    RAW_DIAG(SYSTEM_DIAG "starting OS");
+
+    osKernelStart();
+
+    RAW_DIAG(SYSTEM_DIAG "ERROR OS");
+
+    return 1;
+}
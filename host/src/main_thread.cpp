@@ -0,0 +1,116 @@
+/**
+ ******************************************************************************
+ * @file           main_thread.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          main thread of the host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/boot.hpp>
+#include <carbon/completion.hpp>
+#include <carbon/diag_thread.hpp>
+#include <carbon/ftp_thread.hpp>
+#include <carbon/latency.hpp>
+#include <carbon/main_thread.hpp>
+#include <carbon/mp_thread.h>
+#include <carbon/net_bench_thread.hpp>
+#include <carbon/pin.hpp>
+#include <carbon/sd_card.hpp>
+#include <carbon/sd_thread.hpp>
+#include <carbon/timebase.hpp>
+#include <carbon/trace_thread.hpp>
+
+#include <cmsis_os.h>
+
+/*
+ * CM7/core/src/main_thread.cpp without the display, the CM4 mailbox, the
+ * offload and the MDMA benchmark, which have no host counterpart.
+ */
+
+static DiagThread diagThread;
+#ifdef FREERTOS_USE_TRACE
+static TraceThread traceThread;
+#endif
+static SDThread sdThread;
+static FTPThread ftpThread;
+static NetBenchThread netBenchThread;
+
+static constexpr uint32_t STACK_REPORT_PERIOD = 60; /*main loop periods*/
+static constexpr uint32_t SD_MOUNT_TIMEOUT = 3000; /*ms*/
+/*tcpip_init and the PHY, the FatFs file object*/
+static constexpr uint32_t NETWORK_STACK = configMINIMAL_STACK_SIZE * 8;
+static constexpr uint32_t SCRIPT_STACK = configMINIMAL_STACK_SIZE * 8;
+
+extern "C" {
+void netif_config(void);
+}
+
+static void startSD() {
+    sdThread.start();
+    /*without a card the services start anyway, the mount comes later*/
+    if (BSP_SD_IsDetected(0) != SD_PRESENT) {
+        DIAG(SYSTEM_DIAG "no SD card, not waiting for the mount");
+        return;
+    }
+    if (!sdThread.waitMounted(SD_MOUNT_TIMEOUT))
+        DIAG(SYSTEM_DIAG "SD card not mounted in %lu ms", SD_MOUNT_TIMEOUT);
+}
+
+MainThread::MainThread() : StaticThread("main_thread", osPriorityNormal) {}
+
+void MainThread::run() {
+    diagThread.start();
+
+    /*independent subsystems come up together, the services after them*/
+    static CARBON::BootScheduler scheduler;
+    auto network = scheduler.add("network", netif_config, 0, NETWORK_STACK);
+    auto sd = scheduler.add("sd", startSD);
+    auto micropython = scheduler.add("micropython", micropython_init);
+#ifdef FREERTOS_USE_TRACE
+    scheduler.add("trace", [] { traceThread.start(); }, network);
+#endif
+    scheduler.add("ftp", [] { ftpThread.start(); }, network | sd);
+    scheduler.add("netbench", [] { netBenchThread.start(); }, network);
+    scheduler.add("script", micropython_run, network | sd | micropython,
+                  SCRIPT_STACK);
+    scheduler.run();
+
+    CARBON::bootMark("ready");
+    CARBON::bootDump();
+    for (uint32_t i = 0; i < scheduler.steps(); i++) {
+        auto timing = scheduler.timing(i);
+        DIAG(BOOT_DIAG "step %s %lu us to %lu us", timing.name,
+             static_cast<uint32_t>(timing.startUs),
+             static_cast<uint32_t>(timing.endUs));
+    }
+
+
+    uint32_t loops = 0;
+    while (1) {
+        BSP_LED_Toggle(LED_GREEN);
+        CARBON::timebasePublish();
+#ifdef FREERTOS_USE_TRACE
+        CARBON::latencyPublish();
+#endif
+        if (++loops % STACK_REPORT_PERIOD == 0) {
+            StaticThreadBase::report();
+            auto masked = CARBON::IRQ::getMaskStats();
+            DIAG(SYSTEM_DIAG "longest masked window %lu cycles at %p, %lu "
+                             "critical sections",
+                 masked.maxCycles, reinterpret_cast<void *>(masked.maxSite),
+                 masked.sections);
+            CARBON::Completion::report();
+        }
+        osDelay(1000);
+    }
+}
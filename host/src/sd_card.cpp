@@ -0,0 +1,304 @@
+/**
+ ******************************************************************************
+ * @file           sd_card.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          SD card of the host simulation on an image file
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/completion.hpp>
+#include <carbon/diag.hpp>
+#include <carbon/registry.hpp>
+#include <carbon/sd_card.hpp>
+
+#include <cmsis_os.h>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * The BSP of CM7/core/src/sd_card.cpp on a raw image: the DMA transfers are
+ * done by a helper thread, the SDMMC1 interrupt completes them as on target,
+ * so FatFs, the SD thread and the latency of the completions are the real
+ * ones. The polling transfers read and write the image directly.
+ */
+
+#define BLOCK_SIZE 512U
+
+#define DMA_TIMEOUT 10000UL
+
+SD_HandleTypeDef hsd_sdmmc[SD_INSTANCES_NBR];
+EXTI_HandleTypeDef hsd_exti[SD_INSTANCES_NBR];
+
+static CARBON::Completion dmaTxDone("sd tx", CARBON_LATENCY_SDMMC);
+static CARBON::Completion dmaRxDone("sd rx", CARBON_LATENCY_SDMMC);
+
+static CARBON::RegistrySdCard sdStats{};
+
+struct SdRequest {
+    bool pending;
+    bool busy;
+    bool write;
+    bool failed;
+    uint8_t *data;
+    uint32_t block;
+    uint32_t blocks;
+};
+
+static int imageFd = -1;
+static uint32_t imageBlocks;
+
+static pthread_mutex_t requestMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t requestCond = PTHREAD_COND_INITIALIZER;
+static SdRequest request;
+
+static void sd_publish_stats(int32_t ret, uint32_t blocks, bool write) {
+    auto present = BSP_SD_IsDetected(0) == SD_PRESENT ? 1UL : 0UL;
+    CARBON::IRQ::lockRecursive();
+    if (ret != BSP_ERROR_NONE)
+        sdStats.errors++;
+    else if (write)
+        sdStats.writtenBlocks += blocks;
+    else
+        sdStats.readBlocks += blocks;
+    sdStats.present = present;
+    auto stats = sdStats;
+    CARBON::IRQ::unLockRecursive();
+    CARBON::registryPublish<CARBON::RegistryId::SdCard>(stats);
+}
+
+static bool transfer(bool write, uint8_t *data, uint32_t block,
+                     uint32_t blocks) {
+    if (imageFd < 0 || block + blocks > imageBlocks)
+        return false;
+    auto size = static_cast<size_t>(blocks) * BLOCK_SIZE;
+    auto offset = static_cast<off_t>(block) * BLOCK_SIZE;
+    auto done = write ? pwrite(imageFd, data, size, offset)
+                      : pread(imageFd, data, size, offset);
+    return done == static_cast<ssize_t>(size);
+}
+
+/*the DMA of the SDMMC, out of the kernel*/
+static void sdmmcThread(void *) {
+    while (1) {
+        pthread_mutex_lock(&requestMutex);
+        while (!request.pending)
+            pthread_cond_wait(&requestCond, &requestMutex);
+        SdRequest current = request;
+        pthread_mutex_unlock(&requestMutex);
+
+        bool ok = transfer(current.write, current.data, current.block,
+                           current.blocks);
+
+        pthread_mutex_lock(&requestMutex);
+        request.failed = !ok;
+        request.pending = false;
+        pthread_mutex_unlock(&requestMutex);
+        NVIC_SetPendingIRQ(SDMMC1_IRQn);
+    }
+}
+
+static int32_t transferDMA(bool write, uint32_t *pData, uint32_t BlockIdx,
+                           uint32_t BlocksNbr) {
+    auto &done = write ? dmaTxDone : dmaRxDone;
+    done.reset();
+
+    vPortHostEnterSyscall();
+    pthread_mutex_lock(&requestMutex);
+    request.pending = true;
+    request.busy = true;
+    request.write = write;
+    request.data = reinterpret_cast<uint8_t *>(pData);
+    request.block = BlockIdx;
+    request.blocks = BlocksNbr;
+    pthread_cond_signal(&requestCond);
+    pthread_mutex_unlock(&requestMutex);
+    vPortHostExitSyscall();
+
+    int32_t ret = BSP_ERROR_NONE;
+    if (!done.wait(DMA_TIMEOUT)) {
+        DIAG(SD "time out waiting %s DMA", write ? "TX" : "RX");
+        ret = BSP_ERROR_PERIPH_FAILURE;
+    } else if (request.failed) {
+        DIAG(SD "error %s SD, block %lu", write ? "writing" : "reading",
+             BlockIdx);
+        ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    sd_publish_stats(ret, BlocksNbr, write);
+    return ret;
+}
+
+extern "C" {
+
+/*from main before the scheduler, a missing image is a missing card*/
+void carbon_host_sd_open(const char *path) {
+    if (path == nullptr)
+        return;
+    imageFd = open(path, O_RDWR);
+    struct stat info;
+    if (imageFd < 0 || fstat(imageFd, &info) != 0) {
+        RAW_DIAG(SD "SD image %s not opened", path);
+        imageFd = -1;
+        return;
+    }
+    imageBlocks = static_cast<uint32_t>(info.st_size / BLOCK_SIZE);
+    xPortHostThreadCreate(sdmmcThread, nullptr);
+}
+
+int32_t BSP_SD_Init(uint32_t Instance) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    if (imageFd < 0)
+        return BSP_ERROR_PERIPH_FAILURE;
+    NVIC_EnableIRQ(SDMMC1_IRQn);
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_SD_DeInit(uint32_t Instance) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    NVIC_DisableIRQ(SDMMC1_IRQn);
+    return BSP_ERROR_NONE;
+}
+
+/*an image is never removed*/
+int32_t BSP_SD_DetectITConfig(uint32_t Instance) {
+    return Instance >= SD_INSTANCES_NBR ? BSP_ERROR_WRONG_PARAM
+                                        : BSP_ERROR_NONE;
+}
+
+int32_t BSP_SD_Init_Detect_Notify(uint32_t Instance) {
+    return BSP_SD_DetectITConfig(Instance);
+}
+
+void BSP_SD_DetectCallback(uint32_t) {}
+
+int32_t BSP_SD_IsDetected(uint32_t Instance) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    return imageFd >= 0 ? static_cast<int32_t>(SD_PRESENT)
+                        : static_cast<int32_t>(SD_NOT_PRESENT);
+}
+
+int32_t BSP_SD_ReadBlocks(uint32_t Instance, uint32_t *pData, uint32_t BlockIdx,
+                          uint32_t BlocksNbr) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    vPortHostEnterSyscall();
+    bool ok = transfer(false, reinterpret_cast<uint8_t *>(pData), BlockIdx,
+                       BlocksNbr);
+    vPortHostExitSyscall();
+    int32_t ret = ok ? BSP_ERROR_NONE : BSP_ERROR_PERIPH_FAILURE;
+    sd_publish_stats(ret, BlocksNbr, false);
+    return ret;
+}
+
+int32_t BSP_SD_WriteBlocks(uint32_t Instance, uint32_t *pData,
+                           uint32_t BlockIdx, uint32_t BlocksNbr) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    vPortHostEnterSyscall();
+    bool ok = transfer(true, reinterpret_cast<uint8_t *>(pData), BlockIdx,
+                       BlocksNbr);
+    vPortHostExitSyscall();
+    int32_t ret = ok ? BSP_ERROR_NONE : BSP_ERROR_PERIPH_FAILURE;
+    sd_publish_stats(ret, BlocksNbr, true);
+    return ret;
+}
+
+int32_t BSP_SD_ReadBlocks_DMA(uint32_t Instance, uint32_t *pData,
+                              uint32_t BlockIdx, uint32_t BlocksNbr) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    return transferDMA(false, pData, BlockIdx, BlocksNbr);
+}
+
+int32_t BSP_SD_WriteBlocks_DMA(uint32_t Instance, uint32_t *pData,
+                               uint32_t BlockIdx, uint32_t BlocksNbr) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    return transferDMA(true, pData, BlockIdx, BlocksNbr);
+}
+
+int32_t BSP_SD_ReadBlocks_IT(uint32_t Instance, uint32_t *pData,
+                             uint32_t BlockIdx, uint32_t BlocksNbr) {
+    return BSP_SD_ReadBlocks_DMA(Instance, pData, BlockIdx, BlocksNbr);
+}
+
+int32_t BSP_SD_WriteBlocks_IT(uint32_t Instance, uint32_t *pData,
+                              uint32_t BlockIdx, uint32_t BlocksNbr) {
+    return BSP_SD_WriteBlocks_DMA(Instance, pData, BlockIdx, BlocksNbr);
+}
+
+int32_t BSP_SD_Erase(uint32_t Instance, uint32_t BlockIdx, uint32_t BlocksNbr) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    if (imageFd < 0 || BlockIdx + BlocksNbr > imageBlocks)
+        return BSP_ERROR_PERIPH_FAILURE;
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_SD_GetCardState(uint32_t Instance) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    return request.busy ? SD_TRANSFER_BUSY : SD_TRANSFER_OK;
+}
+
+int32_t BSP_SD_GetCardInfo(uint32_t Instance, BSP_SD_CardInfo *CardInfo) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    if (imageFd < 0)
+        return BSP_ERROR_PERIPH_FAILURE;
+    *CardInfo = {};
+    CardInfo->CardType = CARD_SDHC_SDXC;
+    CardInfo->CardVersion = CARD_V2_X;
+    CardInfo->Class = 0x5b5;
+    CardInfo->BlockNbr = imageBlocks;
+    CardInfo->BlockSize = BLOCK_SIZE;
+    CardInfo->LogBlockNbr = imageBlocks;
+    CardInfo->LogBlockSize = BLOCK_SIZE;
+    CardInfo->CardSpeed = CARD_HIGH_SPEED;
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_SD_GetCardCID(uint32_t Instance, BSP_SD_CardCID *CardCID) {
+    if (Instance >= SD_INSTANCES_NBR)
+        return BSP_ERROR_WRONG_PARAM;
+    if (imageFd < 0)
+        return BSP_ERROR_PERIPH_FAILURE;
+    *CardCID = {};
+    return BSP_ERROR_NONE;
+}
+
+void BSP_SD_DETECT_IRQHandler(uint32_t) {}
+
+/*the transfer of the helper thread is over*/
+CARBON_FAST_CODE void BSP_SD_IRQHandler(uint32_t Instance) {
+    if (Instance >= SD_INSTANCES_NBR || request.pending || !request.busy)
+        return;
+    request.busy = false;
+    if (request.write)
+        BSP_SD_WriteCpltCallback(Instance);
+    else
+        BSP_SD_ReadCpltCallback(Instance);
+}
+
+__weak void BSP_SD_AbortCallback(uint32_t) {}
+
+__weak void BSP_SD_WriteCpltCallback(uint32_t) { dmaTxDone.complete(); }
+
+__weak void BSP_SD_ReadCpltCallback(uint32_t) { dmaRxDone.complete(); }
+
+} // extern "C"
@@ -0,0 +1,81 @@
+/**
+ ******************************************************************************
+ * @file           syscalls.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          C library allocator of the host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <FreeRTOS.h>
+
+#include <errno.h>
+#include <stddef.h>
+
+/*
+ * On the board the newlib heap is empty, on the host the C library allocates
+ * for the threads, the timers and the stdio of the port: its lock must not be
+ * held by a task switched out, so the allocator runs with the kernel
+ * interrupts masked, as any other call into the host.
+ */
+
+void *__libc_malloc(size_t size);
+void __libc_free(void *ptr);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+
+void *malloc(size_t size) {
+    vPortHostEnterSyscall();
+    void *ptr = __libc_malloc(size);
+    vPortHostExitSyscall();
+    return ptr;
+}
+
+void free(void *ptr) {
+    vPortHostEnterSyscall();
+    __libc_free(ptr);
+    vPortHostExitSyscall();
+}
+
+void *calloc(size_t count, size_t size) {
+    vPortHostEnterSyscall();
+    void *ptr = __libc_calloc(count, size);
+    vPortHostExitSyscall();
+    return ptr;
+}
+
+void *realloc(void *ptr, size_t size) {
+    vPortHostEnterSyscall();
+    void *result = __libc_realloc(ptr, size);
+    vPortHostExitSyscall();
+    return result;
+}
+
+void *memalign(size_t alignment, size_t size) {
+    vPortHostEnterSyscall();
+    void *ptr = __libc_memalign(alignment, size);
+    vPortHostExitSyscall();
+    return ptr;
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+    return memalign(alignment, size);
+}
+
+int posix_memalign(void **ptr, size_t alignment, size_t size) {
+    void *result = memalign(alignment, size);
+    if (result == NULL)
+        return ENOMEM;
+    *ptr = result;
+    return 0;
+}
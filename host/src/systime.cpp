@@ -0,0 +1,187 @@
+/**
+ ******************************************************************************
+ * @file           systime.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          microsecond time of the host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/common.hpp>
+#include <carbon/latency.hpp>
+#include <carbon/systime.hpp>
+
+#include <FreeRTOS.h>
+
+#include <cerrno>
+#include <pthread.h>
+#include <time.h>
+
+/*
+ * common/src/systime.cpp with the monotonic clock as TIM2: the microseconds
+ * since low_level_system_time(). The compare channels of the probe and of the
+ * sampler are a helper thread sleeping until the next match, which pends the
+ * TIM2 interrupt; the matches are absolute, the probe measures the delay of
+ * the simulated interrupt entry.
+ */
+
+using namespace CARBON;
+
+static constexpr uint32_t CHANNEL_PROBE = 1U << 0;
+static constexpr uint32_t CHANNEL_SAMPLER = 1U << 1;
+
+static uint64_t startUs;
+static bool timRunning;
+
+static pthread_mutex_t timMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t timCond;
+
+/*the compare registers, under timMutex*/
+static uint32_t probePeriod;
+static uint64_t probeMatch;
+static uint32_t samplerPeriod;
+static uint64_t samplerMatch;
+static void (*volatile samplerCallback)(void);
+
+/*the status register*/
+static volatile uint32_t timStatus;
+
+static uint64_t nowUs() { return ullPortHostTimeUs() - startUs; }
+
+static timespec absolute(uint64_t us) {
+    us += startUs;
+    return timespec{static_cast<time_t>(us / 1000000),
+                    static_cast<long>(us % 1000000) * 1000};
+}
+
+static void timThread(void *) {
+    pthread_mutex_lock(&timMutex);
+    while (1) {
+        uint64_t match = UINT64_MAX;
+        if (probePeriod != 0)
+            match = probeMatch;
+        if (samplerPeriod != 0 && samplerMatch < match)
+            match = samplerMatch;
+        if (match == UINT64_MAX) {
+            pthread_cond_wait(&timCond, &timMutex);
+            continue;
+        }
+        auto deadline = absolute(match);
+        if (pthread_cond_timedwait(&timCond, &timMutex, &deadline) !=
+            ETIMEDOUT)
+            continue;
+        auto now = nowUs();
+        uint32_t status = 0;
+        if (probePeriod != 0 && probeMatch <= now) {
+            /*a late match is counted once, as the compare register*/
+            while (probeMatch <= now)
+                probeMatch += probePeriod;
+            status |= CHANNEL_PROBE;
+        }
+        if (samplerPeriod != 0 && samplerMatch <= now) {
+            while (samplerMatch <= now)
+                samplerMatch += samplerPeriod;
+            status |= CHANNEL_SAMPLER;
+        }
+        if (status != 0) {
+            __atomic_fetch_or(&timStatus, status, __ATOMIC_SEQ_CST);
+            NVIC_SetPendingIRQ(TIM2_IRQn);
+        }
+    }
+}
+
+void low_level_system_time() {
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    DWT_Type *dwt = DWT;
+    SET_BIT(dwt->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    pthread_cond_init(&timCond, &attributes);
+    pthread_condattr_destroy(&attributes);
+
+    startUs = ullPortHostTimeUs();
+    xPortHostThreadCreate(timThread, nullptr);
+    timRunning = true;
+
+    NVIC_EnableIRQ(TIM2_IRQn);
+}
+
+CARBON_FAST_CODE uint64_t systimeUs() { return timRunning ? nowUs() : 0; }
+
+void delayUs(uint32_t us) {
+    auto end = nowUs() + us;
+    while (nowUs() < end) {
+    }
+}
+
+void systimeProbe(uint32_t periodUs) {
+    vPortHostEnterSyscall();
+    pthread_mutex_lock(&timMutex);
+    probePeriod = periodUs;
+    if (periodUs != 0) {
+        latencyProbeStart(periodUs);
+        probeMatch = nowUs() + periodUs;
+    }
+    pthread_cond_signal(&timCond);
+    pthread_mutex_unlock(&timMutex);
+    vPortHostExitSyscall();
+}
+
+void systimeSampler(uint32_t periodUs, void (*callback)(void)) {
+    vPortHostEnterSyscall();
+    pthread_mutex_lock(&timMutex);
+    samplerPeriod = callback != nullptr ? periodUs : 0;
+    samplerCallback = callback;
+    if (samplerPeriod != 0)
+        samplerMatch = nowUs() + periodUs;
+    pthread_cond_signal(&timCond);
+    pthread_mutex_unlock(&timMutex);
+    vPortHostExitSyscall();
+}
+
+extern "C" {
+
+CARBON_FAST_CODE void carbon_hw_us_systime_tim_isr() {
+    auto status = __atomic_exchange_n(&timStatus, 0, __ATOMIC_SEQ_CST);
+    if ((status & CHANNEL_PROBE) != 0 && probePeriod != 0)
+        latencyProbeTick(carbon_latency_entry_stamp[CARBON_LATENCY_SYSTIME]);
+    auto callback = samplerCallback;
+    if ((status & CHANNEL_SAMPLER) != 0 && callback != nullptr)
+        callback();
+}
+
+/***** HAL Tick *****/
+
+HAL_StatusTypeDef HAL_InitTick(uint32_t /*TickPriority*/) { return HAL_OK; }
+
+void HAL_IncTick() {}
+
+uint32_t HAL_GetTick() { return static_cast<uint32_t>(systimeUs() / 1000); }
+
+void HAL_Delay(uint32_t delay) { delayUs(delay * 1000); }
+
+void HAL_SuspendTick() {}
+
+void HAL_ResumeTick() {}
+
+/***** RTOS Runtime Stats *****/
+
+void carbon_conf_timer_runtime_stats() {}
+
+uint32_t carbon_time_counter_value() {
+    // Wraps, see common/src/systime.cpp
+    return static_cast<uint32_t>(systimeUs());
+}
+
+} // extern "C"
@@ -41,64 +41,56 @@ __weak void ftp_disconnected_callback(void) {}
 
 // static variables
 static const char *no_conn_allowed = "421 No more connections allowed\r\n";
-// static server_stru_t ftp_links[FTP_NBR_CLIENTS];
-#if FTP_TASK_STATIC == 1
-static TaskHandle_t task_handle;
-#else
-static BaseType_t task_handle;
-#endif
+static server_stru_t ftp_links[FTP_NBR_CLIENTS];
 
-LWIP_MEMPOOL_DECLARE(ftp_client_pool, 5, sizeof(server_stru_t),
-                     "FTP connection pool");
-
-// single ftp connection loop
+// connection loop of a client slot, the task is never deleted
 static void ftp_task(void *param) {
-    // sanity check
-    if (param == NULL)
-        return;
-
     // parse parameter
     server_stru_t *ftp = (server_stru_t *)param;
 
     // save the instance number
     ftp->ftp_data.ftp_con_num = ftp->number;
 
-    // callback
-    ftp_connected_callback();
+    while (1) {
+        // wait for the server to hand over a connection
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (ftp->ftp_connection == NULL)
+            continue;
 
-    // feedback
-    DIAG(FTP "FTP %d connected", ftp->number);
+        // callback
+        ftp_connected_callback();
 
-    // service FTP server
-    ftp_service(ftp->ftp_connection, &ftp->ftp_data);
+        // feedback
+        DIAG(FTP "FTP %d connected", ftp->number);
 
-    // close the connection
-    netconn_close(ftp->ftp_connection);
+        // service FTP server
+        ftp_service(ftp->ftp_connection, &ftp->ftp_data);
 
-    // delete the connection.
-    netconn_delete(ftp->ftp_connection);
+        // close the connection
+        netconn_close(ftp->ftp_connection);
 
-    // reset the socket to be sure
-    ftp->ftp_connection = NULL;
-
-    // feedback
-    DIAG(FTP "FTP %d disconnected", ftp->number);
+        // delete the connection.
+        netconn_delete(ftp->ftp_connection);
 
-    // callback
-    ftp_disconnected_callback();
+        // reset the socket to be sure
+        ftp->ftp_connection = NULL;
 
-    // clear handle
-    ftp->task_handle = NULL;
+        // feedback
+        DIAG(FTP "FTP %d disconnected", ftp->number);
 
-    LWIP_MEMPOOL_FREE(ftp_client_pool, ftp);
+        // callback
+        ftp_disconnected_callback();
 
-    // delete this task
-    vTaskDelete(NULL);
+        // the slot can take the next connection
+        ftp->busy = false;
+    }
 }
 
-static void ftp_start_task(server_stru_t *data, uint8_t index) {
+static bool ftp_start_task(server_stru_t *data, uint8_t index) {
     // set number
     data->number = index;
+    data->ftp_connection = NULL;
+    data->busy = false;
 
     // change name
     char name[12] = {0};
@@ -106,45 +98,40 @@ static void ftp_start_task(server_stru_t *data, uint8_t index) {
 
     // start task with parameter
 #if FTP_TASK_STATIC == 1
-    task_handle = xTaskCreateStatic(ftp_task, name, FTP_TASK_STACK_SIZE, data,
-                                    5, data->task_stack, &data->task_static);
-    if (task_handle == NULL) {
-        // if creation of the task fails, close and clean up the connection
-        netconn_close(data->ftp_connection);
-        netconn_delete(data->ftp_connection);
-        data->ftp_connection = NULL;
-        LWIP_MEMPOOL_FREE(ftp_client_pool, data);
-        // feedback to CMS log
-        DIAG(FTP "%s not started", name);
-    }
+    data->task_handle =
+        xTaskCreateStatic(ftp_task, name, FTP_TASK_STACK_SIZE, data, 2,
+                          data->task_stack, &data->task_static);
 #else
-    task_handle = xTaskCreate(ftp_task, name, FTP_TASK_STACK_SIZE, data, 2,
-                              data->task_handle);
-    if (task_handle != pdPASS) {
-        // if creation of the task fails, close and clean up the connection
-        netconn_close(data->ftp_connection);
-        netconn_delete(data->ftp_connection);
-        data->ftp_connection = NULL;
-        LWIP_MEMPOOL_FREE(ftp_client_pool, data);
+    if (xTaskCreate(ftp_task, name, FTP_TASK_STACK_SIZE, data, 2,
+                    &data->task_handle) != pdPASS)
+        data->task_handle = NULL;
+#endif
+    if (data->task_handle == NULL) {
         // feedback to CMS log
         DIAG(FTP "%s not started", name);
+        return false;
     }
-#endif
-    else {
-#if FTP_TASK_STATIC == 1
-        data->task_handle = &task_handle;
-#endif
+    return true;
+}
+
+// a slot whose task is waiting, NULL if all are in use
+static server_stru_t *ftp_free_link(void) {
+    for (uint8_t i = 0; i < FTP_NBR_CLIENTS; i++) {
+        if (ftp_links[i].task_handle != NULL && !ftp_links[i].busy)
+            return &ftp_links[i];
     }
+    return NULL;
 }
 
 // ftp server task
 void ftp_server(void) {
     struct netconn *ftp_srv_conn;
     struct netconn *ftp_client_conn;
-    server_stru_t *ftp_links;
-    uint8_t index = 0;
+    server_stru_t *ftp_link;
 
-    LWIP_MEMPOOL_INIT(ftp_client_pool);
+    // the client tasks, one per connection served at the same time
+    for (uint8_t i = 0; i < FTP_NBR_CLIENTS; i++)
+        ftp_start_task(&ftp_links[i], i);
 
     // Create the TCP connection handle
     ftp_srv_conn = netconn_new(NETCONN_TCP);
@@ -167,9 +154,9 @@ void ftp_server(void) {
     while (1) {
         // Wait for incoming connections
         if (netconn_accept(ftp_srv_conn, &ftp_client_conn) == ERR_OK) {
-            ftp_links = (server_stru_t *)LWIP_MEMPOOL_ALLOC(ftp_client_pool);
+            ftp_link = ftp_free_link();
             // all connections in use?
-            if (ftp_links == NULL) {
+            if (ftp_link == NULL) {
                 // tell that no connections are allowed
                 netconn_write(ftp_client_conn, no_conn_allowed,
                               strlen(no_conn_allowed), NETCONN_COPY);
@@ -190,15 +177,14 @@ void ftp_server(void) {
             // not all connections in use
             else {
                 // copy client connection
-                ftp_links->ftp_connection = ftp_client_conn;
+                ftp_link->ftp_connection = ftp_client_conn;
+                ftp_link->busy = true;
 
                 // zero out client connection
                 ftp_client_conn = NULL;
 
-                // try and start the FTP task for this connection
-                ftp_start_task(ftp_links, index);
-
-                index++;
+                // hand the connection to the task of the slot
+                xTaskNotifyGive(ftp_link->task_handle);
             }
         }
     }
@@ -22,9 +22,10 @@
 
 #include "ftp_server.h"
 #include <lwip/tcpip.h>
+#include <stdbool.h>
 
-// static task allocation?
-#define FTP_TASK_STATIC 0
+// static task allocation? One task per client, started with the server
+#define FTP_TASK_STATIC 1
 
 // stack size for ftp task
 #define FTP_TASK_STACK_SIZE 1536
@@ -42,7 +43,9 @@
 typedef struct {
     uint8_t number;
     struct netconn *ftp_connection;
-    TaskHandle_t *task_handle;
+    TaskHandle_t task_handle;
+    // serving a connection, cleared by the task when it is done
+    volatile bool busy;
 #if FTP_TASK_STATIC == 1
     StackType_t task_stack[FTP_TASK_STACK_SIZE];
     StaticTask_t task_static;
@@ -1402,7 +1402,7 @@ static void ftp_cmd_site(ftp_data_t *ftp) {
 
     if (!strcmp(ftp->parameters, "FREE")) {
         FATFS *fs;
-        uint32_t free_clust;
+        DWORD free_clust;
         ftps_f_getfree("0:", &free_clust, &fs);
         ftp_send(ftp, "211 %lu MB free of %lu MB capacity\r\n",
                  free_clust * fs->csize >> 11,
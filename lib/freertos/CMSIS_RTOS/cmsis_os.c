@@ -952,7 +952,7 @@ void *osPoolAlloc (osPoolId pool_id)
     
     if (pool_id->markers[index] == 0) {
       pool_id->markers[index] = 1;
-      p = (void *)((uint32_t)(pool_id->pool) + (index * pool_id->item_sz));
+      p = (void *)((uintptr_t)(pool_id->pool) + (index * pool_id->item_sz));
       pool_id->currentIndex = index;
       break;
     }
@@ -1009,7 +1009,7 @@ osStatus osPoolFree (osPoolId pool_id, void *block)
     return osErrorParameter;
   }
   
-  index = (uint32_t)block - (uint32_t)(pool_id->pool);
+  index = (uint32_t)((uintptr_t)block - (uintptr_t)(pool_id->pool));
   if (index % pool_id->item_sz) {
     return osErrorParameter;
   }
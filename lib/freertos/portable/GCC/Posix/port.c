@@ -0,0 +1,526 @@
+/**
+ ******************************************************************************
+ * @file           port.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          FreeRTOS port for the POSIX host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*
+ * One simulated core: only the thread of the running task executes, all the
+ * others wait on their resume event with the signals of the port blocked, so
+ * the process directed tick and IRQ signals always land on the running task.
+ * The interrupt mask, the ISR state and the critical nesting are the ones of
+ * the core and are global, as on the Cortex-M7 no task is switched while they
+ * mask. A signal received while masked is deferred and replayed at unmask,
+ * the ticks are counted from the monotonic clock and never lost.
+ */
+
+#define portTICK_SIGNAL SIGALRM
+#define portIRQ_SIGNAL SIGUSR1
+#define portMAX_THREADS (128)
+#define portIRQ_WORDS (portHOST_IRQ_LINES / 32)
+#define portTHREAD_STACK (512 * 1024)
+#define portNS_PER_TICK (1000000000ull / configTICK_RATE_HZ)
+
+typedef struct {
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool resumed;
+    bool dying;
+    TaskFunction_t code;
+    void *parameters;
+    sigjmp_buf exit;
+    atomic_bool used;
+} Thread_t;
+
+typedef struct {
+    void (*entry)(void *);
+    void *argument;
+} HostThread_t;
+
+/*the first member of the TCB is the pxTopOfStack, a Thread_t here*/
+extern void *volatile pxCurrentTCB;
+
+static Thread_t threads[portMAX_THREADS];
+static sigset_t portSignals;
+static timer_t tickTimer;
+static struct timespec schedulerStart;
+static uint64_t ticksDone;
+
+static pthread_mutex_t endMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t endCond = PTHREAD_COND_INITIALIZER;
+static bool schedulerEnded;
+
+/*the simulated core*/
+static volatile bool schedulerRunning;
+static volatile uint32_t basepri;
+static volatile uint32_t primask;
+static volatile bool inIsr;
+static volatile bool yieldPending;
+static volatile sig_atomic_t deferred;
+static UBaseType_t criticalNesting = 0xaaaaaaaa;
+static uint32_t syscallNesting;
+static uint32_t syscallBasepri;
+
+static void (*irqHandlers[portHOST_IRQ_LINES])(void);
+static atomic_uint irqPending[portIRQ_WORDS];
+static atomic_uint irqEnabled[portIRQ_WORDS];
+
+static __thread bool isTaskThread;
+
+static void prvDispatch(void);
+void xPortSysTickHandler(void);
+
+static inline void prvCompilerFence(void) {
+    atomic_signal_fence(memory_order_seq_cst);
+}
+
+static inline bool prvMasked(void) {
+    return basepri != 0 || primask != 0 || inIsr;
+}
+
+static inline Thread_t *prvCurrentThread(void) {
+    return *(Thread_t *volatile *)pxCurrentTCB;
+}
+
+static void prvInitSignals(void) {
+    sigemptyset(&portSignals);
+    sigaddset(&portSignals, portTICK_SIGNAL);
+    sigaddset(&portSignals, portIRQ_SIGNAL);
+}
+
+static void prvBlockSignals(sigset_t *previous) {
+    pthread_sigmask(SIG_BLOCK, &portSignals, previous);
+}
+
+static void prvRestoreSignals(const sigset_t *previous) {
+    pthread_sigmask(SIG_SETMASK, previous, NULL);
+}
+
+/*-----------------------------------------------------------*/
+
+static Thread_t *prvAllocThread(void) {
+    for (uint32_t i = 0; i < portMAX_THREADS; i++) {
+        if (!atomic_exchange(&threads[i].used, true))
+            return &threads[i];
+    }
+    return NULL;
+}
+
+static void prvResume(Thread_t *thread) {
+    pthread_mutex_lock(&thread->mutex);
+    thread->resumed = true;
+    pthread_cond_signal(&thread->cond);
+    pthread_mutex_unlock(&thread->mutex);
+}
+
+/*back to the entry, the stack of a deleted task is discarded as on target*/
+static void prvSuspend(Thread_t *thread) {
+    pthread_mutex_lock(&thread->mutex);
+    while (!thread->resumed)
+        pthread_cond_wait(&thread->cond, &thread->mutex);
+    thread->resumed = false;
+    bool dying = thread->dying;
+    pthread_mutex_unlock(&thread->mutex);
+    if (dying) {
+        isTaskThread = false;
+        siglongjmp(thread->exit, 1);
+    }
+}
+
+static void *prvThreadEntry(void *argument) {
+    Thread_t *thread = argument;
+    /*the mask saved here is the blocked one of pthread_create*/
+    if (sigsetjmp(thread->exit, 1) == 0) {
+        isTaskThread = true;
+        prvSuspend(thread);
+        pthread_sigmask(SIG_UNBLOCK, &portSignals, NULL);
+        thread->code(thread->parameters);
+        /*a task function must not return*/
+        vTaskDelete(NULL);
+    }
+    return NULL;
+}
+
+/*with the signals blocked, the thread of the new task runs on return*/
+static void prvSwitch(void) {
+    Thread_t *previous = prvCurrentThread();
+    vTaskSwitchContext();
+    Thread_t *next = prvCurrentThread();
+    if (next == previous)
+        return;
+    prvResume(next);
+    prvSuspend(previous);
+}
+
+static uint64_t prvTicksDue(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    uint64_t ns =
+        (uint64_t)(now.tv_sec - schedulerStart.tv_sec) * 1000000000ull +
+        (uint64_t)now.tv_nsec - (uint64_t)schedulerStart.tv_nsec;
+    return ns / portNS_PER_TICK;
+}
+
+static bool prvRunIrqs(void) {
+    bool work = false;
+    for (uint32_t word = 0; word < portIRQ_WORDS; word++) {
+        uint32_t lines = atomic_load(&irqPending[word]) &
+                         atomic_load(&irqEnabled[word]);
+        if (lines == 0)
+            continue;
+        atomic_fetch_and(&irqPending[word], ~lines);
+        work = true;
+        while (lines != 0) {
+            uint32_t bit = (uint32_t)__builtin_ctz(lines);
+            lines &= lines - 1;
+            void (*handler)(void) = irqHandlers[word * 32 + bit];
+            if (handler != NULL)
+                handler();
+        }
+    }
+    return work;
+}
+
+/*the exception entry, with the signals blocked and the core unmasked*/
+static void prvDispatch(void) {
+    inIsr = true;
+    prvCompilerFence();
+    bool work;
+    do {
+        deferred = 0;
+        work = false;
+        uint64_t due = prvTicksDue();
+        while (ticksDone < due) {
+            ticksDone++;
+            work = true;
+            xPortSysTickHandler();
+        }
+        work |= prvRunIrqs();
+    } while (work || deferred);
+    prvCompilerFence();
+    inIsr = false;
+    /*PendSV, the lowest priority*/
+    if (yieldPending) {
+        yieldPending = false;
+        prvSwitch();
+    }
+}
+
+static void prvSignalHandler(int signal) {
+    (void)signal;
+    int error = errno;
+    if (!isTaskThread || !schedulerRunning || prvMasked())
+        deferred = 1;
+    else
+        prvDispatch();
+    errno = error;
+}
+
+/*the core is unmasked again, take what came in the meantime*/
+static void prvUnmasked(void) {
+    if (!schedulerRunning || !isTaskThread || prvMasked())
+        return;
+    if (deferred == 0 && !yieldPending)
+        return;
+    sigset_t previous;
+    prvBlockSignals(&previous);
+    prvDispatch();
+    prvRestoreSignals(&previous);
+}
+
+/*-----------------------------------------------------------*/
+
+StackType_t *pxPortInitialiseStack(StackType_t *pxTopOfStack,
+                                   StackType_t *pxEndOfStack,
+                                   TaskFunction_t pxCode, void *pvParameters) {
+    Thread_t *thread = prvAllocThread();
+    configASSERT(thread != NULL);
+    thread->resumed = false;
+    thread->dying = false;
+    thread->code = pxCode;
+    thread->parameters = pvParameters;
+    pthread_mutex_init(&thread->mutex, NULL);
+    pthread_cond_init(&thread->cond, NULL);
+
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    size_t size = (size_t)((uintptr_t)pxTopOfStack - (uintptr_t)pxEndOfStack) +
+                  sizeof(StackType_t);
+    if (size >= portHOST_MIN_TASK_STACK)
+        /*stack watermark and overflow check as on target*/
+        pthread_attr_setstack(&attributes, pxEndOfStack,
+                              size & ~(size_t)(portBYTE_ALIGNMENT - 1));
+    else
+        pthread_attr_setstacksize(&attributes, portTHREAD_STACK);
+
+    sigset_t previous;
+    vPortHostEnterSyscall();
+    prvInitSignals();
+    prvBlockSignals(&previous);
+    int error = pthread_create(&thread->thread, &attributes, prvThreadEntry,
+                               thread);
+    prvRestoreSignals(&previous);
+    vPortHostExitSyscall();
+    pthread_attr_destroy(&attributes);
+    configASSERT(error == 0);
+
+    return (StackType_t *)thread;
+}
+
+void vPortCleanUpThread(void *pxTCB) {
+    Thread_t *thread = *(Thread_t **)pxTCB;
+    pthread_mutex_lock(&thread->mutex);
+    thread->dying = true;
+    thread->resumed = true;
+    pthread_cond_signal(&thread->cond);
+    pthread_mutex_unlock(&thread->mutex);
+
+    vPortHostEnterSyscall();
+    pthread_join(thread->thread, NULL);
+    vPortHostExitSyscall();
+    pthread_mutex_destroy(&thread->mutex);
+    pthread_cond_destroy(&thread->cond);
+    atomic_store(&thread->used, false);
+}
+
+BaseType_t xPortStartScheduler(void) {
+    prvInitSignals();
+    /*main is out of the kernel from now on*/
+    prvBlockSignals(NULL);
+
+    struct sigaction action = {0};
+    action.sa_handler = prvSignalHandler;
+    action.sa_mask = portSignals;
+    action.sa_flags = SA_RESTART;
+    sigaction(portTICK_SIGNAL, &action, NULL);
+    sigaction(portIRQ_SIGNAL, &action, NULL);
+
+    struct sigevent event = {0};
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = portTICK_SIGNAL;
+    if (timer_create(CLOCK_MONOTONIC, &event, &tickTimer) != 0)
+        return pdFALSE;
+    struct itimerspec period = {0};
+    period.it_interval.tv_nsec = (long)portNS_PER_TICK;
+    period.it_value.tv_nsec = (long)portNS_PER_TICK;
+
+    clock_gettime(CLOCK_MONOTONIC, &schedulerStart);
+    ticksDone = 0;
+    criticalNesting = 0;
+    primask = 0;
+    basepri = 0;
+    schedulerRunning = true;
+    timer_settime(tickTimer, 0, &period, NULL);
+    prvResume(prvCurrentThread());
+
+    pthread_mutex_lock(&endMutex);
+    while (!schedulerEnded)
+        pthread_cond_wait(&endCond, &endMutex);
+    pthread_mutex_unlock(&endMutex);
+    timer_delete(tickTimer);
+    return pdTRUE;
+}
+
+/*the caller runs on, e.g. to the exit of the process from main*/
+void vPortEndScheduler(void) {
+    schedulerRunning = false;
+    pthread_mutex_lock(&endMutex);
+    schedulerEnded = true;
+    pthread_cond_signal(&endCond);
+    pthread_mutex_unlock(&endMutex);
+}
+
+/*the SysTick of the target, osSystickHandler() of cmsis_os.c calls it too*/
+void xPortSysTickHandler(void) {
+    if (xTaskIncrementTick() != pdFALSE)
+        yieldPending = true;
+}
+
+void vPortYield(void) {
+    yieldPending = true;
+    if (!schedulerRunning || !isTaskThread || prvMasked())
+        return;
+    sigset_t previous;
+    prvBlockSignals(&previous);
+    prvDispatch();
+    prvRestoreSignals(&previous);
+}
+
+/*the idle task waits for the next signal instead of spinning*/
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime) {
+    uint64_t ns = (uint64_t)xExpectedIdleTime * portNS_PER_TICK;
+    struct timespec sleep = {.tv_sec = (time_t)(ns / 1000000000ull),
+                             .tv_nsec = (long)(ns % 1000000000ull)};
+    nanosleep(&sleep, NULL);
+}
+
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortRaiseBASEPRI(void) {
+    uint32_t previous = basepri;
+    basepri = configMAX_SYSCALL_INTERRUPT_PRIORITY;
+    prvCompilerFence();
+    return previous;
+}
+
+uint32_t ulPortGetBASEPRI(void) { return basepri; }
+
+void vPortSetBASEPRI(uint32_t ulNewMaskValue) {
+    prvCompilerFence();
+    basepri = ulNewMaskValue;
+    if (ulNewMaskValue == 0)
+        prvUnmasked();
+}
+
+uint32_t ulPortGetPRIMASK(void) { return primask; }
+
+void vPortSetPRIMASK(uint32_t ulNewMaskValue) {
+    prvCompilerFence();
+    primask = ulNewMaskValue;
+    if (ulNewMaskValue == 0)
+        prvUnmasked();
+}
+
+BaseType_t xPortIsInsideInterrupt(void) { return inIsr ? pdTRUE : pdFALSE; }
+
+void vPortEnterCritical(void) {
+    portDISABLE_INTERRUPTS();
+    criticalNesting++;
+}
+
+void vPortExitCritical(void) {
+    configASSERT(criticalNesting);
+    criticalNesting--;
+    if (criticalNesting == 0)
+        portENABLE_INTERRUPTS();
+}
+
+/*-----------------------------------------------------------*/
+
+void vPortHostEnterSyscall(void) {
+    if (!isTaskThread || !schedulerRunning || inIsr)
+        return;
+    if (syscallNesting++ == 0)
+        syscallBasepri = ulPortRaiseBASEPRI();
+}
+
+void vPortHostExitSyscall(void) {
+    if (!isTaskThread || !schedulerRunning || inIsr)
+        return;
+    if (--syscallNesting == 0)
+        vPortSetBASEPRI(syscallBasepri);
+}
+
+void vPortHostSetIrqHandler(uint32_t ulIrq, void (*pxHandler)(void)) {
+    configASSERT(ulIrq < portHOST_IRQ_LINES);
+    irqHandlers[ulIrq] = pxHandler;
+}
+
+void vPortHostEnableIrq(uint32_t ulIrq, BaseType_t xEnable) {
+    configASSERT(ulIrq < portHOST_IRQ_LINES);
+    uint32_t bit = 1u << (ulIrq % 32);
+    if (xEnable == pdFALSE) {
+        atomic_fetch_and(&irqEnabled[ulIrq / 32], ~bit);
+        return;
+    }
+    atomic_fetch_or(&irqEnabled[ulIrq / 32], bit);
+    if ((atomic_load(&irqPending[ulIrq / 32]) & bit) != 0)
+        kill(getpid(), portIRQ_SIGNAL);
+}
+
+void vPortHostPendIrq(uint32_t ulIrq) {
+    configASSERT(ulIrq < portHOST_IRQ_LINES);
+    uint32_t bit = 1u << (ulIrq % 32);
+    atomic_fetch_or(&irqPending[ulIrq / 32], bit);
+    if ((atomic_load(&irqEnabled[ulIrq / 32]) & bit) == 0)
+        return;
+    if (inIsr && isTaskThread)
+        return; /*the dispatch loop takes it*/
+    kill(getpid(), portIRQ_SIGNAL);
+}
+
+void vPortHostClearIrq(uint32_t ulIrq) {
+    configASSERT(ulIrq < portHOST_IRQ_LINES);
+    atomic_fetch_and(&irqPending[ulIrq / 32], ~(1u << (ulIrq % 32)));
+}
+
+BaseType_t xPortHostIrqPending(uint32_t ulIrq) {
+    configASSERT(ulIrq < portHOST_IRQ_LINES);
+    return (atomic_load(&irqPending[ulIrq / 32]) & (1u << (ulIrq % 32))) != 0
+               ? pdTRUE
+               : pdFALSE;
+}
+
+static void *prvHostThreadEntry(void *argument) {
+    HostThread_t host = *(HostThread_t *)argument;
+    free(argument);
+    host.entry(host.argument);
+    return NULL;
+}
+
+BaseType_t xPortHostThreadCreate(void (*pxEntry)(void *), void *pvArgument) {
+    vPortHostEnterSyscall();
+    HostThread_t *host = malloc(sizeof(HostThread_t));
+    vPortHostExitSyscall();
+    if (host == NULL)
+        return pdFALSE;
+    host->entry = pxEntry;
+    host->argument = pvArgument;
+
+    sigset_t previous;
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+    pthread_t thread;
+    vPortHostEnterSyscall();
+    prvInitSignals();
+    prvBlockSignals(&previous);
+    int error =
+        pthread_create(&thread, &attributes, prvHostThreadEntry, host);
+    prvRestoreSignals(&previous);
+    vPortHostExitSyscall();
+    pthread_attr_destroy(&attributes);
+    if (error != 0) {
+        vPortHostEnterSyscall();
+        free(host);
+        vPortHostExitSyscall();
+        return pdFALSE;
+    }
+    return pdTRUE;
+}
+
+uint64_t ullPortHostTimeUs(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000ull + (uint64_t)now.tv_nsec / 1000;
+}
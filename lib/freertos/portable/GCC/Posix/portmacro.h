@@ -0,0 +1,162 @@
+/**
+ ******************************************************************************
+ * @file           portmacro.h
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          FreeRTOS port for the POSIX host simulation
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Each task is a pthread, only the one of the running task is not parked.
+ * The tick and the simulated interrupts are signals handled by the running
+ * task as an ISR. The BASEPRI and PRIMASK of the Cortex-M7 are kept per task:
+ * a signal arriving while they mask is recorded and handled when they are
+ * lowered again, a yield is deferred in the same way as the PendSV.
+ */
+
+/*the same stack words as the target, the StaticThread stacks are uint32_t*/
+#define portCHAR char
+#define portFLOAT float
+#define portDOUBLE double
+#define portLONG long
+#define portSHORT short
+#define portSTACK_TYPE uint32_t
+#define portBASE_TYPE long
+#define portPOINTER_SIZE_TYPE uintptr_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#if (configUSE_16_BIT_TICKS == 1)
+typedef uint16_t TickType_t;
+#define portMAX_DELAY (TickType_t)0xffff
+#else
+typedef uint32_t TickType_t;
+#define portMAX_DELAY (TickType_t)0xffffffffUL
+#define portTICK_TYPE_IS_ATOMIC 1
+#endif
+
+#define portSTACK_GROWTH (-1)
+#define portTICK_PERIOD_MS ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portBYTE_ALIGNMENT 16
+/*
+ * smaller task stacks are too small for the host frames and signal frames,
+ * such a task runs on a stack of its own pthread
+ */
+#define portHOST_MIN_TASK_STACK (64 * 1024)
+/*the stack bottom is needed to run the thread on the task stack*/
+#define portHAS_STACK_OVERFLOW_CHECKING 1
+
+/*scheduler utilities*/
+void vPortYield(void);
+
+#define portYIELD() vPortYield()
+#define portEND_SWITCHING_ISR(xSwitchRequired)                                 \
+    if ((xSwitchRequired) != pdFALSE)                                          \
+    portYIELD()
+#define portYIELD_FROM_ISR(x) portEND_SWITCHING_ISR(x)
+
+/*critical sections, BASEPRI and PRIMASK of the calling task*/
+void vPortEnterCritical(void);
+void vPortExitCritical(void);
+uint32_t ulPortRaiseBASEPRI(void);
+uint32_t ulPortGetBASEPRI(void);
+void vPortSetBASEPRI(uint32_t ulNewMaskValue);
+uint32_t ulPortGetPRIMASK(void);
+void vPortSetPRIMASK(uint32_t ulNewMaskValue);
+BaseType_t xPortIsInsideInterrupt(void);
+
+#define portSET_INTERRUPT_MASK_FROM_ISR() ulPortRaiseBASEPRI()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x) vPortSetBASEPRI(x)
+#define portDISABLE_INTERRUPTS() ((void)ulPortRaiseBASEPRI())
+#define portENABLE_INTERRUPTS() vPortSetBASEPRI(0)
+#define portENTER_CRITICAL() vPortEnterCritical()
+#define portEXIT_CRITICAL() vPortExitCritical()
+
+/*the thread of a deleted task is joined when its TCB is freed*/
+void vPortCleanUpThread(void *pxTCB);
+
+#define portCLEAN_UP_TCB(pxTCB) vPortCleanUpThread(pxTCB)
+
+/*the idle task sleeps until the next tick or simulated interrupt*/
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime);
+
+#define portSUPPRESS_TICKS_AND_SLEEP(xExpectedIdleTime)                        \
+    vPortSuppressTicksAndSleep(xExpectedIdleTime)
+
+#define portTASK_FUNCTION_PROTO(vFunction, pvParameters)                       \
+    void vFunction(void *pvParameters)
+#define portTASK_FUNCTION(vFunction, pvParameters)                             \
+    void vFunction(void *pvParameters)
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+#if (configMAX_PRIORITIES > 32)
+#error configUSE_PORT_OPTIMISED_TASK_SELECTION needs at most 32 priorities
+#endif
+#define portRECORD_READY_PRIORITY(uxPriority, uxReadyPriorities)               \
+    (uxReadyPriorities) |= (1UL << (uxPriority))
+#define portRESET_READY_PRIORITY(uxPriority, uxReadyPriorities)                \
+    (uxReadyPriorities) &= ~(1UL << (uxPriority))
+#define portGET_HIGHEST_PRIORITY(uxTopPriority, uxReadyPriorities)             \
+    uxTopPriority = (31UL - (uint32_t)__builtin_clz((uint32_t)(uxReadyPriorities)))
+#endif
+
+#define portNOP()
+#define portINLINE __inline
+#ifndef portFORCE_INLINE
+#define portFORCE_INLINE inline __attribute__((always_inline))
+#endif
+#define portMEMORY_BARRIER() __asm volatile("" ::: "memory")
+
+/*
+ * Simulated interrupt lines, numbered as the IRQn of the device. A line is
+ * pended from any thread, also from threads unknown to the kernel, and its
+ * handler runs on the running task as an ISR.
+ */
+#define portHOST_IRQ_LINES (256)
+
+void vPortHostSetIrqHandler(uint32_t ulIrq, void (*pxHandler)(void));
+void vPortHostEnableIrq(uint32_t ulIrq, BaseType_t xEnable);
+void vPortHostPendIrq(uint32_t ulIrq);
+void vPortHostClearIrq(uint32_t ulIrq);
+BaseType_t xPortHostIrqPending(uint32_t ulIrq);
+
+/*
+ * Host calls that take locks of the C library, e.g. the allocator: a task
+ * switch inside them would stop the other tasks on the lock. Without effect
+ * in an ISR, where the tasks cannot switch anyway.
+ */
+void vPortHostEnterSyscall(void);
+void vPortHostExitSyscall(void);
+
+/*a helper pthread, out of the kernel, the signals of the port blocked*/
+BaseType_t xPortHostThreadCreate(void (*pxEntry)(void *), void *pvArgument);
+
+/*microseconds of the monotonic clock, for the run time statistics*/
+uint64_t ullPortHostTimeUs(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTMACRO_H */
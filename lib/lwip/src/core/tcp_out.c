@@ -1691,6 +1691,7 @@ tcp_rexmit_rto_commit(struct tcp_pcb *pcb)
   if (pcb->nrtx < 0xFF) {
     ++pcb->nrtx;
   }
+  MIB2_STATS_INC(mib2.tcpretranssegs);
   /* Do the actual retransmission */
   tcp_output(pcb);
 }
@@ -45,6 +45,15 @@
 int errno;
 #endif
 
+#ifdef CARBON_HOST
+/* a pointer of the host does not fit the 32 bit CMSIS message */
+#define sys_mbox_put(mbox, msg, millisec)                                      \
+  (xQueueSend(mbox, &(msg), millisec) == pdTRUE ? osOK : osErrorOS)
+#else
+#define sys_mbox_put(mbox, msg, millisec)                                      \
+  osMessagePut(mbox, (uint32_t)(msg), millisec)
+#endif
+
 /*-----------------------------------------------------------------------------------*/
 //  Creates an empty mailbox.
 err_t sys_mbox_new(sys_mbox_t *mbox, int size)
@@ -104,7 +113,7 @@ void sys_mbox_free(sys_mbox_t *mbox)
 void sys_mbox_post(sys_mbox_t *mbox, void *data)
 {
 #if (osCMSIS < 0x20000U)
-  while(osMessagePut(*mbox, (uint32_t)data, osWaitForever) != osOK);
+  while(sys_mbox_put(*mbox, data, osWaitForever) != osOK);
 #else
   while(osMessageQueuePut(*mbox, &data, 0, osWaitForever) != osOK);
 #endif
@@ -117,7 +126,7 @@ err_t sys_mbox_trypost(sys_mbox_t *mbox, void *msg)
 {
   err_t result;
 #if (osCMSIS < 0x20000U)
-  if(osMessagePut(*mbox, (uint32_t)msg, 0) == osOK)
+  if(sys_mbox_put(*mbox, msg, 0) == osOK)
 #else
   if(osMessageQueuePut(*mbox, &msg, 0, 0) == osOK)
 #endif
@@ -177,7 +186,7 @@ u32_t sys_arch_mbox_fetch(sys_mbox_t *mbox, void **msg, u32_t timeout)
 
     if(event.status == osEventMessage)
     {
-      *msg = (void *)event.value.v;
+      *msg = event.value.p;
       return (osKernelSysTick() - starttime);
     }
 #else
@@ -196,7 +205,7 @@ u32_t sys_arch_mbox_fetch(sys_mbox_t *mbox, void **msg, u32_t timeout)
   {
 #if (osCMSIS < 0x20000U)
     event = osMessageGet (*mbox, osWaitForever);
-    *msg = (void *)event.value.v;
+    *msg = event.value.p;
     return (osKernelSysTick() - starttime);
 #else
     osMessageQueueGet(*mbox, msg, 0, osWaitForever );
@@ -219,7 +228,7 @@ u32_t sys_arch_mbox_tryfetch(sys_mbox_t *mbox, void **msg)
 
   if(event.status == osEventMessage)
   {
-    *msg = (void *)event.value.v;
+    *msg = event.value.p;
 #else
   if (osMessageQueueGet(*mbox, msg, 0, 0) == osOK)
   {
@@ -446,6 +455,17 @@ void sys_mutex_unlock(sys_mutex_t *mutex)
 /*-----------------------------------------------------------------------------------*/
 // TODO
 /*-----------------------------------------------------------------------------------*/
+#if (osCMSIS < 0x20000U) && (configSUPPORT_STATIC_ALLOCATION == 1)
+/* lwIP never deletes its threads: the tcpip thread, one stack of its size */
+#define SYS_THREAD_STATIC_COUNT 1
+#define SYS_THREAD_STATIC_STACKSIZE TCPIP_THREAD_STACKSIZE
+
+static StackType_t sys_thread_stacks[SYS_THREAD_STATIC_COUNT]
+                                    [SYS_THREAD_STATIC_STACKSIZE];
+static StaticTask_t sys_thread_tcbs[SYS_THREAD_STATIC_COUNT];
+static int sys_thread_count;
+#endif
+
 /*
   Starts a new thread with priority "prio" that will begin its execution in the
   function "thread()". The "arg" argument will be passed as an argument to the
@@ -455,9 +475,23 @@ void sys_mutex_unlock(sys_mutex_t *mutex)
 sys_thread_t sys_thread_new(const char *name, lwip_thread_fn thread , void *arg, int stacksize, int prio)
 {
 #if (osCMSIS < 0x20000U)
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+  LWIP_ASSERT("sys_thread_new: no static thread left",
+              sys_thread_count < SYS_THREAD_STATIC_COUNT);
+  LWIP_ASSERT("sys_thread_new: stack too big",
+              stacksize <= SYS_THREAD_STATIC_STACKSIZE);
+  if ((sys_thread_count >= SYS_THREAD_STATIC_COUNT) ||
+      (stacksize > SYS_THREAD_STATIC_STACKSIZE))
+    return NULL;
+  const osThreadDef_t os_thread_def = {
+      (char *)name, (os_pthread)thread, (osPriority)prio, 0, stacksize,
+      sys_thread_stacks[sys_thread_count], &sys_thread_tcbs[sys_thread_count]};
+  sys_thread_count++;
+#else
     const osThreadDef_t os_thread_def = {
         (char *)name, (os_pthread)thread, (osPriority)prio, 0, stacksize, NULL,
         NULL};
+#endif
     return osThreadCreate(&os_thread_def, arg);
 #else
   const osThreadAttr_t attributes = {
@@ -33,6 +33,7 @@
 #define __CC_H__
 
 #include "cpu.h"
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
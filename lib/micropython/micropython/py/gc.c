@@ -763,6 +763,10 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
 
         #if MICROPY_GC_SPLIT_HEAP
         area = MP_STATE_MEM(gc_last_free_area);
+        #ifdef MICROPY_GC_ALLOC_AREA
+        // port placement policy: the first area to search, by size
+        area = MICROPY_GC_ALLOC_AREA(area, n_blocks);
+        #endif
         #else
         area = &MP_STATE_MEM(area);
         #endif
@@ -1142,6 +1146,9 @@ void gc_dump_info(const mp_print_t *print) {
     #endif
     mp_printf(print, "\n No. of 1-blocks: %u, 2-blocks: %u, max blk sz: %u, max free sz: %u\n",
         (uint)info.num_1block, (uint)info.num_2block, (uint)info.max_block, (uint)info.max_free);
+    #ifdef MICROPY_GC_DUMP_INFO_HOOK
+    MICROPY_GC_DUMP_INFO_HOOK(print);
+    #endif
 }
 
 void gc_dump_alloc_table(const mp_print_t *print) {
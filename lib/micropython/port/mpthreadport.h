@@ -58,6 +58,8 @@ typedef struct _mp_thread_mutex_t {
 
 void mp_thread_init(void *stack, size_t stack_len);
 void mp_thread_gc_others(void);
+/*the stacks mp_thread_gc_others() traces, for the native code area*/
+void mp_thread_visit_other_stacks(void (*visit)(void **ptrs, size_t len));
 
 #ifdef __cplusplus
 }
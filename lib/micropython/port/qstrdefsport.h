@@ -29,4 +29,4 @@
 
 // Entries for sys.path
 Q(/)
-Q(/ lib)
+Q(/lib)
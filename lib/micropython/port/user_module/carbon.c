@@ -0,0 +1,312 @@
+/**
+ ******************************************************************************
+ * @file           carbon.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micropython module for the firmware services
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "py/mperrno.h"
+#include "py/mpthread.h"
+#include "py/runtime.h"
+#include "py/smallint.h"
+
+/*
+ * No call allocates on the heap: the results go in the buffers given by the
+ * script, e.g. array('H') for the registers, bytearray for the registry, and
+ * the times are small ints in the ticks period as the ones of time.
+ */
+
+/*core/src/mp_port/user_module/mp_mod_carbon.cpp and carbon/systime.hpp*/
+uint32_t carbon_mp_cycles(void);
+uint32_t carbon_mp_modbus_read(const char *ip, uint8_t slaveId,
+                               uint16_t address, uint16_t *values,
+                               uint16_t count, bool input);
+uint32_t carbon_mp_modbus_max_registers(void);
+bool carbon_mp_trace(uint16_t channel, const void *data, uint32_t length);
+uint32_t carbon_mp_registry_size(uint32_t id);
+bool carbon_mp_registry_read(uint32_t id, void *value, uint32_t size,
+                             uint64_t *timestampUs);
+uint32_t carbon_mp_sd_bench(bool file, bool random, bool write,
+                            uint32_t requestSize, uint32_t depth,
+                            uint32_t durationMs, uint32_t spanBytes,
+                            uint32_t results[7]);
+bool carbon_mp_copy_bench(uint32_t size, uint32_t results[3]);
+uint64_t systimeUs(void);
+
+/*core/src/mp_port/mpprofile.c*/
+bool mp_carbon_profile_start(uint32_t rate);
+void mp_carbon_profile_reset(void);
+void mp_carbon_profile_dump(const mp_print_t *print);
+
+extern uint32_t SystemCoreClock;
+
+/*carbon/error.hpp*/
+#define CARBON_ERROR_NETWORK_CONNECTION_FAILED (3)
+#define CARBON_ERROR_NETWORK_INVALID_IP (4)
+#define CARBON_ERROR_FILE_NOT_FOUND (8)
+#define CARBON_ERROR_DISK_FULL (9)
+
+/*carbon/sd_bench.hpp*/
+#define SD_BENCH_MAX_DEPTH (4)
+#define SD_BENCH_MAX_REQUEST (65536)
+#define SD_BENCH_MAX_DURATION (600000)
+#define SD_BENCH_DEFAULT_SPAN (16 * 1024 * 1024)
+#define SD_BENCH_FILE (1)
+#define SD_BENCH_RANDOM (2)
+#define SD_BENCH_WRITE (4)
+#define SD_BENCH_RESULTS (7)
+
+/*carbon/mdma_copy.hpp*/
+#define COPY_BENCH_MAX (16 * 65536)
+#define COPY_BENCH_RESULTS (3)
+
+#define TICKS_MASK (MICROPY_PY_TIME_TICKS_PERIOD - 1)
+
+static mp_obj_t carbon_ticks_us(void) {
+    return MP_OBJ_NEW_SMALL_INT(systimeUs() & TICKS_MASK);
+}
+
+/*DWT cycle counter, wraps like ticks_us, time.ticks_diff() applies*/
+static mp_obj_t carbon_cycles(void) {
+    return MP_OBJ_NEW_SMALL_INT(carbon_mp_cycles() & TICKS_MASK);
+}
+
+static mp_obj_t carbon_cycles_per_us(void) {
+    return MP_OBJ_NEW_SMALL_INT(SystemCoreClock / 1000000);
+}
+
+/*modbus_read(ip, slave_id, address, registers[, input]), one per item*/
+static mp_obj_t carbon_modbus_read(size_t n_args, const mp_obj_t *args) {
+    const char *ip = mp_obj_str_get_str(args[0]);
+    mp_int_t slaveId = mp_obj_get_int(args[1]);
+    mp_int_t address = mp_obj_get_int(args[2]);
+    mp_buffer_info_t registers;
+    mp_get_buffer_raise(args[3], &registers, MP_BUFFER_WRITE);
+    bool input = n_args > 4 && mp_obj_is_true(args[4]);
+
+    if (registers.typecode != 'H' && registers.typecode != 'h')
+        mp_raise_TypeError(MP_ERROR_TEXT("registers must be array('H')"));
+    size_t count = registers.len / 2;
+    if (count == 0 || count > carbon_mp_modbus_max_registers())
+        mp_raise_ValueError(MP_ERROR_TEXT("register count"));
+    if (slaveId < 0 || slaveId > 0xFF || address < 0 ||
+        address + count > 0x10000)
+        mp_raise_ValueError(MP_ERROR_TEXT("slave id or address"));
+
+    /*the buffer is not freed while referenced by the args*/
+    MP_THREAD_GIL_EXIT();
+    uint32_t error = carbon_mp_modbus_read(ip, (uint8_t)slaveId,
+                                           (uint16_t)address, registers.buf,
+                                           (uint16_t)count, input);
+    MP_THREAD_GIL_ENTER();
+
+    if (error == CARBON_ERROR_NETWORK_INVALID_IP)
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid IP"));
+    if (error == CARBON_ERROR_NETWORK_CONNECTION_FAILED)
+        mp_raise_OSError(MP_ECONNREFUSED);
+    if (error != 0)
+        mp_raise_OSError(MP_EIO);
+    return mp_const_none;
+}
+
+/*trace(channel, data), False if the event could not be queued*/
+static mp_obj_t carbon_trace(mp_obj_t channel, mp_obj_t data) {
+    mp_int_t id = mp_obj_get_int(channel);
+    if (id < 0 || id > 0xFFFF)
+        mp_raise_ValueError(MP_ERROR_TEXT("channel"));
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(data, &info, MP_BUFFER_READ);
+    return mp_obj_new_bool(
+        carbon_mp_trace((uint16_t)id, info.buf, (uint32_t)info.len));
+}
+
+static mp_obj_t carbon_registry_size(mp_obj_t id) {
+    uint32_t size = carbon_mp_registry_size((uint32_t)mp_obj_get_int(id));
+    if (size == 0)
+        mp_raise_ValueError(MP_ERROR_TEXT("registry id"));
+    return MP_OBJ_NEW_SMALL_INT(size);
+}
+
+/*registry_read(id, value), False if the entry was never written*/
+static mp_obj_t carbon_registry_read(mp_obj_t id, mp_obj_t value) {
+    uint32_t entry = (uint32_t)mp_obj_get_int(id);
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(value, &info, MP_BUFFER_WRITE);
+    uint32_t size = carbon_mp_registry_size(entry);
+    if (size == 0)
+        mp_raise_ValueError(MP_ERROR_TEXT("registry id"));
+    if (info.len != size)
+        mp_raise_ValueError(MP_ERROR_TEXT("registry size"));
+    return mp_obj_new_bool(
+        carbon_mp_registry_read(entry, info.buf, size, NULL));
+}
+
+/*
+ * sd_bench(results, mode, size, depth, time_ms[, span]), mode of SD_FILE,
+ * SD_RANDOM and SD_WRITE; results array('I') of 7: requests, errors,
+ * elapsed us, p50, p90, p99 and max us of the requests
+ */
+static mp_obj_t carbon_sd_bench(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t results;
+    mp_get_buffer_raise(args[0], &results, MP_BUFFER_WRITE);
+    mp_int_t mode = mp_obj_get_int(args[1]);
+    mp_int_t size = mp_obj_get_int(args[2]);
+    mp_int_t depth = mp_obj_get_int(args[3]);
+    mp_int_t ms = mp_obj_get_int(args[4]);
+    mp_int_t span = n_args > 5 ? mp_obj_get_int(args[5])
+                               : SD_BENCH_DEFAULT_SPAN;
+
+    if (results.typecode != 'I' ||
+        results.len != SD_BENCH_RESULTS * sizeof(uint32_t))
+        mp_raise_TypeError(MP_ERROR_TEXT("results must be array('I') of 7"));
+    if (mode < 0 ||
+        mode > (SD_BENCH_FILE | SD_BENCH_RANDOM | SD_BENCH_WRITE))
+        mp_raise_ValueError(MP_ERROR_TEXT("mode"));
+    if (size <= 0 || size % 512 != 0 || size > SD_BENCH_MAX_REQUEST)
+        mp_raise_ValueError(MP_ERROR_TEXT("size"));
+    if (depth < 1 || depth > SD_BENCH_MAX_DEPTH)
+        mp_raise_ValueError(MP_ERROR_TEXT("depth"));
+    if (ms < 1 || ms > SD_BENCH_MAX_DURATION)
+        mp_raise_ValueError(MP_ERROR_TEXT("time"));
+    if (span < size)
+        mp_raise_ValueError(MP_ERROR_TEXT("span"));
+
+    MP_THREAD_GIL_EXIT();
+    uint32_t error = carbon_mp_sd_bench(
+        mode & SD_BENCH_FILE, mode & SD_BENCH_RANDOM, mode & SD_BENCH_WRITE,
+        (uint32_t)size, (uint32_t)depth, (uint32_t)ms, (uint32_t)span,
+        results.buf);
+    MP_THREAD_GIL_ENTER();
+
+    if (error == CARBON_ERROR_FILE_NOT_FOUND)
+        mp_raise_OSError(MP_ENODEV);
+    if (error == CARBON_ERROR_DISK_FULL)
+        mp_raise_OSError(MP_ENOSPC);
+    if (error != 0)
+        mp_raise_OSError(MP_EIO);
+    return mp_const_none;
+}
+
+#ifndef CARBON_HOST
+/*
+ * copy_bench(results, size), copies of size bytes in SDRAM by the CPU and by
+ * the MDMA; results array('I') of 3: cpu and mdma cycles, copy threshold
+ */
+static mp_obj_t carbon_copy_bench(mp_obj_t results_in, mp_obj_t size_in) {
+    mp_buffer_info_t results;
+    mp_get_buffer_raise(results_in, &results, MP_BUFFER_WRITE);
+    mp_int_t size = mp_obj_get_int(size_in);
+    if (results.typecode != 'I' ||
+        results.len != COPY_BENCH_RESULTS * sizeof(uint32_t))
+        mp_raise_TypeError(MP_ERROR_TEXT("results must be array('I') of 3"));
+    if (size <= 0 || size > COPY_BENCH_MAX)
+        mp_raise_ValueError(MP_ERROR_TEXT("size"));
+
+    MP_THREAD_GIL_EXIT();
+    bool done = carbon_mp_copy_bench((uint32_t)size, results.buf);
+    MP_THREAD_GIL_ENTER();
+
+    if (!done)
+        mp_raise_OSError(MP_EIO);
+    return mp_const_none;
+}
+#endif
+
+/*profile(rate), samples per second of the running line, 0 stops*/
+static mp_obj_t carbon_profile(mp_obj_t rate) {
+    mp_int_t hz = mp_obj_get_int(rate);
+    if (hz < 0 || !mp_carbon_profile_start((uint32_t)hz))
+        mp_raise_ValueError(MP_ERROR_TEXT("rate"));
+    return mp_const_none;
+}
+
+static mp_obj_t carbon_profile_dump(void) {
+    mp_carbon_profile_dump(&mp_plat_print);
+    return mp_const_none;
+}
+
+static mp_obj_t carbon_profile_reset(void) {
+    mp_carbon_profile_reset();
+    return mp_const_none;
+}
+
+static MP_DEFINE_CONST_FUN_OBJ_0(carbon_ticks_us_obj, carbon_ticks_us);
+
+static MP_DEFINE_CONST_FUN_OBJ_0(carbon_cycles_obj, carbon_cycles);
+
+static MP_DEFINE_CONST_FUN_OBJ_0(carbon_cycles_per_us_obj,
+                                 carbon_cycles_per_us);
+
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(carbon_modbus_read_obj, 4, 5,
+                                           carbon_modbus_read);
+
+static MP_DEFINE_CONST_FUN_OBJ_2(carbon_trace_obj, carbon_trace);
+
+static MP_DEFINE_CONST_FUN_OBJ_1(carbon_registry_size_obj,
+                                 carbon_registry_size);
+
+static MP_DEFINE_CONST_FUN_OBJ_2(carbon_registry_read_obj,
+                                 carbon_registry_read);
+
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(carbon_sd_bench_obj, 5, 6,
+                                           carbon_sd_bench);
+
+#ifndef CARBON_HOST
+static MP_DEFINE_CONST_FUN_OBJ_2(carbon_copy_bench_obj, carbon_copy_bench);
+#endif
+
+static MP_DEFINE_CONST_FUN_OBJ_1(carbon_profile_obj, carbon_profile);
+
+static MP_DEFINE_CONST_FUN_OBJ_0(carbon_profile_dump_obj, carbon_profile_dump);
+
+static MP_DEFINE_CONST_FUN_OBJ_0(carbon_profile_reset_obj,
+                                 carbon_profile_reset);
+
+static const mp_rom_map_elem_t carbon_module_globals_table[] = {
+    {MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_carbon)},
+    {MP_ROM_QSTR(MP_QSTR_ticks_us), MP_ROM_PTR(&carbon_ticks_us_obj)},
+    {MP_ROM_QSTR(MP_QSTR_cycles), MP_ROM_PTR(&carbon_cycles_obj)},
+    {MP_ROM_QSTR(MP_QSTR_cycles_per_us), MP_ROM_PTR(&carbon_cycles_per_us_obj)},
+    {MP_ROM_QSTR(MP_QSTR_modbus_read), MP_ROM_PTR(&carbon_modbus_read_obj)},
+    {MP_ROM_QSTR(MP_QSTR_trace), MP_ROM_PTR(&carbon_trace_obj)},
+    {MP_ROM_QSTR(MP_QSTR_registry_size),
+     MP_ROM_PTR(&carbon_registry_size_obj)},
+    {MP_ROM_QSTR(MP_QSTR_registry_read),
+     MP_ROM_PTR(&carbon_registry_read_obj)},
+    {MP_ROM_QSTR(MP_QSTR_sd_bench), MP_ROM_PTR(&carbon_sd_bench_obj)},
+#ifndef CARBON_HOST
+    {MP_ROM_QSTR(MP_QSTR_copy_bench), MP_ROM_PTR(&carbon_copy_bench_obj)},
+#endif
+    {MP_ROM_QSTR(MP_QSTR_profile), MP_ROM_PTR(&carbon_profile_obj)},
+    {MP_ROM_QSTR(MP_QSTR_profile_dump), MP_ROM_PTR(&carbon_profile_dump_obj)},
+    {MP_ROM_QSTR(MP_QSTR_profile_reset),
+     MP_ROM_PTR(&carbon_profile_reset_obj)},
+    /*carbon/registry_table.hpp RegistryId*/
+    {MP_ROM_QSTR(MP_QSTR_REGISTRY_NET_LINK), MP_ROM_INT(0)},
+    {MP_ROM_QSTR(MP_QSTR_REGISTRY_SD_CARD), MP_ROM_INT(1)},
+    {MP_ROM_QSTR(MP_QSTR_REGISTRY_MODBUS), MP_ROM_INT(2)},
+    {MP_ROM_QSTR(MP_QSTR_REGISTRY_CM4), MP_ROM_INT(3)},
+    /*sd_bench() mode*/
+    {MP_ROM_QSTR(MP_QSTR_SD_FILE), MP_ROM_INT(SD_BENCH_FILE)},
+    {MP_ROM_QSTR(MP_QSTR_SD_RANDOM), MP_ROM_INT(SD_BENCH_RANDOM)},
+    {MP_ROM_QSTR(MP_QSTR_SD_WRITE), MP_ROM_INT(SD_BENCH_WRITE)}};
+
+static MP_DEFINE_CONST_DICT(carbon_module_globals, carbon_module_globals_table);
+
+const mp_obj_module_t carbon_module = {
+    .base = {&mp_type_module},
+    .globals = (mp_obj_dict_t *)&carbon_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_carbon, carbon_module);
@@ -0,0 +1,137 @@
+/**
+ ******************************************************************************
+ * @file           latency.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micropython interrupt latency module
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "py/mpthread.h"
+#include "py/runtime.h"
+
+/*carbon/latency.hpp, carbon/systime.hpp and mp_mod_carbon.cpp*/
+int carbon_latency_get(uint32_t source, uint32_t kind, uint32_t values[4]);
+const char *carbon_latency_source_name(uint32_t source);
+const char *carbon_latency_kind_name(uint32_t kind);
+void carbon_latency_reset(void);
+void systimeProbe(uint32_t periodUs);
+void carbon_mp_wakeup_bench(uint32_t results[6]);
+
+extern uint32_t SystemCoreClock;
+
+/*prints count, p50, p99 and max of the non empty histograms*/
+static mp_obj_t latency_dump(void) {
+    uint32_t mhz = SystemCoreClock / 1000000;
+    mp_printf(&mp_plat_print, "%-8s %-8s %10s %8s %8s %8s (cycles at %u MHz)\n",
+              "source", "kind", "count", "p50", "p99", "max", (unsigned)mhz);
+    uint32_t values[4];
+    for (uint32_t source = 0; carbon_latency_get(source, 0, values) == 0;
+         source++) {
+        for (uint32_t kind = 0; carbon_latency_get(source, kind, values) == 0;
+             kind++) {
+            if (values[0] == 0)
+                continue;
+            mp_printf(&mp_plat_print, "%-8s %-8s %10u %8u %8u %8u\n",
+                      carbon_latency_source_name(source),
+                      carbon_latency_kind_name(kind), (unsigned)values[0],
+                      (unsigned)values[1], (unsigned)values[2],
+                      (unsigned)values[3]);
+        }
+    }
+    return mp_const_none;
+}
+
+/*list of (source, kind, count, p50, p99, max) tuples*/
+static mp_obj_t latency_table(void) {
+    mp_obj_t list = mp_obj_new_list(0, NULL);
+    uint32_t values[4];
+    for (uint32_t source = 0; carbon_latency_get(source, 0, values) == 0;
+         source++) {
+        for (uint32_t kind = 0; carbon_latency_get(source, kind, values) == 0;
+             kind++) {
+            mp_obj_t items[6] = {
+                mp_obj_new_str_from_cstr(carbon_latency_source_name(source)),
+                mp_obj_new_str_from_cstr(carbon_latency_kind_name(kind)),
+                mp_obj_new_int_from_uint(values[0]),
+                mp_obj_new_int_from_uint(values[1]),
+                mp_obj_new_int_from_uint(values[2]),
+                mp_obj_new_int_from_uint(values[3])};
+            mp_obj_list_append(list, mp_obj_new_tuple(6, items));
+        }
+    }
+    return list;
+}
+
+static mp_obj_t latency_reset(void) {
+    carbon_latency_reset();
+    return mp_const_none;
+}
+
+/*
+ * systime probe period in us, 0 stops it; off at boot, the systime entry
+ * histogram fills only while it runs
+ */
+static mp_obj_t latency_probe(mp_obj_t period) {
+    mp_int_t us = mp_obj_get_int(period);
+    if (us < 0)
+        mp_raise_ValueError(MP_ERROR_TEXT("negative period"));
+    systimeProbe((uint32_t)us);
+    return mp_const_none;
+}
+
+/*
+ * ((max, avg, missed) of a semaphore, the same of a completion), wake up
+ * cycles from a software interrupt, 64 of each, about 300 ms
+ */
+static mp_obj_t latency_wakeup(void) {
+    uint32_t results[6];
+    MP_THREAD_GIL_EXIT();
+    carbon_mp_wakeup_bench(results);
+    MP_THREAD_GIL_ENTER();
+    mp_obj_t modes[2];
+    for (size_t i = 0; i < 2; i++) {
+        mp_obj_t items[3] = {mp_obj_new_int_from_uint(results[i * 3]),
+                             mp_obj_new_int_from_uint(results[i * 3 + 1]),
+                             mp_obj_new_int_from_uint(results[i * 3 + 2])};
+        modes[i] = mp_obj_new_tuple(3, items);
+    }
+    return mp_obj_new_tuple(2, modes);
+}
+
+static MP_DEFINE_CONST_FUN_OBJ_0(latency_dump_obj, latency_dump);
+
+static MP_DEFINE_CONST_FUN_OBJ_0(latency_table_obj, latency_table);
+
+static MP_DEFINE_CONST_FUN_OBJ_0(latency_reset_obj, latency_reset);
+
+static MP_DEFINE_CONST_FUN_OBJ_1(latency_probe_obj, latency_probe);
+
+static MP_DEFINE_CONST_FUN_OBJ_0(latency_wakeup_obj, latency_wakeup);
+
+static const mp_rom_map_elem_t latency_module_globals_table[] = {
+    {MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_latency)},
+    {MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&latency_dump_obj)},
+    {MP_ROM_QSTR(MP_QSTR_table), MP_ROM_PTR(&latency_table_obj)},
+    {MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&latency_reset_obj)},
+    {MP_ROM_QSTR(MP_QSTR_probe), MP_ROM_PTR(&latency_probe_obj)},
+    {MP_ROM_QSTR(MP_QSTR_wakeup), MP_ROM_PTR(&latency_wakeup_obj)}};
+
+static MP_DEFINE_CONST_DICT(latency_module_globals,
+                            latency_module_globals_table);
+
+const mp_obj_module_t latency_module = {
+    .base = {&mp_type_module},
+    .globals = (mp_obj_dict_t *)&latency_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_latency, latency_module);
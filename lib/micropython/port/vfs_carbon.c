@@ -0,0 +1,448 @@
+/**
+ ******************************************************************************
+ * @file           vfs_carbon.c
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micropython files and imports on the FatFs volume
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/*
+ * The volume is the one mounted by the SD thread and shared with the FTP
+ * server, through the reentrant FatFs of the firmware: no extmod vfs and no
+ * oofatfs instance of its own.
+ */
+
+#include "py/builtin.h"
+#include "py/compile.h"
+#include "py/lexer.h"
+#include "py/mperrno.h"
+#include "py/persistentcode.h"
+#include "py/reader.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "vfs_carbon.h"
+
+#include <ff.h>
+
+#include <string.h>
+
+/*one sector, FatFs reads the aligned full sectors straight in the buffer*/
+#define VFS_CARBON_CHUNK _MAX_SS
+
+#define VFS_CARBON_CACHE_MAGIC 0x43424D43 /*CMBC*/
+
+static const byte vfs_carbon_errno[] = {
+    [FR_OK] = 0,
+    [FR_DISK_ERR] = MP_EIO,
+    [FR_INT_ERR] = MP_EIO,
+    [FR_NOT_READY] = MP_EBUSY,
+    [FR_NO_FILE] = MP_ENOENT,
+    [FR_NO_PATH] = MP_ENOENT,
+    [FR_INVALID_NAME] = MP_EINVAL,
+    [FR_DENIED] = MP_EACCES,
+    [FR_EXIST] = MP_EEXIST,
+    [FR_INVALID_OBJECT] = MP_EINVAL,
+    [FR_WRITE_PROTECTED] = MP_EROFS,
+    [FR_INVALID_DRIVE] = MP_ENODEV,
+    [FR_NOT_ENABLED] = MP_ENODEV,
+    [FR_NO_FILESYSTEM] = MP_ENODEV,
+    [FR_MKFS_ABORTED] = MP_EIO,
+    [FR_TIMEOUT] = MP_EIO,
+    [FR_LOCKED] = MP_EIO,
+    [FR_NOT_ENOUGH_CORE] = MP_ENOMEM,
+    [FR_TOO_MANY_OPEN_FILES] = MP_EMFILE,
+    [FR_INVALID_PARAMETER] = MP_EINVAL,
+};
+
+/*
+ * Appended after the .mpy data, the loader stops before it. Without RTC
+ * get_fattime() gives 0 and the files written on the board carry no date:
+ * for those the content hash tells a changed source.
+ */
+typedef struct _vfs_carbon_stamp_t {
+    uint32_t size;
+    uint16_t date;
+    uint16_t time;
+    uint32_t hash;
+    uint32_t magic;
+} vfs_carbon_stamp_t;
+
+typedef struct _vfs_carbon_reader_t {
+    FIL fp;
+    UINT len;
+    UINT pos;
+    byte buf[VFS_CARBON_CHUNK];
+} vfs_carbon_reader_t;
+
+typedef struct _vfs_carbon_writer_t {
+    FIL *fp;
+    FRESULT res;
+} vfs_carbon_writer_t;
+
+typedef struct _vfs_carbon_file_obj_t {
+    mp_obj_base_t base;
+    FIL fp;
+} vfs_carbon_file_obj_t;
+
+static mp_uint_t reader_readbyte(void *data) {
+    vfs_carbon_reader_t *reader = (vfs_carbon_reader_t *)data;
+    if (reader->pos >= reader->len) {
+        /*a short read is the end of the file*/
+        if (reader->len < sizeof(reader->buf))
+            return MP_READER_EOF;
+        if (f_read(&reader->fp, reader->buf, sizeof(reader->buf),
+                   &reader->len) != FR_OK ||
+            reader->len == 0) {
+            reader->len = 0;
+            return MP_READER_EOF;
+        }
+        reader->pos = 0;
+    }
+    return reader->buf[reader->pos++];
+}
+
+static void reader_close(void *data) {
+    vfs_carbon_reader_t *reader = (vfs_carbon_reader_t *)data;
+    f_close(&reader->fp);
+    m_del_obj(vfs_carbon_reader_t, reader);
+}
+
+void mp_reader_new_file(mp_reader_t *reader, qstr filename) {
+    const char *path = qstr_str(filename);
+    vfs_carbon_reader_t *file = m_new_obj(vfs_carbon_reader_t);
+    FRESULT res = f_open(&file->fp, path, FA_READ);
+    if (res == FR_OK) {
+        res = f_read(&file->fp, file->buf, sizeof(file->buf), &file->len);
+        if (res != FR_OK)
+            f_close(&file->fp);
+    }
+    if (res != FR_OK) {
+        m_del_obj(vfs_carbon_reader_t, file);
+        mp_raise_OSError_with_filename(vfs_carbon_errno[res], path);
+    }
+    file->pos = 0;
+    reader->data = file;
+    reader->readbyte = reader_readbyte;
+    reader->close = reader_close;
+}
+
+mp_lexer_t *mp_lexer_new_from_file(qstr filename) {
+    mp_reader_t reader;
+    mp_reader_new_file(&reader, filename);
+    return mp_lexer_new(filename, reader);
+}
+
+static bool is_source(const char *path) {
+    size_t len = strlen(path);
+    return len > 3 && strcmp(path + len - 3, ".py") == 0;
+}
+
+static uint32_t fnv1a(uint32_t hash, const byte *data, UINT len) {
+    for (UINT i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+static bool source_stamp(const char *source, vfs_carbon_stamp_t *stamp) {
+    FILINFO info;
+    if (f_stat(source, &info) != FR_OK || (info.fattrib & AM_DIR))
+        return false;
+    stamp->size = info.fsize;
+    stamp->date = info.fdate;
+    stamp->time = info.ftime;
+    stamp->hash = 0;
+    stamp->magic = VFS_CARBON_CACHE_MAGIC;
+    if (info.fdate != 0 || info.ftime != 0)
+        return true;
+
+    vfs_carbon_reader_t *file = m_new_obj(vfs_carbon_reader_t);
+    FRESULT res = f_open(&file->fp, source, FA_READ);
+    if (res == FR_OK) {
+        stamp->hash = 2166136261U;
+        do {
+            res = f_read(&file->fp, file->buf, sizeof(file->buf), &file->len);
+            stamp->hash = fnv1a(stamp->hash, file->buf, file->len);
+        } while (res == FR_OK && file->len == sizeof(file->buf));
+        f_close(&file->fp);
+    }
+    m_del_obj(vfs_carbon_reader_t, file);
+    return res == FR_OK;
+}
+
+static bool cache_matches(const char *cache, const vfs_carbon_stamp_t *stamp) {
+    vfs_carbon_stamp_t found;
+    UINT len = 0;
+    FIL *fp = m_new_obj(FIL);
+    bool matches = false;
+    if (f_open(fp, cache, FA_READ) == FR_OK) {
+        matches = f_size(fp) > sizeof(found) &&
+                  f_lseek(fp, f_size(fp) - sizeof(found)) == FR_OK &&
+                  f_read(fp, &found, sizeof(found), &len) == FR_OK &&
+                  len == sizeof(found) &&
+                  memcmp(&found, stamp, sizeof(found)) == 0;
+        f_close(fp);
+    }
+    m_del_obj(FIL, fp);
+    return matches;
+}
+
+static void cache_write_strn(void *data, const char *str, size_t len) {
+    vfs_carbon_writer_t *writer = (vfs_carbon_writer_t *)data;
+    UINT written;
+    if (writer->res != FR_OK)
+        return;
+    writer->res = f_write(writer->fp, str, len, &written);
+    if (writer->res == FR_OK && written != len)
+        writer->res = FR_DENIED; /*volume full*/
+}
+
+static bool cache_build(const char *source, const char *cache,
+                        const vfs_carbon_stamp_t *stamp) {
+    vfs_carbon_writer_t writer = {m_new_obj(FIL), FR_INT_ERR};
+    volatile bool opened = false;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(qstr_from_str(source));
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_compiled_module_t cm;
+        cm.context = m_new_obj(mp_module_context_t);
+        mp_compile_to_raw_code(&parse_tree, source_name, false, &cm);
+        writer.res = f_open(writer.fp, cache, FA_WRITE | FA_CREATE_ALWAYS);
+        if (writer.res == FR_OK) {
+            opened = true;
+            mp_print_t print = {&writer, cache_write_strn};
+            mp_raw_code_save(&cm, &print);
+            cache_write_strn(&writer, (const char *)stamp, sizeof(*stamp));
+        }
+        nlr_pop();
+    } else {
+        /*the import raises the syntax error again compiling the source*/
+        writer.res = FR_INT_ERR;
+    }
+    if (opened) {
+        FRESULT res = f_close(writer.fp);
+        if (writer.res == FR_OK)
+            writer.res = res;
+        if (writer.res != FR_OK)
+            f_unlink(cache);
+    }
+    m_del_obj(FIL, writer.fp);
+    return writer.res == FR_OK;
+}
+
+const char *mp_carbon_vfs_cache(const char *source) {
+    vfs_carbon_stamp_t stamp;
+    if (!is_source(source) || !source_stamp(source, &stamp))
+        return NULL;
+
+    /*foo.py -> foo.mpy*/
+    size_t len = strlen(source);
+    char *cache = m_new(char, len + 2);
+    memcpy(cache, source, len - 2);
+    cache[len - 2] = 'm';
+    memcpy(cache + len - 1, source + len - 2, 3);
+
+    if (cache_matches(cache, &stamp) || cache_build(source, cache, &stamp))
+        return cache;
+    m_del(char, cache, len + 2);
+    return NULL;
+}
+
+mp_import_stat_t mp_import_stat(const char *path) {
+    FILINFO info;
+    if (f_stat(path, &info) != FR_OK)
+        return MP_IMPORT_STAT_NO_EXIST;
+    if (info.fattrib & AM_DIR)
+        return MP_IMPORT_STAT_DIR;
+    /*with a valid cache the import goes on with foo.mpy*/
+    if (is_source(path) && mp_carbon_vfs_cache(path) != NULL)
+        return MP_IMPORT_STAT_NO_EXIST;
+    return MP_IMPORT_STAT_FILE;
+}
+
+static void file_obj_print(const mp_print_t *print, mp_obj_t self_in,
+                           mp_print_kind_t kind) {
+    (void)kind;
+    mp_printf(print, "<io.%s %p>", mp_obj_get_type_str(self_in),
+              MP_OBJ_TO_PTR(self_in));
+}
+
+static mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size,
+                               int *errcode) {
+    vfs_carbon_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    UINT read;
+    FRESULT res = f_read(&self->fp, buf, size, &read);
+    if (res != FR_OK) {
+        *errcode = vfs_carbon_errno[res];
+        return MP_STREAM_ERROR;
+    }
+    return read;
+}
+
+static mp_uint_t file_obj_write(mp_obj_t self_in, const void *buf,
+                                mp_uint_t size, int *errcode) {
+    vfs_carbon_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    UINT written;
+    FRESULT res = f_write(&self->fp, buf, size, &written);
+    if (res != FR_OK) {
+        *errcode = vfs_carbon_errno[res];
+        return MP_STREAM_ERROR;
+    }
+    if (written != size) {
+        *errcode = MP_ENOSPC;
+        return MP_STREAM_ERROR;
+    }
+    return written;
+}
+
+static mp_uint_t file_obj_ioctl(mp_obj_t self_in, mp_uint_t request,
+                                uintptr_t arg, int *errcode) {
+    vfs_carbon_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    FRESULT res = FR_OK;
+
+    switch (request) {
+    case MP_STREAM_SEEK: {
+        struct mp_stream_seek_t *seek = (struct mp_stream_seek_t *)arg;
+        FSIZE_t base = 0;
+        if (seek->whence == MP_SEEK_CUR)
+            base = f_tell(&self->fp);
+        else if (seek->whence == MP_SEEK_END)
+            base = f_size(&self->fp);
+        res = f_lseek(&self->fp, base + seek->offset);
+        seek->offset = f_tell(&self->fp);
+        break;
+    }
+    case MP_STREAM_FLUSH:
+        res = f_sync(&self->fp);
+        break;
+    case MP_STREAM_CLOSE:
+        /*closed already, also the finaliser gets here*/
+        if (self->fp.obj.fs != NULL)
+            res = f_close(&self->fp);
+        break;
+    default:
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+
+    if (res != FR_OK) {
+        *errcode = vfs_carbon_errno[res];
+        return MP_STREAM_ERROR;
+    }
+    return 0;
+}
+
+static const mp_rom_map_elem_t file_locals_dict_table[] = {
+    {MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj)},
+    {MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj)},
+    {MP_ROM_QSTR(MP_QSTR_readline),
+     MP_ROM_PTR(&mp_stream_unbuffered_readline_obj)},
+    {MP_ROM_QSTR(MP_QSTR_readlines),
+     MP_ROM_PTR(&mp_stream_unbuffered_readlines_obj)},
+    {MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj)},
+    {MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&mp_stream_flush_obj)},
+    {MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj)},
+    {MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&mp_stream_seek_obj)},
+    {MP_ROM_QSTR(MP_QSTR_tell), MP_ROM_PTR(&mp_stream_tell_obj)},
+    {MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&mp_stream_close_obj)},
+    {MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj)},
+    {MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&mp_stream___exit___obj)}};
+
+static MP_DEFINE_CONST_DICT(file_locals_dict, file_locals_dict_table);
+
+static const mp_stream_p_t fileio_stream_p = {
+    .read = file_obj_read,
+    .write = file_obj_write,
+    .ioctl = file_obj_ioctl,
+};
+
+static MP_DEFINE_CONST_OBJ_TYPE(vfs_carbon_fileio_type, MP_QSTR_FileIO,
+                                MP_TYPE_FLAG_ITER_IS_STREAM, print,
+                                file_obj_print, protocol, &fileio_stream_p,
+                                locals_dict, &file_locals_dict);
+
+static const mp_stream_p_t textio_stream_p = {
+    .read = file_obj_read,
+    .write = file_obj_write,
+    .ioctl = file_obj_ioctl,
+    .is_text = true,
+};
+
+static MP_DEFINE_CONST_OBJ_TYPE(vfs_carbon_textio_type, MP_QSTR_TextIOWrapper,
+                                MP_TYPE_FLAG_ITER_IS_STREAM, print,
+                                file_obj_print, protocol, &textio_stream_p,
+                                locals_dict, &file_locals_dict);
+
+mp_obj_t mp_builtin_open(size_t n_args, const mp_obj_t *args,
+                         mp_map_t *kwargs) {
+    enum { ARG_file, ARG_mode };
+    static const mp_arg_t allowed_args[] = {
+        {MP_QSTR_file,
+         MP_ARG_OBJ | MP_ARG_REQUIRED,
+         {.u_rom_obj = MP_ROM_NONE}},
+        {MP_QSTR_mode, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_r)}},
+    };
+    mp_arg_val_t parsed[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, args, kwargs, MP_ARRAY_SIZE(allowed_args),
+                     allowed_args, parsed);
+
+    const mp_obj_type_t *type = &vfs_carbon_textio_type;
+    BYTE mode = 0;
+    for (const char *m = mp_obj_str_get_str(parsed[ARG_mode].u_obj); *m;
+         m++) {
+        switch (*m) {
+        case 'r':
+            mode |= FA_READ;
+            break;
+        case 'w':
+            mode |= FA_WRITE | FA_CREATE_ALWAYS;
+            break;
+        case 'x':
+            mode |= FA_WRITE | FA_CREATE_NEW;
+            break;
+        case 'a':
+            mode |= FA_WRITE | FA_OPEN_ALWAYS;
+            break;
+        case '+':
+            mode |= FA_READ | FA_WRITE;
+            break;
+        case 'b':
+            type = &vfs_carbon_fileio_type;
+            break;
+        case 't':
+            type = &vfs_carbon_textio_type;
+            break;
+        default:
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid mode"));
+        }
+    }
+
+    const char *path = mp_obj_str_get_str(parsed[ARG_file].u_obj);
+    vfs_carbon_file_obj_t *file =
+        mp_obj_malloc_with_finaliser(vfs_carbon_file_obj_t, type);
+    FRESULT res = f_open(&file->fp, path, mode);
+    if (res == FR_OK && (mode & FA_OPEN_ALWAYS)) {
+        res = f_lseek(&file->fp, f_size(&file->fp));
+        if (res != FR_OK)
+            f_close(&file->fp);
+    }
+    /*on error FatFs leaves the object invalid, the finaliser skips it*/
+    if (res != FR_OK)
+        mp_raise_OSError_with_filename(vfs_carbon_errno[res], path);
+    return MP_OBJ_FROM_PTR(file);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(mp_builtin_open_obj, 1, mp_builtin_open);
@@ -0,0 +1,30 @@
+/**
+ ******************************************************************************
+ * @file           vfs_carbon.h
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micropython files and imports on the FatFs volume
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+#ifndef MICROPY_INCLUDED_VFS_CARBON_H
+#define MICROPY_INCLUDED_VFS_CARBON_H
+
+#include "py/obj.h"
+
+/*
+ * Path of the .mpy cache next to a .py source, compiled on the first call
+ * and again when the source changes. NULL without a usable cache, e.g. on
+ * a syntax error or a write protected card: the source is compiled then.
+ */
+const char *mp_carbon_vfs_cache(const char *source);
+
+#endif
@@ -0,0 +1,204 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          init scheduler and boot timeline test on host
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/boot_timeline.hpp>
+#include <carbon/init_scheduler.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CARBON;
+
+extern "C" void carbon_assert(unsigned long line, const char *filename,
+                              const char *message) {
+    printf("assert %s:%lu %s\n", filename, line, message);
+    abort();
+}
+
+static constexpr uint32_t STEP_MS = 30;
+
+/*worker threads, spawn fails on request to run the steps in place*/
+struct ThreadPlatform {
+    class Lock {
+    public:
+        void get() { mutex_.lock(); }
+        void release() { mutex_.unlock(); }
+
+    private:
+        std::mutex mutex_;
+    };
+
+    class Event {
+    public:
+        void signal() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_ = true;
+            cond_.notify_all();
+        }
+
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [this] { return pending_; });
+            pending_ = false;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cond_;
+        bool pending_{false};
+    };
+
+    static uint64_t nowUs() {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    static bool spawn(void (*entry)(void *), void *argument,
+                      const char * /*name*/, uint32_t /*stackWords*/) {
+        if (failSpawn)
+            return false;
+        std::thread(entry, argument).detach();
+        return true;
+    }
+
+    static void exit() {}
+
+    static void milestone(const char *name) {
+        std::lock_guard<std::mutex> lock(milestonesMutex);
+        milestones.emplace_back(name);
+    }
+
+    static inline bool failSpawn = false;
+    static inline std::mutex milestonesMutex;
+    static inline std::vector<std::string> milestones;
+};
+
+using TestScheduler = InitScheduler<ThreadPlatform>;
+
+static void sleepStep() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(STEP_MS));
+}
+
+/*a step starts after the end of the steps it comes after*/
+static bool after(TestScheduler &scheduler, uint32_t step, uint32_t before) {
+    return scheduler.timing(step).startUs >= scheduler.timing(before).endUs;
+}
+
+/*independent steps overlap, the dependent ones wait*/
+static bool concurrent() {
+    ThreadPlatform::failSpawn = false;
+    ThreadPlatform::milestones.clear();
+    /*the workers may still signal after run()*/
+    static TestScheduler scheduler;
+    auto sd = scheduler.add("sd", sleepStep);
+    auto network = scheduler.add("network", sleepStep);
+    auto heap = scheduler.add("heap", sleepStep);
+    auto ftp = scheduler.add("ftp", sleepStep, sd | network);
+    scheduler.add("script", sleepStep, ftp | heap);
+
+    auto start = ThreadPlatform::nowUs();
+    scheduler.run();
+    auto elapsedMs = (ThreadPlatform::nowUs() - start) / 1000;
+
+    bool pass = scheduler.steps() == 5;
+    pass = after(scheduler, 3, 0) && after(scheduler, 3, 1) && pass;
+    pass = after(scheduler, 4, 2) && after(scheduler, 4, 3) && pass;
+    /*three levels, not five steps in a row*/
+    pass = elapsedMs >= 3 * STEP_MS && elapsedMs < 5 * STEP_MS && pass;
+    pass = ThreadPlatform::milestones.size() == 5 &&
+           ThreadPlatform::milestones.back() == "script" && pass;
+    printf("concurrent: %lu ms, %s\n", static_cast<unsigned long>(elapsedMs),
+           pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*without workers the steps run in order in the caller*/
+static bool inPlace() {
+    ThreadPlatform::failSpawn = true;
+    ThreadPlatform::milestones.clear();
+    TestScheduler scheduler;
+    auto first = scheduler.add("first", [] {});
+    scheduler.add("second", [] {});
+    scheduler.add("third", [] {}, first);
+    scheduler.run();
+
+    bool pass = ThreadPlatform::milestones ==
+                std::vector<std::string>{"first", "second", "third"};
+    pass = after(scheduler, 2, 0) && pass;
+    printf("in place: %s\n", pass ? "ok" : "FAILED");
+    ThreadPlatform::failSpawn = false;
+    return pass;
+}
+
+/*the milestones of the previous boot survive, garbage starts from scratch*/
+static bool timeline() {
+    static BootTimeline<4> timeline;
+    std::memset(&timeline, 0xA5, sizeof(timeline));
+
+    timeline.start();
+    bool pass = timeline.boots == 1 && timeline.previousCount == 0;
+    pass = timeline.mark("reset", 0) && pass;
+    pass = timeline.mark("a name longer than the milestone", 10) && pass;
+    pass = timeline.mark("clock", 20) && pass;
+
+    /*a reset without the end of the boot*/
+    timeline.start();
+    pass = timeline.boots == 2 && timeline.previousCount == 3 &&
+           timeline.count == 0 && pass;
+    std::vector<std::string> previous;
+    timeline.forEachPrevious([&previous](const BootMilestone &milestone) {
+        previous.emplace_back(milestone.name);
+    });
+    pass = previous == std::vector<std::string>{"reset", "a name longer t",
+                                                "clock"} &&
+           pass;
+
+    for (uint32_t i = 0; i < 4; i++)
+        pass = timeline.mark("step", i) && pass;
+    pass = !timeline.mark("full", 5) && timeline.count == 4 && pass;
+
+    uint64_t last = 0;
+    timeline.forEach([&last](const BootMilestone &milestone) {
+        last = milestone.us;
+    });
+    pass = last == 3 && pass;
+
+    timeline.count = 1000; /*corrupted*/
+    timeline.start();
+    pass = timeline.boots == 1 && timeline.previousCount == 0 && pass;
+    printf("timeline: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+int main() {
+    bool pass = true;
+    pass = concurrent() && pass;
+    pass = inPlace() && pass;
+    pass = timeline() && pass;
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
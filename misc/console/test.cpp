@@ -0,0 +1,129 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          console byte ring test on host
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/byte_ring.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+
+using namespace CARBON;
+
+static uint8_t pattern(uint64_t index) {
+    return static_cast<uint8_t>((index * 7 + 3) % 251);
+}
+
+/*partial writes when full, the wrap is split in two contiguous spans*/
+static bool wrap() {
+    static ByteRing<16> ring;
+    uint8_t in[24];
+    uint8_t out[24];
+    for (uint32_t i = 0; i < sizeof(in); i++)
+        in[i] = static_cast<uint8_t>(i);
+
+    bool pass = ring.write(in, 10) == 10 && ring.read(out, 6) == 6;
+    pass = std::memcmp(out, in, 6) == 0 && pass;
+    /*4 left, 12 of 14 fit: the head wraps after 6*/
+    pass = ring.write(in + 10, 14) == 12 && ring.space() == 0 && pass;
+
+    const uint8_t *data;
+    auto first = ring.peek(data);
+    pass = first == 10 && std::memcmp(data, in + 6, 10) == 0 && pass;
+    ring.consume(first);
+    auto second = ring.peek(data);
+    pass = second == 6 && std::memcmp(data, in + 16, 6) == 0 && pass;
+
+    ring.clear();
+    pass = ring.used() == 0 && ring.peek(data) == 0 && pass;
+    pass = ring.read(out, sizeof(out)) == 0 && pass;
+    printf("wrap: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*one writer task, one reader task, every byte once and in order*/
+static bool stress() {
+    static constexpr uint64_t TOTAL = 64ULL * 1024 * 1024;
+    static ByteRing<8192> ring;
+    bool pass = true;
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([] {
+        std::mt19937 random(1);
+        uint8_t chunk[700];
+        uint64_t sent = 0;
+        while (sent < TOTAL) {
+            auto length = static_cast<uint32_t>(
+                std::min<uint64_t>(1 + random() % sizeof(chunk), TOTAL - sent));
+            for (uint32_t i = 0; i < length; i++)
+                chunk[i] = pattern(sent + i);
+            uint32_t written = 0;
+            while (written < length) {
+                written += ring.write(chunk + written, length - written);
+                if (written < length)
+                    std::this_thread::yield();
+            }
+            sent += length;
+        }
+    });
+
+    /*in place like the console sender, copying out like its reader*/
+    uint64_t received = 0;
+    uint32_t errors = 0;
+    uint8_t copy[333];
+    while (received < TOTAL) {
+        const uint8_t *data;
+        uint32_t length;
+        if (received % 2 == 0) {
+            length = ring.peek(data);
+        } else {
+            length = ring.read(copy, sizeof(copy));
+            data = copy;
+        }
+        if (length == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (uint32_t i = 0; i < length; i++)
+            errors += data[i] != pattern(received + i);
+        if (data != copy)
+            ring.consume(length);
+        received += length;
+    }
+    producer.join();
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+
+    pass = errors == 0 && ring.used() == 0;
+    printf("stress: %llu MB at %.0f MB/s, %u errors, %s\n",
+           static_cast<unsigned long long>(TOTAL >> 20),
+           static_cast<double>(TOTAL) / static_cast<double>(us), errors,
+           pass ? "ok" : "FAILED");
+    return pass;
+}
+
+int main() {
+    bool pass = true;
+    pass = wrap() && pass;
+    pass = stress() && pass;
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,433 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          copy service test and benchmark on host, the engine is a
+ *                 thread
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/copy_service.hpp>
+
+#include <host_ipc.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace CARBON;
+using namespace CARBON_HOST;
+
+/*copies in chunks as the linked list nodes of the MDMA*/
+class ThreadEngine {
+public:
+    static constexpr size_t MAX_LENGTH = 16 * 65536;
+    static constexpr size_t CHUNK = 65536;
+
+    ThreadEngine() : worker_([this] { run(); }) {}
+
+    ~ThreadEngine() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cond_.notify_all();
+        worker_.join();
+    }
+
+    void setHandler(CopyEngineHandler handler) {
+        handler_ = std::move(handler);
+    }
+
+    void start(void *dst, const void *src, size_t length) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (busy_)
+            overlaps_++;
+        busy_ = true;
+        dst_ = static_cast<uint8_t *>(dst);
+        src_ = static_cast<const uint8_t *>(src);
+        length_ = length;
+        cond_.notify_all();
+    }
+
+    /*the completions wait while held, the queue of the service fills up*/
+    void hold(bool held) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            held_ = held;
+        }
+        cond_.notify_all();
+    }
+
+    void failNext() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fail_ = true;
+    }
+
+    uint32_t overlaps() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return overlaps_;
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cond_.wait(lock, [this] { return stop_ || (busy_ && !held_); });
+            if (stop_)
+                return;
+            auto dst = dst_;
+            auto src = src_;
+            auto length = length_;
+            bool ok = !fail_;
+            fail_ = false;
+            lock.unlock();
+
+            for (size_t done = 0; ok && done < length; done += CHUNK) {
+                auto n = length - done < CHUNK ? length - done : CHUNK;
+                std::memcpy(dst + done, src + done, n);
+            }
+
+            lock.lock();
+            busy_ = false;
+            lock.unlock();
+            /*as the interrupt, the handler may start the next one*/
+            handler_(ok);
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    CopyEngineHandler handler_;
+    uint8_t *dst_{nullptr};
+    const uint8_t *src_{nullptr};
+    size_t length_{0};
+    bool busy_{false};
+    bool held_{false};
+    bool fail_{false};
+    bool stop_{false};
+    uint32_t overlaps_{0};
+    std::thread worker_;
+};
+
+/*the engine must get only whole cache lines of the destination*/
+static std::atomic<uint32_t> lineErrors{0};
+
+struct CopyPlatform {
+    static void cpuCopy(void *dst, const void *src, size_t length) {
+        if (length > 0)
+            std::memcpy(dst, src, length);
+    }
+
+    static void prepareSource(const void *, size_t) {}
+
+    static void prepareDestination(void *dst, size_t length) {
+        checkLines(dst, length);
+    }
+
+    static void completeDestination(void *dst, size_t length) {
+        checkLines(dst, length);
+    }
+
+    static void checkLines(void *dst, size_t length) {
+        if (reinterpret_cast<uintptr_t>(dst) % CACHE_ALIGNMENT != 0 ||
+            length % CACHE_ALIGNMENT != 0 || length == 0)
+            lineErrors++;
+    }
+};
+
+static constexpr uint32_t MAX_PENDING = 8;
+static constexpr size_t THRESHOLD = 4096;
+
+using HostCopyService =
+    CopyService<ThreadEngine, MutexLock, CopyPlatform, MAX_PENDING>;
+
+/*callbacks capture a single pointer, the capacity is sized for the target*/
+struct Completion {
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> order{0};
+    CopyStatus status{CopyStatus::Done};
+};
+
+static std::atomic<uint32_t> completionOrder{0};
+
+static CopyCallback completeInto(Completion *completion) {
+    return [completion](CopyStatus status) {
+        completion->status = status;
+        completion->order = ++completionOrder;
+        completion->done = true;
+    };
+}
+
+static bool waitDone(Completion &completion) {
+    for (uint32_t i = 0; i < 5000 && !completion.done; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return completion.done;
+}
+
+/*
+ * Random lengths and misalignments, several copies in flight. The content,
+ * the guard bytes around the destination and the order of the offloaded
+ * completions are verified.
+ */
+static bool randomCopies(uint32_t copies, uint32_t seed) {
+    static constexpr uint32_t SLOTS = 12;
+    static constexpr size_t MAX_LENGTH = 300 * 1024;
+    static constexpr size_t GUARD = 64;
+    static constexpr uint8_t GUARD_BYTE = 0xEE;
+
+    ThreadEngine engine;
+    HostCopyService service(engine, THRESHOLD);
+
+    std::mt19937 gen(seed);
+    std::vector<uint8_t> source(MAX_LENGTH + 64);
+    for (auto &byte : source)
+        byte = static_cast<uint8_t>(gen());
+
+    struct Slot {
+        std::vector<uint8_t> memory;
+        uint8_t *dst;
+        const uint8_t *src;
+        size_t length;
+        bool offloaded;
+        bool busy;
+        Completion completion;
+    };
+    std::vector<Slot> slots(SLOTS);
+    for (auto &slot : slots) {
+        slot.memory.resize(MAX_LENGTH + 2 * GUARD + 64);
+        slot.busy = false;
+    }
+
+    std::uniform_int_distribution<size_t> length(1, MAX_LENGTH);
+    uint32_t errors = 0;
+    uint32_t outOfOrder = 0;
+    uint32_t lastOffloadedOrder = 0;
+
+    /*retired in submission order, the offloaded ones complete in it too*/
+    auto retire = [&](Slot &slot) {
+        if (!waitDone(slot.completion)) {
+            errors++;
+            return;
+        }
+        if (slot.completion.status != CopyStatus::Done ||
+            std::memcmp(slot.dst, slot.src, slot.length) != 0)
+            errors++;
+        for (auto p = slot.dst - GUARD; p < slot.dst; p++) {
+            if (*p != GUARD_BYTE)
+                errors++;
+        }
+        auto end = slot.dst + slot.length;
+        for (auto p = end; p < end + GUARD; p++) {
+            if (*p != GUARD_BYTE)
+                errors++;
+        }
+        if (slot.offloaded) {
+            if (slot.completion.order < lastOffloadedOrder)
+                outOfOrder++;
+            lastOffloadedOrder = slot.completion.order;
+        }
+        slot.busy = false;
+    };
+
+    for (uint32_t i = 0; i < copies; i++) {
+        auto &slot = slots[i % SLOTS];
+        if (slot.busy)
+            retire(slot);
+
+        /*small copies often, the threshold is crossed in both ways*/
+        slot.length =
+            gen() % 4 == 0 ? gen() % (2 * THRESHOLD) + 1 : length(gen);
+        slot.src = source.data() + gen() % 64;
+        slot.dst = slot.memory.data() + GUARD + gen() % 64;
+        std::memset(slot.memory.data(), GUARD_BYTE, slot.memory.size());
+        slot.completion.done = false;
+        slot.busy = true;
+
+        slot.offloaded = service.copyAsync(slot.dst, slot.src, slot.length,
+                                           completeInto(&slot.completion));
+        if (!slot.offloaded && !slot.completion.done)
+            errors++;
+        if (slot.length < THRESHOLD && slot.offloaded)
+            errors++;
+    }
+
+    /*oldest first, as in the loop*/
+    for (uint32_t i = copies; i < copies + SLOTS; i++) {
+        auto &slot = slots[i % SLOTS];
+        if (slot.busy)
+            retire(slot);
+    }
+
+    auto stats = service.stats();
+    bool pass = errors == 0 && outOfOrder == 0 && lineErrors == 0 &&
+                engine.overlaps() == 0 && service.pending() == 0 &&
+                stats.offloaded > 0 && stats.cpuCopies > 0;
+    printf("random: %u copies, %u by cpu, %u offloaded, %u fall backs, max "
+           "pending %u, %s\n",
+           copies, stats.cpuCopies, stats.offloaded, stats.fallbacks,
+           stats.maxPending, pass ? "ok" : "FAILED");
+    return pass;
+}
+
+static bool threshold() {
+    ThreadEngine engine;
+    HostCopyService service(engine, THRESHOLD);
+    alignas(64) static uint8_t src[2 * THRESHOLD];
+    alignas(64) static uint8_t dst[2 * THRESHOLD];
+    for (size_t i = 0; i < sizeof(src); i++)
+        src[i] = static_cast<uint8_t>(i * 7);
+
+    Completion below, above;
+    bool belowOffloaded =
+        service.copyAsync(dst, src, THRESHOLD - 1, completeInto(&below));
+    bool belowDone = below.done;
+    bool aboveOffloaded =
+        service.copyAsync(dst, src, THRESHOLD, completeInto(&above));
+    bool pass = !belowOffloaded && belowDone && aboveOffloaded &&
+                waitDone(above) && std::memcmp(dst, src, THRESHOLD) == 0;
+
+    /*no whole line in the middle or longer than the engine can do*/
+    service.setThreshold(0);
+    Completion tiny;
+    pass = pass && !service.copyAsync(dst + 1, src, 40, completeInto(&tiny)) &&
+           tiny.done;
+    static std::vector<uint8_t> bigSrc(ThreadEngine::MAX_LENGTH + 64);
+    static std::vector<uint8_t> bigDst(ThreadEngine::MAX_LENGTH + 64);
+    Completion tooLong;
+    pass = pass &&
+           !service.copyAsync(bigDst.data(), bigSrc.data(), bigSrc.size(),
+                              completeInto(&tooLong)) &&
+           tooLong.done;
+
+    auto stats = service.stats();
+    pass = pass && stats.cpuCopies == 1 && stats.offloaded == 1 &&
+           stats.fallbacks == 2;
+    printf("threshold: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+static bool queueFull() {
+    static constexpr size_t LENGTH = 8192;
+    ThreadEngine engine;
+    HostCopyService service(engine, THRESHOLD);
+    static std::vector<uint8_t> src(LENGTH);
+    static std::vector<uint8_t> dst((MAX_PENDING + 1) * LENGTH);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<uint8_t>(i * 13);
+
+    engine.hold(true);
+    Completion completions[MAX_PENDING + 1];
+    uint32_t offloaded = 0;
+    for (uint32_t i = 0; i <= MAX_PENDING; i++) {
+        if (service.copyAsync(dst.data() + i * LENGTH, src.data(), LENGTH,
+                              completeInto(&completions[i])))
+            offloaded++;
+    }
+    bool pass = offloaded == MAX_PENDING && completions[MAX_PENDING].done &&
+                service.pending() == MAX_PENDING;
+    engine.hold(false);
+
+    for (uint32_t i = 0; i <= MAX_PENDING; i++) {
+        pass = pass && waitDone(completions[i]) &&
+               std::memcmp(dst.data() + i * LENGTH, src.data(), LENGTH) == 0;
+    }
+    auto stats = service.stats();
+    pass = pass && stats.fallbacks == 1 && stats.maxPending == MAX_PENDING;
+    printf("queue full: %u offloaded, %u fall back, %s\n", offloaded,
+           stats.fallbacks, pass ? "ok" : "FAILED");
+    return pass;
+}
+
+static bool engineError() {
+    ThreadEngine engine;
+    HostCopyService service(engine, THRESHOLD);
+    static std::vector<uint8_t> src(THRESHOLD * 2);
+    static std::vector<uint8_t> dst(THRESHOLD * 2);
+
+    engine.failNext();
+    Completion failed, next;
+    service.copyAsync(dst.data(), src.data(), src.size(),
+                      completeInto(&failed));
+    service.copyAsync(dst.data(), src.data(), src.size(), completeInto(&next));
+    bool pass = waitDone(failed) && failed.status == CopyStatus::Error &&
+                waitDone(next) && next.status == CopyStatus::Done &&
+                service.stats().errors == 1;
+    printf("engine error: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*
+ * Time the CPU is busy with a copy: the whole memcpy, or the submission and
+ * the edges when offloaded. On the host the engine is another core, on the
+ * target use copyBenchmark() to tune the threshold.
+ */
+static void benchmark() {
+    static constexpr size_t MAX_SIZE = 512 * 1024;
+    static constexpr uint32_t REPEAT = 32;
+    std::vector<uint8_t> src(MAX_SIZE + 64, 0x5A);
+    std::vector<uint8_t> dst(MAX_SIZE + 64);
+    ThreadEngine engine;
+    HostCopyService service(engine, 0);
+
+    using Clock = std::chrono::steady_clock;
+    auto ns = [](Clock::duration d) {
+        return static_cast<double>(
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(d)
+                       .count()) /
+               REPEAT;
+    };
+
+    printf("%10s %12s %12s %12s\n", "bytes", "cpu ns", "submit ns",
+           "offload ns");
+    for (size_t size = 256; size <= MAX_SIZE; size *= 2) {
+        auto start = Clock::now();
+        for (uint32_t i = 0; i < REPEAT; i++)
+            std::memcpy(dst.data() + 8, src.data() + 8, size);
+        auto cpu = Clock::now() - start;
+
+        Clock::duration submit{0};
+        Clock::duration total{0};
+        for (uint32_t i = 0; i < REPEAT; i++) {
+            Completion completion;
+            start = Clock::now();
+            service.copyAsync(dst.data() + 8, src.data() + 8, size,
+                              completeInto(&completion));
+            submit += Clock::now() - start;
+            while (!completion.done)
+                std::this_thread::yield();
+            total += Clock::now() - start;
+        }
+        printf("%10zu %12.0f %12.0f %12.0f\n", size, ns(cpu), ns(submit),
+               ns(total));
+    }
+}
+
+int main() {
+    bool pass = true;
+    pass = randomCopies(3000, 1) && pass;
+    pass = threshold() && pass;
+    pass = queueFull() && pass;
+    pass = engineError() && pass;
+    benchmark();
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
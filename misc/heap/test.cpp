@@ -0,0 +1,136 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          TLSF allocator test on host
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/tlsf.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace CARBON;
+
+struct Allocation {
+    uint8_t *pointer;
+    size_t size;
+    uint8_t pattern;
+};
+
+static void printStats(const char *name, const TlsfStats &stats) {
+    printf("%-8s total %zu used %zu high water %zu free %zu in %u blocks, "
+           "largest %zu, fragmentation %u%%, failures %u\n",
+           name, stats.totalBytes, stats.usedBytes, stats.highWaterBytes,
+           stats.freeBytes, stats.freeBlocks, stats.largestFreeBytes,
+           stats.fragmentation, stats.failures);
+}
+
+/*random alloc/free, the content of every live block is verified*/
+static bool stress(const char *name, size_t poolSize, size_t granularity,
+                   size_t maxSize, uint32_t iterations, uint32_t seed) {
+    std::vector<uint8_t> memory(poolSize + 64);
+    Tlsf heap;
+    /*unaligned pool on purpose*/
+    if (!heap.init(memory.data() + 3, poolSize, granularity)) {
+        printf("%s: init failed\n", name);
+        return false;
+    }
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<size_t> size(1, maxSize);
+    std::vector<Allocation> live;
+    uint32_t errors = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        if (live.empty() || gen() % 100 < 50) {
+            auto n = size(gen);
+            auto pointer = static_cast<uint8_t *>(heap.allocate(n));
+            if (pointer == nullptr)
+                continue;
+            if (reinterpret_cast<uintptr_t>(pointer) % granularity != 0 ||
+                heap.usableSize(pointer) < n || !heap.contains(pointer))
+                errors++;
+            auto pattern = static_cast<uint8_t>(gen());
+            std::memset(pointer, pattern, n);
+            live.push_back({pointer, n, pattern});
+        } else {
+            auto index = gen() % live.size();
+            auto &allocation = live[index];
+            for (size_t j = 0; j < allocation.size; j++) {
+                if (allocation.pointer[j] != allocation.pattern) {
+                    errors++;
+                    break;
+                }
+            }
+            heap.free(allocation.pointer);
+            allocation = live.back();
+            live.pop_back();
+        }
+        if (i % 1024 == 0 && !heap.check()) {
+            printf("%s: corrupted at %u\n", name, i);
+            return false;
+        }
+    }
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+
+    printStats(name, heap.stats());
+    for (auto &allocation : live)
+        heap.free(allocation.pointer);
+
+    /*everything merged back in a single block*/
+    auto stats = heap.stats();
+    bool pass = errors == 0 && heap.check() && stats.usedBytes == 0 &&
+                stats.freeBlocks == 1 && stats.freeBytes == stats.totalBytes;
+    printf("%-8s %u operations in %ld us, %s\n", name, iterations,
+           static_cast<long>(us), pass ? "ok" : "FAILED");
+    return pass;
+}
+
+static bool exhaustion() {
+    alignas(64) static uint8_t memory[4096];
+    Tlsf heap;
+    if (!heap.init(memory, sizeof(memory), 32))
+        return false;
+    std::vector<void *> blocks;
+    void *pointer;
+    while ((pointer = heap.allocate(100)) != nullptr)
+        blocks.push_back(pointer);
+    auto stats = heap.stats();
+    bool pass = !blocks.empty() && stats.failures == 1 &&
+                heap.allocate(sizeof(memory)) == nullptr;
+    for (auto block : blocks)
+        heap.free(block);
+    pass = pass && heap.check() && heap.stats().freeBlocks == 1;
+    printf("exhaustion: %zu blocks of 100 bytes in 4 KB, %s\n", blocks.size(),
+           pass ? "ok" : "FAILED");
+    return pass;
+}
+
+int main() {
+    bool pass = true;
+    pass = stress("fast", 128 * 1024, 8, 512, 200000, 1) && pass;
+    pass = stress("dma", 32 * 1024, 32, 1600, 200000, 2) && pass;
+    pass = stress("bulk", 4 * 1024 * 1024, 8, 64 * 1024, 100000, 3) && pass;
+    pass = exhaustion() && pass;
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,135 @@
+/**
+ ******************************************************************************
+ * @file           host_ipc.hpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          host replacements of the HSEM doorbell and of the IRQ lock
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <carbon/mailbox.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace CARBON_HOST {
+
+/*plays the role of one HSEM and of the release interrupt*/
+class HostSignal {
+public:
+    void notify() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        count_++;
+        cond_.notify_all();
+    }
+
+    uint64_t count() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return count_;
+    }
+
+    bool waitChange(uint64_t from, uint32_t timeoutMs) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cond_.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                              [this, from] { return count_ != from; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    uint64_t count_{0};
+};
+
+/*the ring of one end wakes the thread waiting on the other end*/
+class ThreadDoorbell {
+public:
+    ThreadDoorbell(HostSignal &ringSignal, HostSignal &listenSignal)
+        : ring_(ringSignal), listen_(listenSignal) {}
+
+    void ring() { ring_.notify(); }
+
+    void prepare() { prepared_ = listen_.count(); }
+
+    void cancel() {}
+
+    bool wait(uint32_t timeoutMs) {
+        return listen_.waitChange(prepared_, timeoutMs);
+    }
+
+    static uint32_t nowMs() {
+        return static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+private:
+    HostSignal &ring_;
+    HostSignal &listen_;
+    uint64_t prepared_{0};
+};
+
+class MutexLock {
+public:
+    void get() { mutex_.lock(); }
+
+    void release() { mutex_.unlock(); }
+
+private:
+    std::mutex mutex_;
+};
+
+using HostMailbox = CARBON::Mailbox<ThreadDoorbell, MutexLock>;
+
+/*offload platform, a single clock and coherent memory*/
+struct HostPlatform {
+    static uint64_t nowUs() {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    static void yield() { std::this_thread::yield(); }
+
+    static bool reachable(uintptr_t, uint32_t) { return true; }
+
+    static void clean(uintptr_t, uint32_t) {}
+
+    static void invalidate(uintptr_t, uint32_t) {}
+};
+
+/*the two ends of a channel, as placed in the shared section on target*/
+struct HostChannel {
+    HostChannel()
+        : cm7Doorbell(doorbellCM4, doorbellCM7),
+          cm4Doorbell(doorbellCM7, doorbellCM4),
+          cm7(shared.toCM4, shared.toCM7, cm7Doorbell),
+          cm4(shared.toCM7, shared.toCM4, cm4Doorbell) {
+        shared.init();
+    }
+
+    CARBON::MailboxShared shared;
+    HostSignal doorbellCM4; /*rung by the CM7 end*/
+    HostSignal doorbellCM7; /*rung by the CM4 end*/
+    ThreadDoorbell cm7Doorbell;
+    ThreadDoorbell cm4Doorbell;
+    HostMailbox cm7;
+    HostMailbox cm4;
+};
+
+} // namespace CARBON_HOST
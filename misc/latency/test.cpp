@@ -0,0 +1,160 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          latency histogram test on host
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/latency_histogram.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace CARBON;
+
+/*every value is inside the bounds of its bucket, the buckets are ordered*/
+static bool buckets() {
+    bool pass = true;
+    uint32_t previous = 0;
+    for (uint32_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+        auto low = latencyBucketLow(bucket);
+        auto high = latencyBucketHigh(bucket);
+        if (bucket > 0 && low != previous + 1)
+            pass = false;
+        if (latencyBucket(low) != bucket || latencyBucket(high) != bucket)
+            pass = false;
+        /*12.5% resolution above the linear range*/
+        if (bucket < LATENCY_BUCKETS - 1 &&
+            uint64_t{high - low + 1} * 8 > uint64_t{low} + 8)
+            pass = false;
+        previous = high;
+    }
+    std::mt19937 random(1);
+    for (uint32_t i = 0; i < 100000; i++) {
+        auto value = static_cast<uint32_t>(random()) >> (random() % 32);
+        auto bucket = latencyBucket(value);
+        if (value < latencyBucketLow(bucket) ||
+            value > latencyBucketHigh(bucket))
+            pass = false;
+    }
+    printf("buckets: %u, %s\n", LATENCY_BUCKETS, pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*the percentiles bound the exact ones within a bucket*/
+static bool percentiles() {
+    std::mt19937 random(2);
+    std::lognormal_distribution<double> distribution(6.0, 1.0);
+    LatencyHistogram histogram;
+    std::vector<uint32_t> values;
+    for (uint32_t i = 0; i < 20000; i++) {
+        auto value = static_cast<uint32_t>(distribution(random));
+        values.push_back(value);
+        histogram.record(value);
+    }
+    std::sort(values.begin(), values.end());
+
+    bool pass = histogram.count() == values.size() &&
+                histogram.max() == values.back();
+    for (uint32_t percent : {1U, 50U, 90U, 99U, 100U}) {
+        auto exact = values[(values.size() * percent + 99) / 100 - 1];
+        auto estimate = histogram.percentile(percent);
+        bool ok = estimate >= exact && estimate <= latencyBucketHigh(
+                                                       latencyBucket(exact));
+        printf("p%u: exact %u, histogram %u\n", percent, exact, estimate);
+        pass = ok && pass;
+    }
+
+    auto summary = histogram.summary();
+    pass = summary.p99 == histogram.percentile(99) && pass;
+    histogram.reset();
+    pass = histogram.count() == 0 && histogram.percentile(99) == 0 && pass;
+
+    histogram.record(UINT32_MAX);
+    pass = histogram.percentile(50) == UINT32_MAX && pass;
+    printf("percentiles: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*the histograms of several writers, as one of all their samples*/
+static bool merge() {
+    LatencyHistogram first;
+    LatencyHistogram second;
+    LatencyHistogram all;
+    for (uint32_t i = 0; i < 1000; i++) {
+        first.record(i);
+        all.record(i);
+    }
+    for (uint32_t i = 0; i < 500; i++) {
+        second.record(5000 + i);
+        all.record(5000 + i);
+    }
+    LatencyHistogram merged;
+    merged.merge(first);
+    merged.merge(second);
+
+    bool pass = merged.count() == all.count() && merged.max() == all.max();
+    for (uint32_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+        pass = merged.count(bucket) == all.count(bucket) && pass;
+    for (uint32_t percent : {50U, 90U, 99U})
+        pass = merged.percentile(percent) == all.percentile(percent) && pass;
+    printf("merge: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*one writer and a reader, the reader never sees more than written*/
+static bool concurrent() {
+    static constexpr uint32_t SAMPLES = 2000000;
+    LatencyHistogram histogram;
+    std::atomic<bool> done{false};
+    bool pass = true;
+
+    std::thread reader([&] {
+        uint32_t last = 0;
+        while (!done.load()) {
+            auto count = histogram.count();
+            if (count < last || count > SAMPLES)
+                pass = false;
+            last = count;
+            if (histogram.percentile(99) > 1000)
+                pass = false;
+        }
+    });
+    for (uint32_t i = 0; i < SAMPLES; i++)
+        histogram.record(i % 1000);
+    done = true;
+    reader.join();
+
+    uint32_t total = 0;
+    for (uint32_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+        total += histogram.count(bucket);
+    pass = total == SAMPLES && histogram.count() == SAMPLES && pass;
+    printf("concurrent: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+int main() {
+    bool pass = true;
+    pass = buckets() && pass;
+    pass = percentiles() && pass;
+    pass = merge() && pass;
+    pass = concurrent() && pass;
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,201 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          mailbox test on host, both ends run as threads
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <host_ipc.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <thread>
+
+using namespace CARBON;
+using namespace CARBON_HOST;
+
+enum class TestType : uint16_t { Ping, Add, Tick };
+
+struct AddRequest {
+    uint32_t a;
+    uint32_t b;
+};
+
+static constexpr uint32_t N_PINGS = 2000;
+static constexpr uint32_t N_ADDS = 100000;
+static constexpr uint32_t BATCH = 8;
+static constexpr uint32_t TICK_PERIOD = 1000; /*CM4 event every N requests*/
+
+static std::atomic<bool> stop{false};
+
+static void cm4Worker(HostMailbox &mailbox) {
+    MailboxMessage message;
+    uint32_t requests = 0;
+    while (!stop) {
+        if (!mailbox.receive(message, 20))
+            continue;
+        switch (static_cast<TestType>(message.type)) {
+        case TestType::Ping:
+            mailbox.respond(message, 0, message.payload, message.length);
+            break;
+        case TestType::Add: {
+            AddRequest add;
+            uint32_t sum = 0;
+            uint32_t status = message.getPayload(add) ? 0 : 1;
+            if (status == 0)
+                sum = add.a + add.b;
+            while (!mailbox.respond(message, status, &sum, sizeof(sum)))
+                std::this_thread::yield();
+            break;
+        }
+        default:
+            break;
+        }
+        if (++requests % TICK_PERIOD == 0) {
+            while (!mailbox.postEvent(static_cast<uint16_t>(TestType::Tick),
+                                      &requests, sizeof(requests)))
+                std::this_thread::yield();
+        }
+    }
+}
+
+static bool testPing(HostMailbox &mailbox, uint32_t &ticks) {
+    using namespace std::chrono;
+    auto start = steady_clock::now();
+    for (uint32_t i = 0; i < N_PINGS; i++) {
+        MailboxMessage response;
+        if (!mailbox.call(
+                static_cast<uint16_t>(TestType::Ping), &i, sizeof(i), response,
+                1000, [&ticks](const MailboxMessage &message) {
+                    if (message.type == static_cast<uint16_t>(TestType::Tick))
+                        ticks++;
+                })) {
+            printf("ping %u: no response\n", i);
+            return false;
+        }
+        uint32_t echo;
+        if (!response.getPayload(echo) || echo != i) {
+            printf("ping %u: wrong echo\n", i);
+            return false;
+        }
+    }
+    auto us = duration_cast<microseconds>(steady_clock::now() - start).count();
+    printf("ping: %u round trips, %.2f us each\n", N_PINGS,
+           static_cast<double>(us) / N_PINGS);
+    return true;
+}
+
+static bool testBatch(HostMailbox &mailbox, uint32_t &ticks) {
+    using namespace std::chrono;
+    std::map<uint32_t, uint32_t> expected;
+    uint32_t sent = 0;
+    uint32_t answered = 0;
+    uint32_t errors = 0;
+    auto start = steady_clock::now();
+    auto lastProgress = start;
+
+    while (answered < N_ADDS) {
+        /*post a batch, a single doorbell for all*/
+        if (sent < N_ADDS && expected.size() < 4 * BATCH) {
+            MailboxMessage batch[BATCH];
+            uint32_t n = 0;
+            for (; n < BATCH && sent + n < N_ADDS; n++) {
+                auto &message = batch[n];
+                message = {};
+                message.type = static_cast<uint16_t>(TestType::Add);
+                message.kind = MailboxKind::Request;
+                message.correlationId = sent + n + 1;
+                message.setPayload(AddRequest{sent + n, 3 * (sent + n)});
+            }
+            auto posted = mailbox.postBatch(batch, n);
+            for (uint32_t i = 0; i < posted; i++) {
+                expected[batch[i].correlationId] = 4 * (sent + i);
+            }
+            sent += posted;
+        }
+
+        MailboxMessage responses[BATCH];
+        auto n = mailbox.receiveBatch(responses, BATCH);
+        if (n == 0) {
+            MailboxMessage message;
+            if (mailbox.receive(message, 10)) {
+                responses[0] = message;
+                n = 1;
+            }
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            auto &message = responses[i];
+            if (message.kind == MailboxKind::Event) {
+                ticks++;
+                continue;
+            }
+            auto it = expected.find(message.correlationId);
+            uint32_t sum;
+            if (it == expected.end() || message.status != 0 ||
+                !message.getPayload(sum) || sum != it->second) {
+                errors++;
+            } else {
+                expected.erase(it);
+            }
+            answered++;
+            lastProgress = steady_clock::now();
+        }
+        if (steady_clock::now() - lastProgress > seconds(2)) {
+            printf("batch: stalled at %u/%u\n", answered, N_ADDS);
+            return false;
+        }
+    }
+
+    auto us = duration_cast<microseconds>(steady_clock::now() - start).count();
+    printf("batch: %u requests in batches of %u, %.2f us each, %u errors\n",
+           N_ADDS, BATCH, static_cast<double>(us) / N_ADDS, errors);
+    return errors == 0 && expected.empty();
+}
+
+int main() {
+    HostChannel channel;
+    std::thread cm4(cm4Worker, std::ref(channel.cm4));
+
+    uint32_t ticks = 0;
+    bool pass = testPing(channel.cm7, ticks) && testBatch(channel.cm7, ticks);
+
+    stop = true;
+    cm4.join();
+
+    /*drain the last events*/
+    MailboxMessage message;
+    while (channel.cm7.tryReceive(message)) {
+        if (message.kind == MailboxKind::Event)
+            ticks++;
+    }
+
+    auto expectedTicks = (N_PINGS + N_ADDS) / TICK_PERIOD;
+    const auto &cm7 = channel.cm7.stats();
+    const auto &cm4Stats = channel.cm4.stats();
+    printf("CM7 end: posted %u received %u full %u doorbells %u\n", cm7.posted,
+           cm7.received, cm7.full, cm7.doorbells);
+    printf("CM4 end: posted %u received %u full %u doorbells %u\n",
+           cm4Stats.posted, cm4Stats.received, cm4Stats.full,
+           cm4Stats.doorbells);
+    printf("events: %u of %u\n", ticks, expectedTicks);
+
+    pass = pass && ticks == expectedTicks && cm7.posted == cm4Stats.received &&
+           cm4Stats.posted == cm7.received && cm7.doorbells < cm7.posted;
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
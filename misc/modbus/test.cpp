@@ -0,0 +1,117 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          Modbus TCP frames against known ones, on host
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/modbus_frame.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace CARBON;
+
+/*the read holding registers example of the Modbus specification*/
+static const uint8_t READ_REQUEST[] = {0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+                                       0x11, 0x03, 0x00, 0x6B, 0x00, 0x03};
+static const uint8_t READ_REPLY[] = {0x00, 0x01, 0x00, 0x00, 0x00,
+                                     0x09, 0x11, 0x03, 0x06, 0x02,
+                                     0x2B, 0x00, 0x00, 0x00, 0x64};
+
+static bool encode() {
+    uint8_t frame[MODBUS_REQUEST_SIZE];
+    std::memset(frame, 0xA5, sizeof(frame));
+    auto size = modbusEncodeRequest(frame, 1, 0x11, 0x03, 0x006B, 3);
+    bool pass = size == sizeof(READ_REQUEST) &&
+                std::memcmp(frame, READ_REQUEST, size) == 0;
+
+    /*write single register, every field above 255*/
+    static const uint8_t write[] = {0x12, 0x34, 0x00, 0x00, 0x00, 0x06,
+                                    0x01, 0x06, 0x01, 0x02, 0xAB, 0xCD};
+    size = modbusEncodeRequest(frame, 0x1234, 0x01, 0x06, 0x0102, 0xABCD);
+    pass = size == sizeof(write) && std::memcmp(frame, write, size) == 0 &&
+           pass;
+    printf("encode: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+static bool decodeRead() {
+    uint16_t values[3]{};
+    bool pass = modbusFrameSize(READ_REPLY, 5) == 0 &&
+                modbusFrameSize(READ_REPLY, 6) == sizeof(READ_REPLY);
+    pass = modbusDecodeRead(READ_REPLY, sizeof(READ_REPLY), READ_REQUEST,
+                            values, 3) &&
+           pass;
+    pass = values[0] == 0x022B && values[1] == 0 && values[2] == 0x64 && pass;
+
+    /*every altered field is refused*/
+    uint8_t reply[sizeof(READ_REPLY)];
+    struct {
+        size_t offset;
+        uint8_t value;
+    } const faults[] = {
+        {1, 0x02}, /*transaction*/
+        {3, 0x01}, /*protocol*/
+        {5, 0x0A}, /*length*/
+        {6, 0x12}, /*unit*/
+        {7, 0x04}, /*function*/
+        {8, 0x04}, /*byte count*/
+    };
+    for (auto &fault : faults) {
+        std::memcpy(reply, READ_REPLY, sizeof(reply));
+        reply[fault.offset] = fault.value;
+        if (modbusDecodeRead(reply, sizeof(reply), READ_REQUEST, values, 3))
+            pass = false;
+    }
+    /*truncated, and not the quantity of the request*/
+    pass = !modbusDecodeRead(READ_REPLY, sizeof(READ_REPLY) - 1, READ_REQUEST,
+                             values, 3) &&
+           !modbusDecodeRead(READ_REPLY, sizeof(READ_REPLY), READ_REQUEST,
+                             values, 2) &&
+           pass;
+
+    /*illegal data address exception*/
+    static const uint8_t exception[] = {0x00, 0x01, 0x00, 0x00, 0x00,
+                                        0x03, 0x11, 0x03 | MODBUS_EXCEPTION,
+                                        0x02};
+    pass = !modbusDecodeRead(exception, sizeof(exception), READ_REQUEST,
+                             values, 3) &&
+           pass;
+    printf("decode read: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+static bool decodeWrite() {
+    uint8_t request[MODBUS_REQUEST_SIZE];
+    modbusEncodeRequest(request, 7, 0x11, 0x06, 0x0001, 0x0003);
+    uint8_t reply[MODBUS_REQUEST_SIZE];
+    std::memcpy(reply, request, sizeof(reply));
+    bool pass = modbusDecodeWrite(reply, sizeof(reply), request);
+    pass = !modbusDecodeWrite(reply, sizeof(reply) - 1, request) && pass;
+    reply[11] = 0x04;
+    pass = !modbusDecodeWrite(reply, sizeof(reply), request) && pass;
+    printf("decode write: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+int main() {
+    bool pass = true;
+    pass = encode() && pass;
+    pass = decodeRead() && pass;
+    pass = decodeWrite() && pass;
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,477 @@
+/**
+ ******************************************************************************
+ * @file           net_bench.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          host client of the network benchmark of the board
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/net_bench_format.hpp>
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * One test against the service of the board, the result as JSON on stdout,
+ * the views of both ends:
+ *   net_bench --host 192.168.1.10 --mode tcp-rx --sink sd --time 10
+ * Modes are named from the board: tcp-rx, the board receives.
+ */
+
+using namespace CARBON;
+
+static constexpr uint16_t DEFAULT_UDP_PORT = 5203;
+static constexpr uint32_t REPORT_GRACE = 10000; /*ms, the board finishing*/
+static constexpr uint32_t UDP_IDLE = 1000; /*ms, the end of the datagrams*/
+
+struct Options {
+    std::string host{"192.168.1.10"};
+    NetBenchMode mode{NetBenchMode::TcpRx};
+    NetBenchSink sink{NetBenchSink::Null};
+    uint32_t bufferSize{0}; /*0, the default of the mode*/
+    uint32_t durationMs{10000};
+    uint32_t rateKbps{0};
+    uint16_t udpPort{DEFAULT_UDP_PORT};
+};
+
+/*the client side of a test*/
+struct ClientView {
+    uint64_t txBytes{0};
+    uint64_t rxBytes{0};
+    uint64_t elapsedUs{0};
+    uint32_t retransmits{0};
+    uint32_t datagrams{0};
+    uint32_t lost{0};
+    uint32_t outOfOrder{0};
+    uint32_t jitterUs{0};
+};
+
+static const char *modeNames[] = {"tcp-rx", "tcp-tx", "tcp-bidir", "udp-rx",
+                                  "udp-tx"};
+static const char *sinkNames[] = {"null", "sdram", "sd"};
+static const char *statusNames[] = {"ok",           "bad request",
+                                    "no memory",    "no sd card",
+                                    "no connection", "network error",
+                                    "sink error"};
+
+static uint64_t nowUs() {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(
+               steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static void usage(const char *name) {
+    fprintf(stderr,
+            "usage: %s [--host address] [--mode tcp-rx|tcp-tx|tcp-bidir|"
+            "udp-rx|udp-tx]\n"
+            "          [--sink null|sdram|sd] [--buffer bytes] "
+            "[--time seconds]\n"
+            "          [--rate kbit/s] [--udp-port port]\n",
+            name);
+    exit(2);
+}
+
+template <typename T, size_t N>
+static bool lookup(const char *(&names)[N], const char *name, T &value) {
+    for (size_t i = 0; i < N; i++) {
+        if (strcmp(names[i], name) == 0) {
+            value = static_cast<T>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+static Options parse(int argc, char **argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (i + 1 >= argc)
+            usage(argv[0]);
+        const char *value = argv[++i];
+        if (option == "--host")
+            options.host = value;
+        else if (option == "--mode") {
+            if (!lookup(modeNames, value, options.mode))
+                usage(argv[0]);
+        } else if (option == "--sink") {
+            if (!lookup(sinkNames, value, options.sink))
+                usage(argv[0]);
+        } else if (option == "--buffer")
+            options.bufferSize = static_cast<uint32_t>(atoi(value));
+        else if (option == "--time")
+            options.durationMs = static_cast<uint32_t>(atof(value) * 1000);
+        else if (option == "--rate")
+            options.rateKbps = static_cast<uint32_t>(atoi(value));
+        else if (option == "--udp-port")
+            options.udpPort = static_cast<uint16_t>(atoi(value));
+        else
+            usage(argv[0]);
+    }
+    bool udp = options.mode == NetBenchMode::UdpRx ||
+               options.mode == NetBenchMode::UdpTx;
+    if (options.bufferSize == 0)
+        options.bufferSize = udp ? 1024 : 8192;
+    return options;
+}
+
+static bool resolve(const std::string &host, uint16_t port,
+                    sockaddr_in &address) {
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    addrinfo *result;
+    if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0)
+        return false;
+    address = *reinterpret_cast<sockaddr_in *>(result->ai_addr);
+    address.sin_port = htons(port);
+    freeaddrinfo(result);
+    return true;
+}
+
+static void setTimeout(int fd, uint32_t ms) {
+    timeval tv{static_cast<time_t>(ms / 1000),
+               static_cast<suseconds_t>(ms % 1000 * 1000)};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+}
+
+static int connectTo(const sockaddr_in &address, uint16_t port) {
+    sockaddr_in to = address;
+    to.sin_port = htons(port);
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0)
+        return -1;
+    if (connect(fd, reinterpret_cast<const sockaddr *>(&to), sizeof(to)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool readAll(int fd, void *data, size_t length) {
+    auto bytes = static_cast<uint8_t *>(data);
+    while (length > 0) {
+        ssize_t n = recv(fd, bytes, length, 0);
+        if (n <= 0)
+            return false;
+        bytes += n;
+        length -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+static uint32_t retransmits(int fd) {
+    tcp_info info{};
+    socklen_t length = sizeof(info);
+    if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &length) < 0)
+        return 0;
+    return info.tcpi_total_retrans;
+}
+
+static uint64_t tcpSend(int fd, uint32_t bufferSize, uint32_t durationMs,
+                        uint32_t &retransmitted) {
+    std::vector<uint8_t> buffer(bufferSize);
+    for (uint32_t i = 0; i < bufferSize; i++)
+        buffer[i] = static_cast<uint8_t>(i);
+    uint64_t sent = 0;
+    uint64_t end = nowUs() + durationMs * 1000ULL;
+    while (nowUs() < end) {
+        ssize_t n = send(fd, buffer.data(), buffer.size(), MSG_NOSIGNAL);
+        if (n <= 0)
+            break;
+        sent += static_cast<uint64_t>(n);
+    }
+    retransmitted += retransmits(fd);
+    shutdown(fd, SHUT_WR);
+    /*until the board has it all, closing early would reset it*/
+    uint8_t drain[256];
+    setTimeout(fd, REPORT_GRACE);
+    while (recv(fd, drain, sizeof(drain), 0) > 0) {
+    }
+    return sent;
+}
+
+static uint64_t tcpReceive(int fd, uint32_t durationMs) {
+    std::vector<uint8_t> buffer(65536);
+    uint64_t received = 0;
+    setTimeout(fd, durationMs + REPORT_GRACE);
+    while (1) {
+        ssize_t n = recv(fd, buffer.data(), buffer.size(), 0);
+        if (n <= 0)
+            break;
+        received += static_cast<uint64_t>(n);
+    }
+    return received;
+}
+
+static void udpSend(int fd, const sockaddr_in &to, const Options &options,
+                    ClientView &view) {
+    std::vector<uint8_t> buffer(options.bufferSize);
+    for (uint32_t i = 0; i < options.bufferSize; i++)
+        buffer[i] = static_cast<uint8_t>(i);
+    uint64_t start = nowUs();
+    uint64_t end = start + options.durationMs * 1000ULL;
+    uint64_t intervalUs =
+        options.rateKbps ? options.bufferSize * 8000ULL / options.rateKbps : 0;
+    NetBenchDatagram head;
+    for (uint64_t next = start; nowUs() < end; next += intervalUs) {
+        uint64_t now = nowUs();
+        if (next > now)
+            std::this_thread::sleep_for(std::chrono::microseconds(next - now));
+        head.sentUs = static_cast<uint32_t>(nowUs());
+        memcpy(buffer.data(), &head, sizeof(head));
+        if (sendto(fd, buffer.data(), buffer.size(), 0,
+                   reinterpret_cast<const sockaddr *>(&to), sizeof(to)) > 0) {
+            view.txBytes += buffer.size();
+            view.datagrams++;
+        } else {
+            view.lost++;
+        }
+        head.sequence++;
+    }
+}
+
+/*the same accounting as the board, RFC 3550 jitter scaled by 16*/
+static void udpReceive(int fd, const Options &options, ClientView &view) {
+    uint64_t start = 0;
+    std::vector<uint8_t> buffer(65536);
+    uint32_t next = 0;
+    int32_t lastTransit = 0;
+    uint32_t jitter = 0;
+    setTimeout(fd, options.durationMs + REPORT_GRACE);
+    while (1) {
+        ssize_t n = recv(fd, buffer.data(), buffer.size(), 0);
+        if (n <= 0)
+            break;
+        uint64_t now = nowUs();
+        if (view.datagrams == 0) {
+            start = now;
+            setTimeout(fd, UDP_IDLE);
+        }
+        view.elapsedUs = now - start;
+        view.rxBytes += static_cast<uint64_t>(n);
+        if (static_cast<size_t>(n) >= sizeof(NetBenchDatagram)) {
+            NetBenchDatagram head;
+            memcpy(&head, buffer.data(), sizeof(head));
+            if (head.sequence >= next) {
+                view.lost += head.sequence - next;
+                next = head.sequence + 1;
+            } else {
+                view.outOfOrder++;
+                if (view.lost > 0)
+                    view.lost--;
+            }
+            auto transit =
+                static_cast<int32_t>(static_cast<uint32_t>(now) - head.sentUs);
+            if (view.datagrams > 0) {
+                int32_t d = transit - lastTransit;
+                uint32_t magnitude = static_cast<uint32_t>(d < 0 ? -d : d);
+                jitter += magnitude - ((jitter + 8) >> 4);
+            }
+            lastTransit = transit;
+        }
+        view.datagrams++;
+    }
+    view.jitterUs = jitter >> 4;
+}
+
+static double mbps(uint64_t bytes, uint64_t us) {
+    return us ? static_cast<double>(bytes) * 8 / static_cast<double>(us) : 0;
+}
+
+static void print(const Options &options, const ClientView &client,
+                  const NetBenchReport &board) {
+    auto status = static_cast<unsigned>(board.status);
+    printf("{\n");
+    printf("  \"mode\": \"%s\",\n", modeNames[static_cast<int>(options.mode)]);
+    printf("  \"sink\": \"%s\",\n", sinkNames[static_cast<int>(options.sink)]);
+    printf("  \"buffer\": %u,\n", options.bufferSize);
+    printf("  \"duration_ms\": %u,\n", options.durationMs);
+    printf("  \"status\": \"%s\",\n",
+           status < std::size(statusNames) ? statusNames[status] : "unknown");
+    printf("  \"client\": {\n");
+    printf("    \"tx_bytes\": %llu,\n",
+           static_cast<unsigned long long>(client.txBytes));
+    printf("    \"rx_bytes\": %llu,\n",
+           static_cast<unsigned long long>(client.rxBytes));
+    printf("    \"elapsed_us\": %llu,\n",
+           static_cast<unsigned long long>(client.elapsedUs));
+    printf("    \"tx_mbps\": %.3f,\n", mbps(client.txBytes, client.elapsedUs));
+    printf("    \"rx_mbps\": %.3f,\n", mbps(client.rxBytes, client.elapsedUs));
+    printf("    \"retransmits\": %u,\n", client.retransmits);
+    printf("    \"datagrams\": %u,\n", client.datagrams);
+    printf("    \"lost\": %u,\n", client.lost);
+    printf("    \"out_of_order\": %u,\n", client.outOfOrder);
+    printf("    \"jitter_us\": %u\n", client.jitterUs);
+    printf("  },\n");
+    printf("  \"board\": {\n");
+    printf("    \"tx_bytes\": %llu,\n",
+           static_cast<unsigned long long>(board.txBytes));
+    printf("    \"rx_bytes\": %llu,\n",
+           static_cast<unsigned long long>(board.rxBytes));
+    printf("    \"elapsed_us\": %u,\n", board.elapsedUs);
+    printf("    \"tx_mbps\": %.3f,\n", mbps(board.txBytes, board.elapsedUs));
+    printf("    \"rx_mbps\": %.3f,\n", mbps(board.rxBytes, board.elapsedUs));
+    if (board.cpuLoadPermille == NET_BENCH_CPU_UNKNOWN)
+        printf("    \"cpu_load\": null,\n");
+    else
+        printf("    \"cpu_load\": %.1f,\n", board.cpuLoadPermille / 10.0);
+    printf("    \"retransmits\": %u,\n", board.retransmits);
+    printf("    \"tcp_drops\": %u,\n", board.tcpDrops);
+    printf("    \"udp_drops\": %u,\n", board.udpDrops);
+    printf("    \"link_drops\": %u,\n", board.linkDrops);
+    printf("    \"datagrams\": %u,\n", board.datagrams);
+    printf("    \"lost\": %u,\n", board.lost);
+    printf("    \"out_of_order\": %u,\n", board.outOfOrder);
+    printf("    \"jitter_us\": %u,\n", board.jitterUs);
+    printf("    \"sink_errors\": %u,\n", board.sinkErrors);
+    printf("    \"sink_max_write_us\": %u\n", board.sinkMaxWriteUs);
+    printf("  }\n");
+    printf("}\n");
+}
+
+int main(int argc, char **argv) {
+    Options options = parse(argc, argv);
+    sockaddr_in board;
+    if (!resolve(options.host, NET_BENCH_CONTROL_PORT, board)) {
+        fprintf(stderr, "cannot resolve %s\n", options.host.c_str());
+        return 1;
+    }
+
+    /*bound before the request, the board sends right after its answer*/
+    int udp = -1;
+    if (options.mode == NetBenchMode::UdpRx ||
+        options.mode == NetBenchMode::UdpTx) {
+        udp = socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in local{};
+        local.sin_family = AF_INET;
+        local.sin_port = htons(options.udpPort);
+        int size = 4 * 1024 * 1024;
+        setsockopt(udp, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+        if (options.mode == NetBenchMode::UdpTx &&
+            bind(udp, reinterpret_cast<sockaddr *>(&local), sizeof(local)) <
+                0) {
+            perror("udp port");
+            return 1;
+        }
+    }
+
+    int control = connectTo(board, NET_BENCH_CONTROL_PORT);
+    if (control < 0) {
+        fprintf(stderr, "cannot connect to %s:%u\n", options.host.c_str(),
+                NET_BENCH_CONTROL_PORT);
+        return 1;
+    }
+    setTimeout(control, REPORT_GRACE);
+
+    NetBenchRequest request;
+    request.mode = options.mode;
+    request.sink = options.sink;
+    request.udpPort = options.udpPort;
+    request.bufferSize = options.bufferSize;
+    request.durationMs = options.durationMs;
+    request.udpRateKbps = options.rateKbps;
+    NetBenchReport report;
+    if (send(control, &request, sizeof(request), MSG_NOSIGNAL) < 0 ||
+        !readAll(control, &report, sizeof(report)) ||
+        report.magic != NET_BENCH_MAGIC) {
+        fprintf(stderr, "no answer from the board\n");
+        return 1;
+    }
+    ClientView client;
+    if (report.status != NetBenchStatus::Ok) {
+        print(options, client, report);
+        return 1;
+    }
+
+    uint64_t start = nowUs();
+    bool connected = true;
+    switch (options.mode) {
+    case NetBenchMode::TcpRx: {
+        int fd = connectTo(board, NET_BENCH_DATA_PORT);
+        if ((connected = fd >= 0)) {
+            client.txBytes = tcpSend(fd, options.bufferSize,
+                                     options.durationMs, client.retransmits);
+            close(fd);
+        }
+        break;
+    }
+    case NetBenchMode::TcpTx: {
+        int fd = connectTo(board, NET_BENCH_DATA_PORT);
+        if ((connected = fd >= 0)) {
+            client.rxBytes = tcpReceive(fd, options.durationMs);
+            client.retransmits = retransmits(fd);
+            close(fd);
+        }
+        break;
+    }
+    case NetBenchMode::TcpBidir: {
+        /*the stream the board receives first*/
+        int out = connectTo(board, NET_BENCH_DATA_PORT);
+        int in = out >= 0 ? connectTo(board, NET_BENCH_DATA_PORT) : -1;
+        if ((connected = in >= 0)) {
+            std::thread sender([&] {
+                client.txBytes = tcpSend(out, options.bufferSize,
+                                         options.durationMs,
+                                         client.retransmits);
+            });
+            client.rxBytes = tcpReceive(in, options.durationMs);
+            sender.join();
+            client.retransmits += retransmits(in);
+            close(in);
+        }
+        if (out >= 0)
+            close(out);
+        break;
+    }
+    case NetBenchMode::UdpRx: {
+        sockaddr_in to = board;
+        to.sin_port = htons(NET_BENCH_DATA_PORT);
+        udpSend(udp, to, options, client);
+        break;
+    }
+    case NetBenchMode::UdpTx:
+        udpReceive(udp, options, client);
+        break;
+    default:
+        break;
+    }
+    if (options.mode != NetBenchMode::UdpTx)
+        client.elapsedUs = nowUs() - start;
+    if (udp >= 0)
+        close(udp);
+    if (!connected)
+        fprintf(stderr, "cannot connect the data port\n");
+
+    setTimeout(control, options.durationMs + REPORT_GRACE);
+    if (!readAll(control, &report, sizeof(report)) ||
+        report.magic != NET_BENCH_MAGIC) {
+        fprintf(stderr, "no report from the board\n");
+        return 1;
+    }
+    close(control);
+    print(options, client, report);
+    return report.status == NetBenchStatus::Ok ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          wire format of the network benchmark, on host
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/net_bench_format.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace CARBON;
+
+/*a UdpTx request to the SD card, as the board reads it*/
+static bool request() {
+    NetBenchRequest request;
+    request.mode = NetBenchMode::UdpTx;
+    request.sink = NetBenchSink::Sd;
+    request.udpPort = 0x1234;
+    request.bufferSize = 1472;
+    request.durationMs = 10000;
+    request.udpRateKbps = 0x01020304;
+    static const uint8_t bytes[] = {
+        0x43, 0x42, 0x4E, 0x42, /*magic*/
+        0x01, 0x00, 0x00, 0x00, /*version*/
+        0x04,                   /*mode*/
+        0x02,                   /*sink*/
+        0x34, 0x12,             /*udpPort*/
+        0xC0, 0x05, 0x00, 0x00, /*bufferSize*/
+        0x10, 0x27, 0x00, 0x00, /*durationMs*/
+        0x04, 0x03, 0x02, 0x01, /*udpRateKbps*/
+    };
+    bool pass = sizeof(bytes) == sizeof(request) &&
+                std::memcmp(&request, bytes, sizeof(bytes)) == 0;
+    printf("request: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*the offsets the client decodes, the CPU load unknown by default*/
+static bool report() {
+    NetBenchReport report;
+    bool pass = report.magic == NET_BENCH_MAGIC &&
+                report.status == NetBenchStatus::Ok &&
+                report.cpuLoadPermille == NET_BENCH_CPU_UNKNOWN;
+    pass = offsetof(NetBenchReport, status) == 4 &&
+           offsetof(NetBenchReport, rxBytes) == 8 &&
+           offsetof(NetBenchReport, txBytes) == 16 &&
+           offsetof(NetBenchReport, elapsedUs) == 24 &&
+           offsetof(NetBenchReport, cpuLoadPermille) == 28 &&
+           offsetof(NetBenchReport, retransmits) == 32 &&
+           offsetof(NetBenchReport, datagrams) == 48 &&
+           offsetof(NetBenchReport, jitterUs) == 60 &&
+           offsetof(NetBenchReport, sinkMaxWriteUs) == 68 && pass;
+
+    report.rxBytes = 0x0102030405060708ULL;
+    auto bytes = reinterpret_cast<const uint8_t *>(&report);
+    pass = bytes[8] == 0x08 && bytes[15] == 0x01 && pass;
+    printf("report: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+static bool datagram() {
+    NetBenchDatagram datagram;
+    datagram.sequence = 7;
+    datagram.sentUs = 0xAABBCCDD;
+    static const uint8_t bytes[] = {0x07, 0x00, 0x00, 0x00,
+                                    0xDD, 0xCC, 0xBB, 0xAA};
+    bool pass = std::memcmp(&datagram, bytes, sizeof(bytes)) == 0;
+    printf("datagram: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+int main() {
+    bool pass = true;
+    pass = request() && pass;
+    pass = report() && pass;
+    pass = datagram() && pass;
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
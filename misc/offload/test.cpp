@@ -0,0 +1,199 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          offload test on host, worker and dispatcher run as threads
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/offload.hpp>
+
+#include <host_ipc.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace CARBON;
+using namespace CARBON_HOST;
+
+using HostWorker = OffloadWorker<HostMailbox, HostPlatform>;
+using HostClient = OffloadClient<HostMailbox, HostPlatform, MutexLock>;
+
+static constexpr uint32_t N_JOBS = 20000;
+static constexpr uint32_t N_BUFFERS = 64;
+static constexpr uint32_t MAX_LENGTH = 4096;
+
+static std::atomic<bool> stop{false};
+
+/*callbacks capture a single pointer, the capacity is sized for the target*/
+struct Tally {
+    std::atomic<uint32_t> completed{0};
+    std::atomic<uint32_t> errors{0};
+};
+
+/*reference implementations, bit by bit*/
+static uint32_t crc32Reference(const uint8_t *data, uint32_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+    return ~crc;
+}
+
+static uint32_t fnv1aReference(const uint8_t *data, uint32_t length) {
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < length; i++)
+        hash = (hash ^ data[i]) * 16777619u;
+    return hash;
+}
+
+static void cm4Worker(HostMailbox &mailbox, HostWorker &worker) {
+    MailboxMessage message;
+    while (!stop) {
+        if (mailbox.receive(message, 20))
+            worker.process(message);
+    }
+}
+
+static void cm7Dispatcher(HostMailbox &mailbox, HostClient &client) {
+    MailboxMessage message;
+    while (!stop) {
+        if (mailbox.receive(message, 20) && !client.complete(message))
+            printf("unexpected message %u\n", message.type);
+    }
+}
+
+static void printLatency(const char *name, const OffloadLatency &latency) {
+    printf("  %-10s min %6u avg %6u max %6u us\n", name, latency.minUs,
+           latency.avgUs(), latency.maxUs);
+}
+
+static bool testKnownValues(HostClient &client) {
+    static const char check[] = "123456789";
+    Tally tally;
+
+    auto submit = [&](OffloadFunction function, uint32_t expected) {
+        OffloadJob job{};
+        job.function = function;
+        job.input = reinterpret_cast<uintptr_t>(check);
+        job.inputLength = sizeof(check) - 1;
+        while (client.submit(job, [t = &tally, expected](
+                                      const OffloadJob &,
+                                      const OffloadResult &result) {
+                   if (result.status != OffloadStatus::Done ||
+                       result.value != expected)
+                       t->errors++;
+                   t->completed++;
+               }) == 0)
+            std::this_thread::yield();
+    };
+    submit(OffloadFunction::Crc32, 0xCBF43926);
+    submit(OffloadFunction::Fnv1a32, 0xBB86B11C);
+    submit(static_cast<OffloadFunction>(0x55), 0);
+
+    auto start = std::chrono::steady_clock::now();
+    while (tally.completed < 3) {
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(2))
+            return false;
+        std::this_thread::yield();
+    }
+    /*the unknown function fails*/
+    return tally.errors == 1 && client.stats().failed == 1;
+}
+
+static bool testThroughput(HostClient &client) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint32_t> length(0, MAX_LENGTH);
+    std::vector<std::vector<uint8_t>> buffers(N_BUFFERS);
+    for (auto &buffer : buffers) {
+        buffer.resize(length(gen));
+        for (auto &byte : buffer)
+            byte = static_cast<uint8_t>(gen());
+    }
+
+    Tally tally;
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < N_JOBS; i++) {
+        auto &buffer = buffers[i % N_BUFFERS];
+        auto function = i % 2 ? OffloadFunction::Fnv1a32 : OffloadFunction::Crc32;
+        auto expected = i % 2 ? fnv1aReference(buffer.data(), buffer.size())
+                              : crc32Reference(buffer.data(), buffer.size());
+        OffloadJob job{};
+        job.function = function;
+        job.input = reinterpret_cast<uintptr_t>(buffer.data());
+        job.inputLength = static_cast<uint32_t>(buffer.size());
+        while (client.submit(job, [t = &tally, expected](
+                                      const OffloadJob &,
+                                      const OffloadResult &result) {
+                   if (result.status != OffloadStatus::Done ||
+                       result.value != expected)
+                       t->errors++;
+                   t->completed++;
+               }) == 0)
+            std::this_thread::yield();
+    }
+
+    while (tally.completed < N_JOBS) {
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(20)) {
+            printf("throughput: stalled at %u/%u\n", tally.completed.load(), N_JOBS);
+            return false;
+        }
+        std::this_thread::yield();
+    }
+
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+    printf("throughput: %u jobs, %.2f us each, %u errors\n", N_JOBS,
+           static_cast<double>(us) / N_JOBS, tally.errors.load());
+    return tally.errors == 0 && client.pending() == 0;
+}
+
+int main() {
+    HostChannel channel;
+    HostWorker worker(channel.cm4);
+    HostClient client(channel.cm7);
+    std::thread cm4(cm4Worker, std::ref(channel.cm4), std::ref(worker));
+    std::thread cm7(cm7Dispatcher, std::ref(channel.cm7), std::ref(client));
+
+    bool pass = testKnownValues(client);
+    printf("known values: %s\n", pass ? "ok" : "failed");
+    pass = pass && testThroughput(client);
+
+    stop = true;
+    cm4.join();
+    cm7.join();
+
+    auto stats = client.stats();
+    printf("submitted %u completed %u rejected %u failed %u, worker jobs %u\n",
+           stats.submitted, stats.completed, stats.rejected, stats.failed,
+           worker.jobs());
+    printLatency("queue", stats.queue);
+    printLatency("execution", stats.execution);
+    printLatency("completion", stats.completion);
+    printLatency("total", stats.total);
+
+    pass = pass && stats.submitted == stats.completed &&
+           stats.completed == worker.jobs() && stats.total.count == N_JOBS + 3;
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
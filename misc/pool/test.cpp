@@ -0,0 +1,239 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          object pool test and benchmark on host
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/object_pool.hpp>
+#include <carbon/tlsf.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace CARBON;
+
+struct alignas(16) Message {
+    static inline std::atomic<int> alive{0};
+
+    explicit Message(uint32_t value) : value(value) { alive++; }
+    ~Message() { alive--; }
+
+    uint32_t value;
+    uint8_t payload[40];
+};
+
+static constexpr uint32_t POOL_SIZE = 64;
+
+/*every block once, aligned, then the pool is empty*/
+static bool exhaustion() {
+    static ObjectPool<Message, POOL_SIZE, InlineRegion, true> pool;
+    bool pass = pool.allocate() == nullptr && pool.init();
+    std::set<void *> blocks;
+    void *block;
+    while ((block = pool.allocate()) != nullptr) {
+        if (reinterpret_cast<uintptr_t>(block) % alignof(Message) != 0 ||
+            !pool.owns(block))
+            pass = false;
+        blocks.insert(block);
+    }
+    auto stats = pool.stats();
+    pass = blocks.size() == POOL_SIZE && stats.used == POOL_SIZE &&
+           stats.highWater == POOL_SIZE && stats.failures == 1 && pass;
+    for (auto pointer : blocks)
+        pass = pool.free(pointer) && pass;
+    stats = pool.stats();
+    pass = stats.used == 0 && stats.highWater == POOL_SIZE && pass;
+    printf("exhaustion: %zu blocks of %zu bytes, %s\n", blocks.size(),
+           pool.BLOCK_SIZE, pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*double free, foreign and misaligned pointers are refused and counted*/
+static bool checks() {
+    static ObjectPool<Message, POOL_SIZE, InlineRegion, true> pool;
+    static Message outside(0);
+    bool pass = pool.init();
+    auto message = pool.create(7U);
+    pass = message != nullptr && message->value == 7 &&
+           Message::alive == 2 && pass;
+    auto bytes = reinterpret_cast<uint8_t *>(message);
+    pass = !pool.free(bytes + 4) && !pool.free(&outside) && pass;
+    pass = pool.destroy(message) && Message::alive == 1 && pass;
+    pass = !pool.destroy(message) && !pool.free(message) && pass;
+    pass = Message::alive == 1 && pool.stats().badFrees == 4 &&
+           pool.stats().used == 0 && pass;
+    printf("checks: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*without the checks nullptr and foreign pointers are still refused*/
+static bool uncheckedFrees() {
+    static ObjectPool<Message, POOL_SIZE, InlineRegion, false> pool;
+    Message outside(0);
+    bool pass = pool.init();
+    auto message = pool.create(7U);
+    pass = message != nullptr && pass;
+    pass = !pool.free(nullptr) && !pool.free(&outside) && pass;
+    pass = !pool.destroy(&outside) && Message::alive == 3 && pass;
+    pass = pool.stats().badFrees == 3 && pool.stats().used == 1 && pass;
+    pass = pool.destroy(message) && pool.stats().used == 0 && pass;
+    /*every block once: the refused frees did not corrupt the free list*/
+    std::set<void *> blocks;
+    void *block;
+    while ((block = pool.allocate()) != nullptr)
+        blocks.insert(block);
+    pass = blocks.size() == POOL_SIZE && pass;
+    printf("unchecked frees: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*
+ * Every thread writes its id in the blocks it holds: two owners of the same
+ * block at the same time show up as a wrong id.
+ */
+template <bool Checked> static bool stress(const char *name) {
+    static constexpr uint32_t THREADS = 8;
+    static constexpr uint32_t OPERATIONS = 400000;
+    static ObjectPool<Message, POOL_SIZE, InlineRegion, Checked> pool;
+    bool pass = pool.init();
+    std::atomic<uint32_t> errors{0};
+    std::atomic<uint32_t> empty{0};
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t id = 1; id <= THREADS; id++) {
+        threads.emplace_back([&, id] {
+            std::mt19937 random(id);
+            std::vector<Message *> held;
+            for (uint32_t i = 0; i < OPERATIONS; i++) {
+                if (held.size() < 12 && (held.empty() || random() % 2 == 0)) {
+                    auto message = pool.create(id);
+                    if (message == nullptr) {
+                        empty++;
+                        continue;
+                    }
+                    std::memset(message->payload, static_cast<int>(id),
+                                sizeof(message->payload));
+                    held.push_back(message);
+                } else {
+                    auto index = random() % held.size();
+                    auto message = held[index];
+                    if (message->value != id || message->payload[39] != id)
+                        errors++;
+                    if (!pool.destroy(message))
+                        errors++;
+                    held[index] = held.back();
+                    held.pop_back();
+                }
+            }
+            for (auto message : held)
+                pool.destroy(message);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+
+    /*all the blocks are back, exactly once*/
+    std::set<void *> blocks;
+    void *block;
+    while ((block = pool.allocate()) != nullptr)
+        blocks.insert(block);
+    auto stats = pool.stats();
+    pass = errors == 0 && blocks.size() == POOL_SIZE && stats.badFrees == 0 &&
+           Message::alive == 1 && pass;
+    printf("stress %s: %u threads, %u operations in %ld us, high water %u, "
+           "%u empty, %s\n",
+           name, THREADS, THREADS * OPERATIONS, static_cast<long>(us),
+           stats.highWater, empty.load(), pass ? "ok" : "FAILED");
+    return pass;
+}
+
+/*
+ * Against the TLSF behind pvPortMalloc(), serialized by a mutex in place of
+ * vTaskSuspendAll(), and against the host malloc.
+ */
+static bool benchmark() {
+    static constexpr uint32_t ROUNDS = 2000000;
+    static constexpr uint32_t BATCH = 16;
+    static ObjectPool<Message, POOL_SIZE, InlineRegion, false> pool;
+    static std::vector<uint8_t> memory(256 * 1024);
+    Tlsf heap;
+    std::mutex mutex;
+    bool pass = pool.init() && heap.init(memory.data(), memory.size(), 8);
+    void *held[BATCH];
+
+    auto measure = [&](const char *label, auto &&allocate, auto &&release) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < ROUNDS / BATCH; i++) {
+            for (auto &pointer : held)
+                pointer = allocate();
+            for (auto pointer : held)
+                release(pointer);
+        }
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+        printf("benchmark %-10s %5.1f ns per allocate and free\n", label,
+               static_cast<double>(ns) / ROUNDS);
+        return std::all_of(std::begin(held), std::end(held),
+                           [](void *pointer) { return pointer != nullptr; });
+    };
+
+    pass = measure(
+               "pool", [&] { return pool.allocate(); },
+               [&](void *pointer) { pool.free(pointer); }) &&
+           pass;
+    pass = measure(
+               "tlsf",
+               [&] {
+                   std::lock_guard<std::mutex> lock(mutex);
+                   return heap.allocate(sizeof(Message));
+               },
+               [&](void *pointer) {
+                   std::lock_guard<std::mutex> lock(mutex);
+                   heap.free(pointer);
+               }) &&
+           pass;
+    pass = measure(
+               "malloc", [] { return std::malloc(sizeof(Message)); },
+               [](void *pointer) { std::free(pointer); }) &&
+           pass;
+    printf("benchmark: %s\n", pass ? "ok" : "FAILED");
+    return pass;
+}
+
+int main() {
+    bool pass = true;
+    pass = exhaustion() && pass;
+    pass = checks() && pass;
+    pass = uncheckedFrees() && pass;
+    pass = stress<true>("checked") && pass;
+    pass = stress<false>("unchecked") && pass;
+    pass = benchmark() && pass;
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
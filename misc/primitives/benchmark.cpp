@@ -0,0 +1,343 @@
+/**
+ ******************************************************************************
+ * @file           benchmark.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          micro-benchmarks of the common primitives on host
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/error.hpp>
+#include <carbon/fifo.hpp>
+#include <carbon/function_ref.hpp>
+#include <carbon/inplace_function.hpp>
+#include <carbon/pool.hpp>
+#include <carbon/result.hpp>
+#include <carbon/sync.hpp>
+
+#include <host_ipc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+/*
+ * Throughput: a FIFO filled and drained, bytes and items per second.
+ * Latency: one push and one pop, the time per iteration.
+ * Contention: producers and the single consumer of the diag and trace FIFOs
+ * on one lock, the benchmark thread 0 consumes.
+ * Element size, alignment and FIFO length are template arguments of the
+ * primitives, so every combination is a registration below.
+ *   primitives_benchmark --benchmark_out=file.json --benchmark_out_format=json
+ */
+
+using namespace CARBON;
+
+template <size_t Size> struct Element {
+    uint8_t data[Size];
+};
+
+static constexpr size_t alignedSize(size_t size, size_t alignment) {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/*the busy wait of the critical sections, yielding to the holder*/
+class SpinLock {
+public:
+    void get() {
+        while (flag_.test_and_set(std::memory_order_acquire))
+            std::this_thread::yield();
+    }
+
+    void release() { flag_.clear(std::memory_order_release); }
+
+private:
+    std::atomic_flag flag_ = ATOMIC_FLAG_INIT;
+};
+
+template <typename T, uint32_t Alignment, uint32_t N,
+          typename Lock = DummyLock>
+struct FifoWithMemory {
+    static constexpr size_t SIZE = (N + 1) * alignedSize(sizeof(T), Alignment);
+
+    FifoWithMemory() {
+        fifo.init(reinterpret_cast<uintptr_t>(memory),
+                  static_cast<uint32_t>(SIZE));
+    }
+
+    Fifo<T, Alignment, Lock, N> fifo;
+    Lock lock;
+    alignas(64) uint8_t memory[SIZE];
+};
+
+/* fifo ----------------------------------------------------------------------*/
+
+template <size_t Size, uint32_t Alignment, uint32_t N>
+static void fifoThroughput(benchmark::State &state) {
+    using T = Element<Size>;
+    static FifoWithMemory<T, Alignment, N> f;
+    T element{};
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < N; i++)
+            f.fifo.push(element, f.lock);
+        for (uint32_t i = 0; i < N; i++)
+            f.fifo.pop(element, f.lock);
+        benchmark::DoNotOptimize(element);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * N));
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * N * Size));
+}
+
+template <size_t Size, uint32_t Alignment, uint32_t N>
+static void fifoLatency(benchmark::State &state) {
+    using T = Element<Size>;
+    static FifoWithMemory<T, Alignment, N> f;
+    T element{};
+    for (auto _ : state) {
+        f.fifo.push(element, f.lock);
+        f.fifo.pop(element, f.lock);
+        benchmark::DoNotOptimize(element);
+    }
+}
+
+/*the bulk path of the diag: a reserved context, a copy, a pull*/
+template <uint32_t N> static void fifoContextBytes(benchmark::State &state) {
+    using FifoType = Fifo<uint8_t, 1, DummyLock, N>;
+    static FifoWithMemory<uint8_t, 1, N> f;
+    uint8_t data[N];
+    std::memset(data, 'x', sizeof(data));
+    uint32_t length = static_cast<uint32_t>(state.range(0));
+    for (auto _ : state) {
+        {
+            typename FifoType::ContextPush push(f.fifo, length, f.lock);
+            uint32_t pushed = length;
+            push.push_array(data, pushed);
+        }
+        {
+            typename FifoType::ContextPull pull(f.fifo, f.lock);
+            uintptr_t ptr1, ptr2;
+            pull.getDataPtr(ptr1, ptr2);
+            benchmark::DoNotOptimize(ptr1);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * length));
+}
+
+template <size_t Size, uint32_t N, typename Lock>
+static void fifoContention(benchmark::State &state) {
+    using T = Element<Size>;
+    static FifoWithMemory<T, 4, N, Lock> f;
+    const int producers = state.threads() - 1;
+    T element{};
+    if (state.thread_index() == 0) {
+        f.fifo.reset(f.lock);
+        for (auto _ : state) {
+            for (int i = 0; i < producers; i++) {
+                while (!f.fifo.pop(element, f.lock))
+                    std::this_thread::yield();
+            }
+            benchmark::DoNotOptimize(element);
+        }
+        state.SetItemsProcessed(
+            static_cast<int64_t>(state.iterations() * producers));
+    } else {
+        for (auto _ : state) {
+            while (!f.fifo.push(element, f.lock))
+                std::this_thread::yield();
+        }
+    }
+}
+
+#define FIFO_BENCHMARKS(size, alignment, length)                               \
+    BENCHMARK(fifoThroughput<size, alignment, length>);                        \
+    BENCHMARK(fifoLatency<size, alignment, length>);
+
+FIFO_BENCHMARKS(1, 1, 64)
+FIFO_BENCHMARKS(1, 1, 1024)
+FIFO_BENCHMARKS(3, 4, 64)
+FIFO_BENCHMARKS(4, 4, 64)
+FIFO_BENCHMARKS(4, 4, 1024)
+FIFO_BENCHMARKS(4, 32, 64)
+FIFO_BENCHMARKS(16, 4, 64)
+FIFO_BENCHMARKS(16, 16, 1024)
+FIFO_BENCHMARKS(64, 32, 64)
+FIFO_BENCHMARKS(64, 32, 1024)
+FIFO_BENCHMARKS(256, 32, 256)
+
+BENCHMARK(fifoContextBytes<4096>)->RangeMultiplier(4)->Range(16, 4096);
+
+BENCHMARK(fifoContention<4, 64, SpinLock>)
+    ->Threads(2)
+    ->Threads(3)
+    ->Threads(5)
+    ->UseRealTime();
+BENCHMARK(fifoContention<4, 1024, SpinLock>)
+    ->Threads(2)
+    ->Threads(5)
+    ->UseRealTime();
+BENCHMARK(fifoContention<64, 64, SpinLock>)
+    ->Threads(2)
+    ->Threads(5)
+    ->UseRealTime();
+BENCHMARK(fifoContention<4, 64, CARBON_HOST::MutexLock>)
+    ->Threads(2)
+    ->Threads(3)
+    ->Threads(5)
+    ->UseRealTime();
+
+/* buffer and allocator ------------------------------------------------------*/
+
+template <size_t Size, uint32_t Alignment>
+static void bufferInsertRemove(benchmark::State &state) {
+    using T = Element<Size>;
+    static constexpr uint32_t N = 256;
+    alignas(64) static uint8_t memory[N * alignedSize(Size, Alignment)];
+    static Buffer<T, Alignment> buffer;
+    buffer.init(reinterpret_cast<uintptr_t>(memory), sizeof(memory));
+    T element{};
+    uint32_t index = 0;
+    for (auto _ : state) {
+        buffer.insert(&element, index);
+        buffer.remove(&element, index);
+        benchmark::DoNotOptimize(element);
+        index = (index + 1) % N;
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * 2 * Size));
+}
+
+BENCHMARK(bufferInsertRemove<3, 4>);
+BENCHMARK(bufferInsertRemove<4, 4>);
+BENCHMARK(bufferInsertRemove<16, 16>);
+BENCHMARK(bufferInsertRemove<24, 32>);
+BENCHMARK(bufferInsertRemove<64, 32>);
+
+template <size_t BlockSize, uint32_t Alignment>
+static void allocatorGetBlock(benchmark::State &state) {
+    static constexpr uint32_t N = 256;
+    alignas(64) static uint8_t memory[N * alignedSize(BlockSize, Alignment)];
+    MemoryAllocatorRaw<BlockSize, Alignment> allocator;
+    allocator.init(reinterpret_cast<uintptr_t>(memory), sizeof(memory));
+    uint8_t *block;
+    uint32_t index = 0;
+    for (auto _ : state) {
+        allocator.getBlock(&block, index);
+        benchmark::DoNotOptimize(allocator.blockBelongs(block));
+        index = (index + 1) % N;
+    }
+}
+
+BENCHMARK(allocatorGetBlock<12, 4>);
+BENCHMARK(allocatorGetBlock<12, 32>);
+BENCHMARK(allocatorGetBlock<100, 32>);
+
+/* callables -----------------------------------------------------------------*/
+
+/*the calls through the three kinds, the capture as large as Capture*/
+template <size_t Capture> struct Callable {
+    uint32_t operator()(uint32_t value) const { return value + data[0]; }
+
+    uint32_t data[Capture / sizeof(uint32_t)]{1};
+};
+
+template <size_t Capture>
+static void callInplaceFunction(benchmark::State &state) {
+    inplace_function<uint32_t(uint32_t), Capture> fn{Callable<Capture>()};
+    benchmark::DoNotOptimize(fn);
+    uint32_t value = 0;
+    for (auto _ : state) {
+        value = fn(value);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+template <size_t Capture>
+static void callFunctionRef(benchmark::State &state) {
+    Callable<Capture> callable;
+    function_ref<uint32_t(uint32_t)> fn(callable);
+    benchmark::DoNotOptimize(fn);
+    uint32_t value = 0;
+    for (auto _ : state) {
+        value = fn(value);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+template <size_t Capture>
+static void callStdFunction(benchmark::State &state) {
+    std::function<uint32_t(uint32_t)> fn{Callable<Capture>()};
+    benchmark::DoNotOptimize(fn);
+    uint32_t value = 0;
+    for (auto _ : state) {
+        value = fn(value);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+/*construction and destruction, the cost of a job handed to the offload*/
+template <size_t Capture>
+static void constructInplaceFunction(benchmark::State &state) {
+    Callable<Capture> callable;
+    for (auto _ : state) {
+        inplace_function<uint32_t(uint32_t), Capture> fn{callable};
+        benchmark::DoNotOptimize(fn);
+    }
+}
+
+template <size_t Capture>
+static void constructStdFunction(benchmark::State &state) {
+    Callable<Capture> callable;
+    for (auto _ : state) {
+        std::function<uint32_t(uint32_t)> fn{callable};
+        benchmark::DoNotOptimize(fn);
+    }
+}
+
+BENCHMARK(callInplaceFunction<16>);
+BENCHMARK(callInplaceFunction<64>);
+BENCHMARK(callFunctionRef<16>);
+BENCHMARK(callFunctionRef<64>);
+BENCHMARK(callStdFunction<16>);
+BENCHMARK(callStdFunction<64>);
+BENCHMARK(constructInplaceFunction<16>);
+BENCHMARK(constructInplaceFunction<64>);
+BENCHMARK(constructStdFunction<16>);
+BENCHMARK(constructStdFunction<64>);
+
+/* result and error ----------------------------------------------------------*/
+
+__attribute__((noinline)) static Result<uint32_t> readRegister(uint32_t value) {
+    if ((value & 0xFF) == 0xFF)
+        return Result<uint32_t>(ModbusResponseFailed);
+    return Result<uint32_t>(value);
+}
+
+static void resultReturn(benchmark::State &state) {
+    uint32_t value = 0;
+    uint32_t errors = 0;
+    for (auto _ : state) {
+        Result<uint32_t> result = readRegister(value++);
+        if (result.hasValue())
+            benchmark::DoNotOptimize(result.value());
+        else if (result.error() == ModbusResponseFailed)
+            errors++;
+    }
+    benchmark::DoNotOptimize(errors);
+}
+
+BENCHMARK(resultReturn);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,45 @@
+/**
+ ******************************************************************************
+ * @file           diag.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          diag and assert of the primitives on host
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/common.hpp>
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+/*the primitives report misuse with RAW_DIAG, the tests count the reports*/
+
+static std::atomic<unsigned> rawDiagCount{0};
+
+extern "C" void carbon_raw_diag_print(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    std::vfprintf(stderr, format, args);
+    va_end(args);
+    std::fputc('\n', stderr);
+    rawDiagCount++;
+}
+
+extern "C" void carbon_assert(unsigned long line, const char *filename,
+                              const char *message) {
+    std::fprintf(stderr, "assert %s:%lu %s\n", filename, line, message);
+    std::abort();
+}
+
+unsigned carbon_raw_diag_count() { return rawDiagCount; }
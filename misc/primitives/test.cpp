@@ -0,0 +1,492 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          unit tests of the common primitives on host
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/error.hpp>
+#include <carbon/fifo.hpp>
+#include <carbon/function_ref.hpp>
+#include <carbon/inplace_function.hpp>
+#include <carbon/pool.hpp>
+#include <carbon/result.hpp>
+#include <carbon/sync.hpp>
+
+#include <host_ipc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CARBON;
+
+unsigned carbon_raw_diag_count();
+
+static constexpr size_t alignedSize(size_t size, size_t alignment) {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/*a FIFO with its memory, placed offset bytes after an aligned address*/
+template <typename T, uint32_t Alignment, uint32_t N,
+          typename Lock = DummyLock>
+struct FifoWithMemory {
+    using FifoType = Fifo<T, Alignment, Lock, N>;
+    static constexpr size_t SIZE = (N + 1) * alignedSize(sizeof(T), Alignment);
+
+    bool init(uintptr_t offset = 0) {
+        return fifo.init(reinterpret_cast<uintptr_t>(memory) + offset,
+                         static_cast<uint32_t>(SIZE + Alignment - 1));
+    }
+
+    FifoType fifo;
+    Lock lock;
+    alignas(64) uint8_t memory[SIZE + 64];
+};
+
+#pragma pack(push, 1)
+struct PackedStruct {
+    uint8_t var1{0};
+    uint16_t var2{0};
+};
+#pragma pack(pop)
+
+/* error and result ----------------------------------------------------------*/
+
+TEST(Error, DefaultIsSuccess) {
+    static_assert(!Success);
+    static_assert(Error() == Success);
+    static_assert(Success.group() == ErrorGroupType::None);
+    static_assert(Success.error() == ErrorType::None);
+    EXPECT_FALSE(static_cast<bool>(Error()));
+}
+
+TEST(Error, GroupAndErrorCompare) {
+    static_assert(static_cast<bool>(InternalError));
+    static_assert(InternalError != InternalHardwareError);
+    static_assert(InternalError.error() == InternalHardwareError.error());
+    EXPECT_EQ(ModbusRequestFailed.group(), ErrorGroupType::Modbus);
+    EXPECT_EQ(ModbusRequestFailed.error(), ErrorType::ModbusRequestFailed);
+    EXPECT_EQ(ModbusRequestFailed,
+              Error(ErrorGroupType::Modbus, ErrorType::ModbusRequestFailed));
+    EXPECT_NE(ModbusRequestFailed, ModbusResponseFailed);
+}
+
+TEST(Result, Value) {
+    Result<uint32_t> result(42u);
+    EXPECT_TRUE(result.hasValue());
+    EXPECT_EQ(result.value(), 42u);
+    EXPECT_EQ(result.error(), Success);
+}
+
+TEST(Result, Error) {
+    Result<uint32_t> result(NetworkInvalidIP);
+    EXPECT_FALSE(result.hasValue());
+    EXPECT_EQ(result.error(), NetworkInvalidIP);
+}
+
+TEST(Result, Void) {
+    EXPECT_FALSE(Result<void>(Success).isError());
+    EXPECT_TRUE(Result<void>(ModbusIPNotSet).isError());
+    EXPECT_EQ(Result<void>(ModbusIPNotSet).error(), ModbusIPNotSet);
+}
+
+/* callables -----------------------------------------------------------------*/
+
+static int addOne(int value) { return value + 1; }
+
+static int callTwice(function_ref<int(int)> fn, int value) {
+    return fn(fn(value));
+}
+
+TEST(FunctionRef, CallsLambdaAndFunction) {
+    int offset = 10;
+    auto lambda = [&offset](int value) { return value + offset; };
+    EXPECT_EQ(callTwice(lambda, 1), 21);
+    EXPECT_EQ(callTwice(addOne, 1), 3);
+    offset = 100;
+    EXPECT_EQ(callTwice(lambda, 1), 201);
+}
+
+TEST(FunctionRef, EmptyAndReferenceArguments) {
+    function_ref<void(int &)> empty;
+    EXPECT_FALSE(empty);
+    function_ref<void(int &)> null(nullptr);
+    EXPECT_FALSE(null);
+
+    auto increment = [](int &value) { value++; };
+    function_ref<void(int &)> fn(increment);
+    EXPECT_TRUE(fn);
+    int value = 0;
+    fn(value);
+    fn(value);
+    EXPECT_EQ(value, 2);
+}
+
+/*counts the live copies of a capture*/
+struct Counted {
+    static inline int alive = 0;
+
+    Counted() { alive++; }
+    Counted(const Counted &) { alive++; }
+    ~Counted() { alive--; }
+
+    int operator()(int value) const { return value * 2; }
+};
+
+TEST(InplaceFunction, CallCopyMove) {
+    using Function = inplace_function<int(int), 16>;
+    {
+        Function fn{Counted()};
+        EXPECT_TRUE(fn);
+        EXPECT_EQ(Counted::alive, 1);
+        EXPECT_EQ(fn(21), 42);
+
+        Function copy(fn);
+        EXPECT_EQ(Counted::alive, 2);
+        EXPECT_EQ(copy(4), 8);
+
+        Function moved(std::move(fn));
+        EXPECT_FALSE(fn);
+        EXPECT_TRUE(fn == nullptr);
+        EXPECT_EQ(Counted::alive, 2);
+        EXPECT_EQ(moved(5), 10);
+
+        moved = nullptr;
+        EXPECT_FALSE(moved);
+        EXPECT_EQ(Counted::alive, 1);
+    }
+    EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(InplaceFunction, CaptureSwapAndConversion) {
+    uint64_t a = 3, b = 4;
+    inplace_function<uint64_t(), 16> first = [a, b] { return a * b; };
+    inplace_function<uint64_t(), 16> second = [a] { return a; };
+    swap(first, second);
+    EXPECT_EQ(first(), 3u);
+    EXPECT_EQ(second(), 12u);
+
+    /*to a larger capacity, as the offload jobs do*/
+    inplace_function<uint64_t(), 64> larger = second;
+    EXPECT_EQ(larger(), 12u);
+    EXPECT_EQ(second(), 12u);
+}
+
+/* memory allocator and buffer -----------------------------------------------*/
+
+TEST(MemoryAllocatorRaw, AlignedBlocks) {
+    alignas(64) uint8_t memory[256];
+    MemoryAllocatorRaw<12, 16> allocator;
+    /*three bytes lost to the alignment of the start*/
+    allocator.init(reinterpret_cast<uintptr_t>(memory + 3), 200);
+
+    EXPECT_EQ(allocator.getAlignedBlockSize(), 16u);
+    EXPECT_EQ(allocator.getAlignedStartAddress(),
+              reinterpret_cast<uintptr_t>(memory + 16));
+    EXPECT_EQ(allocator.getNumberOfAlignedElements(), (200u - 13u) / 16u);
+
+    uint8_t *block;
+    uint32_t count = 0;
+    while (allocator.interateBlock(&block)) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(block) % 16u, 0u);
+        EXPECT_TRUE(allocator.blockBelongs(block));
+        count++;
+    }
+    EXPECT_EQ(block, nullptr);
+    EXPECT_EQ(count, allocator.getNumberOfAlignedElements());
+
+    allocator.reset();
+    ASSERT_TRUE(allocator.interateBlock(&block));
+    EXPECT_EQ(block, memory + 16);
+
+    ASSERT_TRUE(allocator.getBlock(&block, 2));
+    EXPECT_EQ(block, memory + 48);
+    EXPECT_FALSE(allocator.getBlock(&block, 100));
+    EXPECT_EQ(block, nullptr);
+
+    EXPECT_FALSE(allocator.blockBelongs(memory));
+    EXPECT_FALSE(allocator.blockBelongs(memory + 17));
+    EXPECT_FALSE(allocator.blockBelongs(memory + 16 + 16 * 11));
+}
+
+TEST(Buffer, AlignedElements) {
+    alignas(64) uint8_t memory[64];
+    Buffer<uint32_t, 4> buffer;
+    buffer.init(reinterpret_cast<uintptr_t>(memory), sizeof(memory));
+    EXPECT_EQ(buffer.getNumberOfAlignedElements(), 16u);
+
+    const uint32_t values[4] = {1, 2, 3, 4};
+    EXPECT_TRUE(buffer.insert(values, 12, 4));
+    uint32_t read[4] = {};
+    EXPECT_TRUE(buffer.remove(read, 12, 4));
+    EXPECT_EQ(std::memcmp(values, read, sizeof(values)), 0);
+
+    /*past the end of the memory*/
+    unsigned diags = carbon_raw_diag_count();
+    EXPECT_FALSE(buffer.insert(values, 13, 4));
+    EXPECT_FALSE(buffer.remove(read, 16));
+    EXPECT_EQ(carbon_raw_diag_count(), diags + 2);
+}
+
+TEST(Buffer, PaddedElements) {
+    alignas(64) uint8_t memory[64];
+    std::memset(memory, 0xEE, sizeof(memory));
+    Buffer<PackedStruct, 8> buffer;
+    buffer.init(reinterpret_cast<uintptr_t>(memory), sizeof(memory));
+    EXPECT_EQ(buffer.getNumberOfAlignedElements(), 8u);
+
+    PackedStruct value{0x12, 0x3456};
+    EXPECT_TRUE(buffer.insert(&value, 7));
+    /*one element per aligned block, the padding is untouched*/
+    EXPECT_EQ(memory[56], 0x12);
+    EXPECT_EQ(memory[59], 0xEE);
+
+    PackedStruct read;
+    EXPECT_TRUE(buffer.remove(&read, 7));
+    EXPECT_EQ(read.var1, 0x12);
+    EXPECT_EQ(read.var2, 0x3456);
+    EXPECT_FALSE(buffer.insert(&value, 8));
+}
+
+/* fifo ----------------------------------------------------------------------*/
+
+TEST(Fifo, InitNeedsOneMoreElement) {
+    static FifoWithMemory<uint32_t, 4, 8> f;
+    EXPECT_FALSE(f.fifo.init(reinterpret_cast<uintptr_t>(f.memory), 8 * 4));
+    EXPECT_TRUE(f.fifo.init(reinterpret_cast<uintptr_t>(f.memory), 9 * 4));
+}
+
+/*the sequence of CM7/test/src/main_fifo.cpp, an unaligned memory start*/
+TEST(Fifo, PaddedStructOverflowAndWrap) {
+    static FifoWithMemory<PackedStruct, 4, 4> f;
+    ASSERT_TRUE(f.init(1));
+    EXPECT_TRUE(f.fifo.isEmpty());
+
+    PackedStruct write, read;
+    for (uint8_t i = 0; i < 5; i++) {
+        write = {static_cast<uint8_t>(i + 1),
+                 static_cast<uint16_t>(i * 10 + 3)};
+        EXPECT_EQ(f.fifo.push(write, f.lock), i < 4) << "push " << int(i);
+    }
+    EXPECT_TRUE(f.fifo.isFull());
+
+    for (uint8_t i = 0; i < 5; i++) {
+        bool popped = f.fifo.pop(read, f.lock);
+        EXPECT_EQ(popped, i < 4) << "pop " << int(i);
+        if (popped) {
+            EXPECT_EQ(read.var1, i + 1);
+            EXPECT_EQ(read.var2, i * 10 + 3);
+        }
+    }
+    EXPECT_TRUE(f.fifo.isEmpty());
+
+    for (uint8_t i = 0; i < 4; i++) {
+        write = {static_cast<uint8_t>(i + 67),
+                 static_cast<uint16_t>(i * 10 + 954)};
+        EXPECT_TRUE(f.fifo.push(write, f.lock));
+    }
+    ASSERT_TRUE(f.fifo.pop(read, f.lock));
+    EXPECT_EQ(read.var1, 67);
+    write = {0xA5, 65000};
+    EXPECT_TRUE(f.fifo.push(write, f.lock));
+    for (uint8_t i = 1; i < 4; i++) {
+        ASSERT_TRUE(f.fifo.pop(read, f.lock));
+        EXPECT_EQ(read.var1, i + 67);
+        EXPECT_EQ(read.var2, i * 10 + 954);
+    }
+    ASSERT_TRUE(f.fifo.pop(read, f.lock));
+    EXPECT_EQ(read.var1, 0xA5);
+    EXPECT_EQ(read.var2, 65000);
+}
+
+static unsigned overflows = 0;
+static unsigned underflows = 0;
+
+TEST(Fifo, Callbacks) {
+    static FifoWithMemory<uint16_t, 2, 2> f;
+    ASSERT_TRUE(f.init());
+    f.fifo.setCallbackOverflow([](const uint16_t &) { overflows++; });
+    f.fifo.setCallbackUnderflow([](uint16_t) { underflows++; });
+
+    uint16_t value = 7;
+    EXPECT_FALSE(f.fifo.pop(value, f.lock));
+    EXPECT_TRUE(f.fifo.push(value, f.lock));
+    EXPECT_TRUE(f.fifo.push(value, f.lock));
+    EXPECT_FALSE(f.fifo.push(value, f.lock));
+    EXPECT_EQ(overflows, 1u);
+    EXPECT_EQ(underflows, 1u);
+
+    f.fifo.reset(f.lock);
+    EXPECT_TRUE(f.fifo.isEmpty());
+    EXPECT_FALSE(f.fifo.pop(value, f.lock));
+    EXPECT_EQ(underflows, 2u);
+}
+
+/*the text round trips of main_fifo.cpp, through the contexts of the diag*/
+TEST(Fifo, TextThroughContexts) {
+    static FifoWithMemory<uint8_t, 1, 200> f;
+    ASSERT_TRUE(f.init());
+
+    const std::string texts[] = {
+        "test text numero 1. oggi siamo stati alla mostra del "
+        "carro agricolo\r\n",
+        "test text numero 2. oggi abbiamo visto i buoi chianini\r\n",
+        "test text numero 3. E' stata una bella giornata\r\n",
+        "test text numero 4. Sono stato benissimo, posto incantevole e "
+        "bellissimo panorama\r\n"};
+
+    auto push = [&](const std::string &text) {
+        uint32_t length = static_cast<uint32_t>(text.size());
+        Fifo<uint8_t, 1, DummyLock, 200>::ContextPush context(f.fifo, length,
+                                                              f.lock);
+        if (context.isOverflow())
+            return false;
+        return context.push_array(
+            reinterpret_cast<const uint8_t *>(text.data()), length);
+    };
+    auto pull = [&]() {
+        Fifo<uint8_t, 1, DummyLock, 200>::ContextPull context(f.fifo, f.lock);
+        uint32_t length1, length2;
+        uintptr_t ptr1, ptr2;
+        context.getDataLength(length1, length2);
+        context.getDataPtr(ptr1, ptr2);
+        return std::string(reinterpret_cast<const char *>(ptr1), length1) +
+               std::string(reinterpret_cast<const char *>(ptr2), length2);
+    };
+
+    for (unsigned round = 0; round < 50; round++) {
+        const std::string &a = texts[round % 4];
+        const std::string &b = texts[(round + 1) % 4];
+        const std::string &c = texts[(round + 3) % 4];
+        ASSERT_TRUE(push(a));
+        ASSERT_TRUE(push(b));
+        if (a.size() + b.size() + c.size() <= 200) {
+            ASSERT_TRUE(push(c));
+            EXPECT_EQ(pull(), a + b + c) << "round " << round;
+        } else {
+            EXPECT_FALSE(push(c));
+            EXPECT_EQ(pull(), a + b) << "round " << round;
+        }
+        EXPECT_TRUE(f.fifo.isEmpty());
+    }
+}
+
+/*random single and bulk operations against a deque*/
+TEST(Fifo, MatchesQueueModel) {
+    static constexpr uint32_t N = 13;
+    using FifoType = Fifo<uint32_t, 4, DummyLock, N>;
+    static FifoWithMemory<uint32_t, 4, N> f;
+    ASSERT_TRUE(f.init());
+
+    std::deque<uint32_t> model;
+    std::mt19937 rng(7);
+    uint32_t next = 0;
+    uint32_t value = 0;
+
+    for (unsigned step = 0; step < 20000; step++) {
+        switch (rng() % 4) {
+        case 0: {
+            bool fits = model.size() < N;
+            ASSERT_EQ(f.fifo.push(next, f.lock), fits) << "step " << step;
+            if (fits)
+                model.push_back(next++);
+            break;
+        }
+        case 1: {
+            uint32_t n = 1 + rng() % (N + 1);
+            bool fits = model.size() + n <= N;
+            FifoType::ContextPush context(f.fifo, n, f.lock);
+            ASSERT_EQ(context.isOverflow(), !fits) << "step " << step;
+            for (uint32_t i = 0; fits && i < n; i++) {
+                ASSERT_TRUE(context.push(next));
+                model.push_back(next++);
+            }
+            break;
+        }
+        case 2: {
+            bool available = !model.empty();
+            ASSERT_EQ(f.fifo.pop(value, f.lock), available) << "step " << step;
+            if (available) {
+                ASSERT_EQ(value, model.front()) << "step " << step;
+                model.pop_front();
+            }
+            break;
+        }
+        default: {
+            FifoType::ContextPull context(f.fifo, f.lock);
+            uint32_t length1, length2;
+            uintptr_t ptr1, ptr2;
+            context.getDataLength(length1, length2);
+            context.getDataPtr(ptr1, ptr2);
+            ASSERT_EQ(length1 + length2, model.size()) << "step " << step;
+            for (uint32_t i = 0; i < length1 + length2; i++) {
+                uintptr_t ptr = i < length1 ? ptr1 + i * sizeof(uint32_t)
+                                            : ptr2 + (i - length1) * 4u;
+                ASSERT_EQ(*reinterpret_cast<const uint32_t *>(ptr),
+                          model.front())
+                    << "step " << step << " element " << i;
+                model.pop_front();
+            }
+            break;
+        }
+        }
+        ASSERT_EQ(f.fifo.isEmpty(), model.empty()) << "step " << step;
+        ASSERT_EQ(f.fifo.isFull(), model.size() == N) << "step " << step;
+    }
+}
+
+/*several producers and the single consumer of the diag and trace FIFOs*/
+TEST(Fifo, ProducersAndConsumer) {
+    static constexpr unsigned PRODUCERS = 4;
+    static constexpr uint32_t PER_PRODUCER = 50000;
+    static FifoWithMemory<uint32_t, 4, 64, CARBON_HOST::MutexLock> f;
+    ASSERT_TRUE(f.init());
+
+    std::vector<std::thread> producers;
+    for (uint32_t id = 0; id < PRODUCERS; id++) {
+        producers.emplace_back([id] {
+            for (uint32_t i = 0; i < PER_PRODUCER; i++) {
+                uint32_t value = (id << 24) | i;
+                while (!f.fifo.push(value, f.lock))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    uint32_t expected[PRODUCERS] = {};
+    uint32_t received = 0;
+    uint32_t value = 0;
+    while (received < PRODUCERS * PER_PRODUCER) {
+        if (!f.fifo.pop(value, f.lock)) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t id = value >> 24;
+        ASSERT_LT(id, PRODUCERS);
+        ASSERT_EQ(value & 0xFFFFFF, expected[id]) << "producer " << id;
+        expected[id]++;
+        received++;
+    }
+
+    for (auto &producer : producers)
+        producer.join();
+    EXPECT_TRUE(f.fifo.isEmpty());
+}
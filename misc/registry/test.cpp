@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * @file           test.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          registry concurrency test on host, one thread per core
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/registry_table.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace CARBON;
+
+static constexpr uint32_t N_WRITES = 2000000;
+static constexpr uint32_t N_READERS = 3;
+
+static std::atomic<bool> stop{false};
+
+/*every field is derived from the write counter: a torn read mixes two*/
+static RegistryNetLink netLink(uint32_t n) { return {n, n * 3, ~n, n ^ 0x5A5A}; }
+
+static bool check(const RegistryNetLink &v) {
+    auto n = v.up;
+    return v.ip == n * 3 && v.netmask == ~n && v.gateway == (n ^ 0x5A5A);
+}
+
+static RegistryModbus modbus(uint32_t n) {
+    RegistryModbus v{};
+    v.slaveIp = n;
+    v.slaveId = static_cast<uint8_t>(n);
+    v.functionCode = static_cast<uint8_t>(n >> 8);
+    v.address = static_cast<uint16_t>(n);
+    v.value = static_cast<uint16_t>(n >> 16);
+    v.reads = n;
+    v.errors = ~n;
+    return v;
+}
+
+static bool check(const RegistryModbus &v) {
+    auto expected = modbus(v.slaveIp);
+    return std::memcmp(&v, &expected, sizeof(v)) == 0;
+}
+
+static RegistryCM4 cm4(uint32_t n) { return {n, n + 7, n * 5}; }
+
+static bool check(const RegistryCM4 &v) {
+    auto n = v.uptimeMs;
+    return v.offloadJobs == n + 7 && v.freeHeap == n * 5;
+}
+
+struct ReaderStats {
+    uint64_t reads;
+    uint64_t busy;
+    uint64_t torn;
+    uint64_t backwards;
+};
+
+template <RegistryId Id>
+static void readOne(RegistryShared &registry, uint64_t &lastTimestamp,
+                    ReaderStats &stats) {
+    RegistryType<Id> value;
+    uint64_t timestamp;
+    if (!registryRead<Id>(registry, value, &timestamp)) {
+        if (lastTimestamp != 0)
+            stats.busy++;
+        return;
+    }
+    stats.reads++;
+    if (!check(value))
+        stats.torn++;
+    if (timestamp < lastTimestamp)
+        stats.backwards++;
+    lastTimestamp = timestamp;
+}
+
+static void reader(RegistryShared &registry, ReaderStats &stats) {
+    uint64_t last[static_cast<uint32_t>(RegistryId::Count)] = {};
+    while (!stop) {
+        readOne<RegistryId::NetLink>(registry, last[0], stats);
+        readOne<RegistryId::Modbus>(registry, last[2], stats);
+        readOne<RegistryId::CM4>(registry, last[3], stats);
+
+        /*untyped path*/
+        RegistryNetLink raw;
+        if (registryReadRaw(registry, RegistryId::NetLink, &raw, sizeof(raw)) &&
+            !check(raw))
+            stats.torn++;
+    }
+}
+
+int main() {
+    static RegistryShared registry; /*zeroed as the NOLOAD section after init*/
+    registry.init();
+
+    for (const auto &descriptor : registryTable) {
+        printf("%-10s %2u bytes, written by %s\n", descriptor.name,
+               descriptor.size,
+               descriptor.writer == RegistryWriter::CM7 ? "CM7" : "CM4");
+    }
+
+    RegistryNetLink unused;
+    bool pass = !registryRead<RegistryId::NetLink>(registry, unused);
+
+    std::vector<ReaderStats> stats(N_READERS, ReaderStats{});
+    std::vector<std::thread> readers;
+    for (uint32_t i = 0; i < N_READERS; i++)
+        readers.emplace_back(reader, std::ref(registry), std::ref(stats[i]));
+
+    std::thread cm7([] {
+        for (uint32_t n = 1; n <= N_WRITES; n++) {
+            registryWrite<RegistryId::NetLink>(registry, netLink(n), n);
+            registryWrite<RegistryId::Modbus>(registry, modbus(n), n);
+        }
+    });
+    std::thread cm4Writer([] {
+        for (uint32_t n = 1; n <= N_WRITES; n++)
+            registryWrite<RegistryId::CM4>(registry, cm4(n), n);
+    });
+
+    cm7.join();
+    cm4Writer.join();
+    stop = true;
+    for (auto &thread : readers)
+        thread.join();
+
+    ReaderStats total{};
+    for (const auto &s : stats) {
+        total.reads += s.reads;
+        total.busy += s.busy;
+        total.torn += s.torn;
+        total.backwards += s.backwards;
+    }
+    printf("reads %lu, busy %lu, torn %lu, backwards %lu\n",
+           static_cast<unsigned long>(total.reads),
+           static_cast<unsigned long>(total.busy),
+           static_cast<unsigned long>(total.torn),
+           static_cast<unsigned long>(total.backwards));
+
+    RegistryCM4 last;
+    uint64_t timestamp;
+    pass = pass && total.torn == 0 && total.backwards == 0 &&
+           total.reads > 0 &&
+           registryRead<RegistryId::CM4>(registry, last, &timestamp) &&
+           timestamp == N_WRITES && check(last);
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
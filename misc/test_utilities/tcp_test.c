@@ -1,59 +0,0 @@
-#include <arpa/inet.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <unistd.h>
-
-#define SERVER_PORT 9999           // Port the server is listening on
-#define SERVER_IP "192.168.178.54" // Server's IP address
-#define BUFFER_SIZE 1024
-
-int main() {
-    int sock;
-    struct sockaddr_in server_addr;
-    char buffer[BUFFER_SIZE] = "Hello, Server!";
-
-    // Create socket
-    if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
-        perror("Socket creation error");
-        exit(EXIT_FAILURE);
-    }
-
-    // Define server address
-    server_addr.sin_family = AF_INET;
-    server_addr.sin_port = htons(SERVER_PORT);
-
-    // Convert IPv4/IPv6 addresses from text to binary form
-    if (inet_pton(AF_INET, SERVER_IP, &server_addr.sin_addr) <= 0) {
-        perror("Invalid address/ Address not supported");
-        close(sock);
-        exit(EXIT_FAILURE);
-    }
-
-    // Connect to the server
-    if (connect(sock, (struct sockaddr *)&server_addr, sizeof(server_addr)) <
-        0) {
-        perror("Connection failed");
-        close(sock);
-        exit(EXIT_FAILURE);
-    }
-
-    // Send data to the server
-    if (send(sock, buffer, strlen(buffer), 0) < 0) {
-        perror("Send failed");
-        close(sock);
-        exit(EXIT_FAILURE);
-    }
-    printf("Message sent to server: %s\n", buffer);
-
-    // Optionally receive a response from the server
-    memset(buffer, 0, BUFFER_SIZE);
-    if (recv(sock, buffer, BUFFER_SIZE, 0) > 0) {
-        printf("Message from server: %s\n", buffer);
-    }
-
-    // Close the socket
-    close(sock);
-
-    return 0;
-}
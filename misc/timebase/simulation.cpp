@@ -0,0 +1,150 @@
+/**
+ ******************************************************************************
+ * @file           simulation.cpp
+ * @author         Michele Viti <micheleviti78@gmail.com>
+ * @date           Oct. 2026
+ * @brief          host simulation of the cross core time base estimator
+ ******************************************************************************
+ * @attention
+ * Copyright (c) 2022 Michele Viti.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <carbon/timebase.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace CARBON;
+
+struct Scenario {
+    const char *name;
+    double driftPpm;      /*CM4 clock drift from start*/
+    double driftStepPpm;  /*drift change at half of the simulation*/
+    double startOffsetUs; /*CM4 timer starts later than the CM7 one*/
+    double preemptRate;   /*probability of a disturbed sampling window*/
+};
+
+static constexpr double SIM_DURATION_S = 900.0;
+static constexpr double PUBLISH_PERIOD_S = 1.0;
+static constexpr double SETTLE_S = 60.0;
+static constexpr double STEP_SETTLE_S = 180.0; /*7 drift baselines*/
+static constexpr double MAX_DRIFT_ERROR_PPB = 300.0;
+static constexpr double MAX_TIME_ERROR_US = 4.0;
+
+/*true time in us, CM4 clock integrates the drift*/
+class SimClock {
+public:
+    explicit SimClock(const Scenario &scenario) : scenario_(scenario) {}
+
+    double drift(double trueUs) const {
+        auto ppm = scenario_.driftPpm;
+        if (trueUs > SIM_DURATION_S * 1e6 / 2)
+            ppm += scenario_.driftStepPpm;
+        return ppm;
+    }
+
+    uint64_t master(double trueUs) const {
+        return static_cast<uint64_t>(std::floor(trueUs));
+    }
+
+    uint64_t local(double trueUs) const {
+        auto half = SIM_DURATION_S * 1e6 / 2;
+        auto value = trueUs * (1.0 + scenario_.driftPpm * 1e-6);
+        if (trueUs > half)
+            value += (trueUs - half) * scenario_.driftStepPpm * 1e-6;
+        return static_cast<uint64_t>(
+            std::floor(value - scenario_.startOffsetUs));
+    }
+
+private:
+    const Scenario &scenario_;
+};
+
+static bool run(const Scenario &scenario, std::mt19937 &gen) {
+    SimClock clock(scenario);
+    TimebaseEstimator estimator;
+    std::uniform_real_distribution<double> jitter(0.0, 2.0);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::uniform_real_distribution<double> preempt(20.0, 300.0);
+
+    estimator.reset(clock.master(0.0));
+
+    double maxError = 0;
+    double sumError2 = 0;
+    uint32_t nChecks = 0;
+    double maxDriftError = 0;
+
+    for (double t = scenario.startOffsetUs + 1e6; t < SIM_DURATION_S * 1e6;
+         t += PUBLISH_PERIOD_S * 1e6 + jitter(gen) * 1e3) {
+        /*sampling window: start stamp, remote read, end stamp*/
+        auto window = 0.3 + jitter(gen) * 0.5;
+        if (unit(gen) < scenario.preemptRate)
+            window += preempt(gen);
+        auto start = clock.master(t);
+        auto remote = clock.local(t + 0.15);
+        auto end = clock.master(t + window);
+        auto windowUs = static_cast<uint32_t>(end - start);
+        estimator.update(start + windowUs / 2, remote, windowUs);
+
+        if (t < SETTLE_S * 1e6)
+            continue;
+
+        auto driftError = std::fabs(estimator.state().driftPpb -
+                                    clock.drift(t) * 1e3);
+        /*allow the filter to follow the drift step*/
+        auto sinceStep = t - SIM_DURATION_S * 1e6 / 2;
+        if ((sinceStep < 0 || sinceStep > STEP_SETTLE_S * 1e6) &&
+            driftError > maxDriftError)
+            maxDriftError = driftError;
+
+        /*corrected CM4 time somewhere before the next sample*/
+        auto probe = t + unit(gen) * PUBLISH_PERIOD_S * 1e6;
+        auto corrected = static_cast<double>(
+            static_cast<int64_t>(estimator.toMaster(clock.local(probe))));
+        auto error = std::fabs(corrected - probe);
+        sumError2 += error * error;
+        nChecks++;
+        if (error > maxError)
+            maxError = error;
+    }
+
+    const auto &stats = estimator.state().stats;
+    auto rms = std::sqrt(sumError2 / nChecks);
+    bool pass =
+        maxError <= MAX_TIME_ERROR_US && maxDriftError <= MAX_DRIFT_ERROR_PPB;
+
+    printf("%-22s drift %8ld ppb (true %8.0f), drift err max %6.0f ppb, "
+           "time err max %5.2f us rms %5.2f us, samples %u rejected %u, "
+           "residual max %u us: %s\n",
+           scenario.name, static_cast<long>(stats.driftPpb),
+           clock.drift(SIM_DURATION_S * 1e6) * 1e3, maxDriftError, maxError,
+           rms, stats.samples, stats.rejected, stats.maxResidualUs,
+           pass ? "PASS" : "FAIL");
+    return pass;
+}
+
+int main() {
+    static const Scenario scenarios[] = {
+        {"same clock", 0.0, 0.0, 35000.0, 0.0},
+        {"fast CM4 clock", 25.0, 0.0, 35000.0, 0.01},
+        {"slow CM4 clock", -40.0, 0.0, 120000.0, 0.01},
+        {"drift step", 10.0, 2.0, 35000.0, 0.02},
+        {"heavy preemption", -5.0, 0.0, 35000.0, 0.3},
+    };
+
+    std::mt19937 gen(1234);
+    bool pass = true;
+    for (const auto &scenario : scenarios)
+        pass = run(scenario, gen) && pass;
+
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -18,7 +18,9 @@
 
 #include <carbon/trace_format.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 
 using namespace CARBON;
 
@@ -42,8 +44,44 @@ using namespace CARBON;
 
 #define MAXDATASIZE 100 // max number of bytes we can get at once
 
+/*the packet header or the largest event*/
 static constexpr auto BUF_SIZE =
-    sizeof(TracePacketHeader) + sizeof(TraceTaskSwitchedInEvent);
+    std::max<size_t>(sizeof(TracePacketHeader),
+                     TraceEventHeader::MAX_EVENT_SIZE_BYTES);
+
+/*CarbonLatencySource and CarbonLatencyKind, common/include/carbon/latency.hpp*/
+static const char *LATENCY_SOURCES[] = {"systime", "eth", "sdmmc", "spi2"};
+static const char *LATENCY_KINDS[] = {"entry", "handler", "wakeup"};
+
+static void printLatency(const TraceLatencyEvent &event) {
+    auto name = [](const char *const *names, size_t size, uint32_t index) {
+        return index < size ? names[index] : "?";
+    };
+    uint32_t perUs = event.cyclesPerUs ? event.cyclesPerUs : 1;
+    std::cout << "Latency: source "
+              << name(LATENCY_SOURCES, std::size(LATENCY_SOURCES),
+                      event.source)
+              << " kind "
+              << name(LATENCY_KINDS, std::size(LATENCY_KINDS), event.kind)
+              << " count " << event.count << " p50 " << event.p50Cycles
+              << " p99 " << event.p99Cycles << " max " << event.maxCycles
+              << " cycles, " << event.cyclesPerUs << " cycles/us"
+              << std::endl;
+    /*the empty buckets are skipped*/
+    uint32_t buckets = std::min<uint32_t>(event.buckets, LATENCY_BUCKETS);
+    for (uint32_t i = 0; i < buckets; i++) {
+        if (event.counts[i] == 0)
+            continue;
+        uint32_t high = latencyBucketHigh(i);
+        std::cout << "  " << latencyBucketLow(i) << "-";
+        if (high == UINT32_MAX)
+            std::cout << "inf";
+        else
+            std::cout << high;
+        std::cout << " cycles (" << latencyBucketLow(i) / perUs << " us) "
+                  << event.counts[i] << std::endl;
+    }
+}
 
 // get sockaddr, IPv4 or IPv6:
 void *get_in_addr(struct sockaddr *sa) {
@@ -138,7 +176,7 @@ int main(int argc, char *argv[]) {
 
         std::cout << "data stream size " << bytesLeftStream << std::endl;
 
-        if (bytesLeftStream < 0 || bytesLeftStream < sizeof(TraceEventHeader)) {
+        if (bytesLeftStream < static_cast<int>(sizeof(TraceEventHeader))) {
             perror("too few data stream byte");
             exit(1);
         }
@@ -236,6 +274,16 @@ int main(int argc, char *argv[]) {
                           << std::endl;
                 break;
             }
+            case TraceEventID::Latency:
+                printLatency(*reinterpret_cast<TraceLatencyEvent *>(buf));
+                break;
+            case TraceEventID::User: {
+                TraceUserEvent *eventPtr =
+                    reinterpret_cast<TraceUserEvent *>(buf);
+                std::cout << "User: channel " << eventPtr->channel
+                          << " length " << eventPtr->length << std::endl;
+                break;
+            }
             case TraceEventID::Tasks:
                 break;
             }